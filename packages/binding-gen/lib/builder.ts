@@ -1,6 +1,8 @@
 import { promises as fs } from 'node:fs';
 import { dirname, join } from 'node:path';
 import type { Template } from './templates/schema.ts';
+import { buildProfileLines } from '../../codegen/generators/build-profile.ts';
+import type { BuildProfile } from '../../codegen/types.ts';
 import { render, TS_IMPORTS, kGetPtrExport } from './templates/schema.ts';
 
 export interface GenerateUnit {
@@ -18,9 +20,14 @@ export interface GenerateOptions {
     linkLibraries?: string[];
     definitions?: string[];
     extraLines?: string[];
+    profile?: BuildProfile;
   };
 }
 
+// Same profiles as codegen's GeneratorOptions.buildProfile, and the same CMake
+// lines: codegen's buildProfileLines is the single copy
+export type { BuildProfile } from '../../codegen/types.ts';
+
 async function ensureDir(p: string): Promise<void> {
   await fs.mkdir(p, { recursive: true });
 }
@@ -82,7 +89,8 @@ export class BindingBuilder {
 
     // CMake configuration
     const cmakeLines: string[] = [];
-    cmakeLines.push('cmake_minimum_required(VERSION 3.15)');
+    // check_linker_flag needs 3.18
+    cmakeLines.push(`cmake_minimum_required(VERSION ${cmake?.profile === 'size' ? '3.18' : '3.15'})`);
     cmakeLines.push(`project(${packageName})`);
     cmakeLines.push('add_definitions(-DNAPI_VERSION=9)');
     cmakeLines.push('set(CMAKE_CXX_STANDARD 17)');
@@ -107,6 +115,9 @@ export class BindingBuilder {
     if (cmake?.definitions?.length) {
       for (const def of cmake.definitions) cmakeLines.push(`add_definitions(${def})`);
     }
+    if (cmake?.profile) {
+      cmakeLines.push(...buildProfileLines(cmake.profile));
+    }
     if (cmake?.extraLines?.length) {
       cmakeLines.push(...cmake.extraLines);
     }
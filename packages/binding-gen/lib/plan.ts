@@ -25,6 +25,7 @@ export interface CallbackPlan {
   name: string;
   ctype: string;           // function pointer signature
   lifetime?: string;       // resource:Name to tie lifetime
+  mode?: 'sync' | 'threadsafe'; // threadsafe: may be called from other threads
 }
 
 export interface ErrorRule { function: string; rule: 'nonZeroIsError' | 'negativeIsError'; throw?: boolean }
@@ -34,6 +35,6 @@ export interface StrategyPlan {
   enums?: EnumPlan[];
   callbacks?: CallbackPlan[];
   errors?: ErrorRule[];
-  ownership?: Array<{ owner: string; child: string }>;
+  ownership?: Array<{ owner: string; child: string }>; // child handles pin their owner (codegen --owner)
 }
 
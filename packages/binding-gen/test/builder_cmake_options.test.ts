@@ -39,5 +39,26 @@ describe('builder cmake options', () => {
     assert.match(cmake, /add_definitions\(-DTEST_FLAG=1\)/);
     assert.match(cmake, /# EXTRA LINE/);
   });
+
+  it('emits the speed and size build profiles', async (t: TestContext) => {
+    const outDir = outDirs.get(t)!;
+    const units = [{ template: enumTpl, bindings: { name: 'X', entries: [] } }];
+    const builder = new BindingBuilder();
+
+    await builder.generate({ outDir, units, cmake: { profile: 'speed' } });
+    let cmake = await fs.readFile(join(outDir, 'CMakeLists.txt'), 'utf8');
+    assert.match(cmake, /CXX_VISIBILITY_PRESET hidden/);
+    assert.match(cmake, /INTERPROCEDURAL_OPTIMIZATION ON/);
+    assert.match(cmake, /PRIVATE -O3\)/);
+    assert.doesNotMatch(cmake, /gc-sections/);
+
+    await builder.generate({ outDir, units, cmake: { profile: 'size' } });
+    cmake = await fs.readFile(join(outDir, 'CMakeLists.txt'), 'utf8');
+    assert.match(cmake, /^cmake_minimum_required\(VERSION 3\.18\)/);
+    assert.match(cmake, /PRIVATE -Os -ffunction-sections -fdata-sections\)/);
+    assert.match(cmake, /-Wl,--gc-sections/);
+    assert.match(cmake, /-Wl,--icf=all/);
+    assert.doesNotMatch(cmake, /INTERPROCEDURAL_OPTIMIZATION/);
+  });
 });
 
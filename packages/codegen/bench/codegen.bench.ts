@@ -0,0 +1,285 @@
+// Codegen scaling benchmark: times each phase of a generateBindings run
+// (parseHeader, CppGenerator.generate, TsGenerator.generate and the
+// BuildGenerator files) on synthetic headers of increasing size, and on
+// mathlib.h and clang-c/Index.h as real-world points. Each header runs in a
+// fresh node process, so its peak RSS is its own. A phase whose time grows
+// clearly faster than the header between two synthetic sizes is flagged.
+//
+// A synthetic header of size n declares n functions plus n/10 structs and
+// n/10 enums, with the by-value struct, struct pointer, enum, string and
+// (T *data, size_t n) signatures the generators special-case.
+//
+//   node bench/codegen.bench.ts [sizes] [--index <path/to/clang-c/Index.h>]
+//
+// e.g. `node bench/codegen.bench.ts 1000,10000,50000`. Index.h is looked up
+// in the usual LLVM install locations when --index is not given.
+import { execFileSync } from 'node:child_process';
+import { existsSync, mkdtempSync, readdirSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { basename, dirname, join } from 'node:path';
+import { performance } from 'node:perf_hooks';
+import { parseArgs } from 'node:util';
+import { BuildGenerator } from '../generators/build-generator.ts';
+import { CppGenerator } from '../generators/cpp-generator.ts';
+import { TsGenerator } from '../generators/ts-generator.ts';
+import { parseHeader } from '../h-parser/index.ts';
+
+const phases = ['parse', 'cpp', 'ts', 'build'] as const;
+type Phase = (typeof phases)[number];
+
+interface Sample {
+  label: string;
+  declarations: number;
+  ms: Record<Phase, number>;
+  // process.resourceUsage().maxRSS (KiB) once each phase is done
+  rss: Record<Phase, number>;
+  outputBytes: number;
+}
+
+// A phase is flagged when it grows by more than size^maxExponent between two
+// synthetic sizes, ignoring phases too fast to time reliably
+const maxExponent = 1.2;
+const minFlaggedMs = 20;
+
+function syntheticHeader(functions: number): string {
+  const records = Math.max(1, Math.floor(functions / 10));
+  const lines = ['#include <stddef.h>', ''];
+  for (let i = 0; i < records; i++) {
+    const constants = `SYN_E${i}_A, SYN_E${i}_B = ${i}, SYN_E${i}_C`;
+    const fields = `int id; double weight; SynEnum${i} kind; const char *name;`;
+    lines.push(
+      `typedef enum { ${constants} } SynEnum${i};`,
+      `typedef struct { ${fields} } SynRecord${i};`,
+      `typedef struct { double x; double y; } SynPoint${i};`,
+    );
+  }
+  lines.push('');
+  for (let i = 0; i < functions; i++) {
+    const r = i % records;
+    switch (i % 6) {
+      case 0:
+        lines.push(`int syn_add${i}(int a, int b);`);
+        break;
+      case 1:
+        lines.push(`double syn_scale${i}(double x, SynEnum${r} mode);`);
+        break;
+      case 2:
+        lines.push(
+          `SynPoint${r} syn_point${i}(SynPoint${r} p, double factor);`,
+        );
+        break;
+      case 3:
+        lines.push(
+          `SynRecord${r} syn_record${i}(const char *name, int id);`,
+        );
+        break;
+      case 4:
+        lines.push(
+          `const char *syn_name${i}(const SynRecord${r} *record);`,
+        );
+        break;
+      default:
+        lines.push(
+          `void syn_fill${i}(double *values, size_t count, double value);`,
+        );
+        break;
+    }
+  }
+  return `${lines.join('\n')}\n`;
+}
+
+// Child side: one header through every phase, reported as JSON on stdout
+function measure(
+  headerPath: string,
+  label: string,
+  includePaths: string[],
+): Sample {
+  const headerInclude =
+    label === 'Index.h' ? 'clang-c/Index.h' : basename(headerPath);
+  const ms = {} as Record<Phase, number>;
+  const rss = {} as Record<Phase, number>;
+  const time = <T>(phase: Phase, run: () => T): T => {
+    const start = performance.now();
+    const result = run();
+    ms[phase] = performance.now() - start;
+    rss[phase] = process.resourceUsage().maxRSS;
+    return result;
+  };
+
+  const ast = time('parse', () =>
+    parseHeader(headerPath, {
+      language: 'c',
+      includePaths,
+      includeDocumentation: true,
+      detailedProcessing: true,
+    }),
+  );
+  const binding = time('cpp', () =>
+    new CppGenerator(ast, 'bench', headerInclude, [headerInclude]).generate(),
+  );
+  const index = time('ts', () => new TsGenerator(ast, 'bench').generate());
+  const buildFiles = time('build', () => {
+    const build = new BuildGenerator({
+      outputDir: tmpdir(),
+      packageName: 'bench',
+      includePaths,
+      libraryName: 'bench',
+    });
+    return [
+      build.generateCMakeLists(),
+      build.generatePackageJson(),
+      build.generateTestFile(),
+    ];
+  });
+
+  return {
+    label,
+    declarations:
+      (ast.functions?.length ?? 0) + ast.structs.length + ast.enums.length,
+    ms,
+    rss,
+    outputBytes: [binding, index, ...buildFiles].reduce(
+      (sum, text) => sum + Buffer.byteLength(text),
+      0,
+    ),
+  };
+}
+
+function findIndexHeader(): string | undefined {
+  const candidates = [
+    '/opt/homebrew/opt/llvm/include',
+    '/usr/local/opt/llvm/include',
+    '/usr/include',
+  ];
+  for (const dir of existsSync('/usr/lib') ? readdirSync('/usr/lib') : []) {
+    if (dir.startsWith('llvm')) {
+      candidates.push(join('/usr/lib', dir, 'include'));
+    }
+  }
+  return candidates
+    .map((dir) => join(dir, 'clang-c', 'Index.h'))
+    .find((path) => existsSync(path));
+}
+
+function run(
+  headerPath: string,
+  label: string,
+  includePaths: string[] = [],
+): Sample | undefined {
+  try {
+    const output = execFileSync(
+      process.execPath,
+      [
+        import.meta.filename,
+        '--child',
+        headerPath,
+        '--label',
+        label,
+        ...includePaths.flatMap((p) => ['-I', p]),
+      ],
+      {
+        encoding: 'utf8',
+        maxBuffer: 64 * 1024 * 1024,
+        stdio: ['ignore', 'pipe', 'inherit'],
+      },
+    );
+    return JSON.parse(output) as Sample;
+  } catch {
+    console.log(`${label}: failed, skipped`);
+    return undefined;
+  }
+}
+
+const { values, positionals } = parseArgs({
+  args: process.argv.slice(2),
+  options: {
+    child: { type: 'string' },
+    label: { type: 'string' },
+    include: { type: 'string', short: 'I', multiple: true },
+    index: { type: 'string' },
+  },
+  allowPositionals: true,
+});
+
+if (values.child) {
+  // The generators report progress on the console; only the sample goes out
+  const write = process.stdout.write.bind(process.stdout);
+  console.log = () => {};
+  const sample = measure(
+    values.child,
+    values.label ?? basename(values.child),
+    values.include ?? [],
+  );
+  write(JSON.stringify(sample));
+} else {
+  const sizes = (positionals[0] ?? '1000,10000,50000').split(',').map(Number);
+  const dir = mkdtempSync(join(tmpdir(), 'codegen-bench-'));
+
+  const synthetic: Sample[] = [];
+  for (const size of sizes) {
+    const headerPath = join(dir, `synthetic-${size}.h`);
+    writeFileSync(headerPath, syntheticHeader(size));
+    const sample = run(headerPath, `synthetic ${size}`);
+    if (sample) synthetic.push(sample);
+  }
+  const real: Sample[] = [];
+  const mathlib = run(
+    join(import.meta.dirname, '..', 'test', 'fixtures', 'mathlib.h'),
+    'mathlib.h',
+  );
+  if (mathlib) real.push(mathlib);
+  const indexHeader = values.index ?? findIndexHeader();
+  if (indexHeader) {
+    const index = run(indexHeader, 'Index.h', [dirname(dirname(indexHeader))]);
+    if (index) real.push(index);
+  } else {
+    console.log('clang-c/Index.h not found (pass --index), skipped');
+  }
+
+  const samples = [...synthetic, ...real];
+  const mib = (kib: number) => `${(kib / 1024).toFixed(0)} MiB`.padStart(9);
+  const header = phases.map((phase) => `${phase} ms`.padStart(9)).join(' ');
+  const row = (label: string, cells: string[]) =>
+    console.log([label.padEnd(16), ...cells].join(' '));
+  row('input', ['decls'.padStart(7), header, 'output'.padStart(9)]);
+  for (const sample of samples) {
+    const kib = `${(sample.outputBytes / 1024).toFixed(0)} KiB`;
+    row(sample.label, [
+      String(sample.declarations).padStart(7),
+      ...phases.map((phase) => sample.ms[phase].toFixed(1).padStart(9)),
+      kib.padStart(9),
+    ]);
+  }
+  console.log('');
+  row('peak RSS after', phases.map((phase) => phase.padStart(9)));
+  for (const sample of samples) {
+    row(sample.label, phases.map((phase) => mib(sample.rss[phase])));
+  }
+  console.log('');
+
+  // Growth exponent of each phase between consecutive synthetic sizes:
+  // 1 is linear, 2 quadratic
+  for (let i = 1; i < synthetic.length; i++) {
+    const [a, b] = [synthetic[i - 1]!, synthetic[i]!];
+    const sizeRatio = b.declarations / a.declarations;
+    for (const phase of [...phases, 'output'] as const) {
+      const [before, after] =
+        phase === 'output'
+          ? [a.outputBytes, b.outputBytes]
+          : [a.ms[phase], b.ms[phase]];
+      if (before <= 0 || (phase !== 'output' && after < minFlaggedMs)) {
+        continue;
+      }
+      const exponent = Math.log(after / before) / Math.log(sizeRatio);
+      if (exponent > maxExponent) {
+        const growth = (after / before).toFixed(1);
+        console.log(
+          `⚠️  ${phase} grows superlinearly from ${a.label} to ${b.label}: ` +
+            `${growth}x for ${sizeRatio.toFixed(1)}x the declarations ` +
+            `(n^${exponent.toFixed(2)})`,
+        );
+      }
+    }
+  }
+  console.log(`headers kept at: ${dir}`);
+}
@@ -0,0 +1,72 @@
+// Struct marshaling benchmark over the mathlib fixture: generates and builds
+// the binding in a temp dir, then times the Point2D / Circle round-trips that
+// are passed by value as plain objects, and a scalar loop against its
+// vectorized power_many companion.
+//
+//   node bench/mathlib.bench.ts [iterations]
+import { execSync } from 'node:child_process';
+import { cpSync, mkdtempSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { performance } from 'node:perf_hooks';
+import { generateBindings } from '../generator.ts';
+
+const iterations = Number(process.argv[2] ?? 1_000_000);
+
+const fixturesDir = join(import.meta.dirname, '..', 'test', 'fixtures');
+const tempDir = mkdtempSync(join(tmpdir(), 'mathlib-bench-'));
+const outputDir = join(tempDir, 'mathlib-binding');
+
+await generateBindings([join(fixturesDir, 'mathlib.h')], {
+  outputDir,
+  packageName: 'mathlib-binding',
+  packageVersion: '0.0.1',
+  libraryName: 'mathlib',
+  headerIncludePath: 'mathlib.h',
+  // The fixture sources are copied next to the binding
+  includePaths: [join(outputDir, 'src')],
+  manyFunctions: ['power'],
+});
+cpSync(join(fixturesDir, 'mathlib.cpp'), join(outputDir, 'src', 'mathlib.cpp'));
+cpSync(join(fixturesDir, 'mathlib.h'), join(outputDir, 'src', 'mathlib.h'));
+execSync('npm install', { cwd: outputDir, stdio: 'inherit' });
+execSync('npm run build', { cwd: outputDir, stdio: 'inherit' });
+
+const addon = await import(join(outputDir, 'index.ts'));
+
+function bench(name: string, fn: () => unknown, runs = iterations): void {
+  // Warm up so the timed loop runs optimized code
+  for (let i = 0; i < 10_000; i++) fn();
+  const start = performance.now();
+  for (let i = 0; i < runs; i++) fn();
+  const elapsed = performance.now() - start;
+  const nsPerOp = (elapsed * 1e6) / runs;
+  console.log(`${name.padEnd(28)} ${nsPerOp.toFixed(1).padStart(8)} ns/op`);
+}
+
+const p1 = addon.create_point(3, 4);
+const p2 = addon.create_point(0, 0);
+const circle = addon.create_circle(p1, 2);
+
+console.log(`iterations: ${iterations}`);
+bench('create_point', () => addon.create_point(1, 2));
+bench('distance', () => addon.distance(p1, p2));
+bench('add_points', () => addon.add_points(p1, p2));
+bench('createPoint2D', () => addon.createPoint2D({ x: 1, y: 2 }));
+bench('getPoint2D_x', () => addon.getPoint2D_x(p1));
+bench('circle_contains_point', () => addon.circle_contains_point(circle, p1));
+
+// 1000 evaluations per op: one call each vs one power_many crossing
+const bases = new Float64Array(1000).fill(1.5);
+const exponents = new Int32Array(1000).fill(3);
+const powers = new Float64Array(1000);
+const batchRuns = Math.max(1, Math.floor(iterations / 1000));
+bench(
+  'power x1000',
+  () => {
+    for (let i = 0; i < 1000; i++) addon.power(bases[i], exponents[i]);
+  },
+  batchRuns,
+);
+bench('power_many x1000', () => addon.power_many(bases, exponents, powers), batchRuns);
+console.log(`binding kept at: ${outputDir}`);
@@ -0,0 +1,87 @@
+import { createHash } from 'node:crypto';
+import { mkdirSync, readFileSync, writeFileSync } from 'node:fs';
+import { mkdir, readFile, writeFile } from 'node:fs/promises';
+import { dirname, join } from 'node:path';
+
+// Bump when the shape of cached ASTs or generated wrappers changes
+export const CACHE_VERSION = 3;
+
+interface WrapperCacheFile {
+  version: number;
+  // Hash of the generator sources that produced the wrappers
+  generator: string;
+  wrappers: Record<string, string>;
+}
+
+export function hashContent(...parts: string[]): string {
+  const hash = createHash('sha256');
+  for (const part of parts) {
+    hash.update(part);
+    hash.update('\0');
+  }
+  return hash.digest('hex');
+}
+
+export function hashFile(path: string): string | undefined {
+  try {
+    return hashContent(readFileSync(path, 'utf-8'));
+  } catch {
+    return undefined;
+  }
+}
+
+export function readJson<T>(path: string): T | undefined {
+  try {
+    return JSON.parse(readFileSync(path, 'utf-8')) as T;
+  } catch {
+    return undefined;
+  }
+}
+
+// Wrapper text is only reusable with the same generator code
+function generatorFingerprint(): string {
+  return hashContent(
+    ...['./generators/cpp-generator.ts', './type-mapper.ts'].map((path) =>
+      readFileSync(new URL(path, import.meta.url), 'utf-8'),
+    ),
+  );
+}
+
+/**
+ * Generated C++ wrapper bodies from the previous run, keyed by a hash of the
+ * declaration and of everything else the wrapper text depends on.
+ */
+export function loadWrapperCache(cacheDir: string): Map<string, string> {
+  const file = readJson<WrapperCacheFile>(join(cacheDir, 'wrappers.json'));
+  if (file?.version !== CACHE_VERSION || file.generator !== generatorFingerprint()) {
+    return new Map();
+  }
+  return new Map(Object.entries(file.wrappers));
+}
+
+export function saveWrapperCache(cacheDir: string, wrappers: ReadonlyMap<string, string>): void {
+  const file: WrapperCacheFile = {
+    version: CACHE_VERSION,
+    generator: generatorFingerprint(),
+    wrappers: Object.fromEntries(wrappers),
+  };
+  mkdirSync(cacheDir, { recursive: true });
+  writeFileSync(join(cacheDir, 'wrappers.json'), JSON.stringify(file), 'utf-8');
+}
+
+/**
+ * Write a file only when its content differs, keeping the mtime of unchanged
+ * outputs so incremental builds skip them. Returns whether it was written.
+ */
+export async function writeFileIfChanged(path: string, content: string): Promise<boolean> {
+  try {
+    if ((await readFile(path, 'utf-8')) === content) {
+      return false;
+    }
+  } catch {
+    // Missing or unreadable; write it
+  }
+  await mkdir(dirname(path), { recursive: true });
+  await writeFile(path, content, 'utf-8');
+  return true;
+}
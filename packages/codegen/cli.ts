@@ -1,9 +1,12 @@
 #!/usr/bin/env node
 
+import { readFileSync } from 'node:fs';
+import { availableParallelism } from 'node:os';
 import { resolve } from 'node:path';
 import { parseArgs } from 'node:util';
 import { generateBindings } from './generator.ts';
-import type { GeneratorOptions } from './types.ts';
+import { type PlanRoots, planRoots } from './tree-shake.ts';
+import type { BuildProfile, GeneratorOptions } from './types.ts';
 
 // Parse command-line arguments
 const { values, positionals } = parseArgs({
@@ -55,6 +58,60 @@ const { values, positionals } = parseArgs({
       short: 'D',
       multiple: true,
     },
+    'native-extension': {
+      type: 'string',
+      multiple: true,
+    },
+    'ts-extension': {
+      type: 'string',
+      multiple: true,
+    },
+    'struct-view': {
+      type: 'string',
+      multiple: true,
+    },
+    many: {
+      type: 'string',
+      multiple: true,
+    },
+    'threadsafe-callback': {
+      type: 'string',
+      multiple: true,
+    },
+    owner: {
+      type: 'string',
+      multiple: true,
+    },
+    'cache-dir': {
+      type: 'string',
+    },
+    shards: {
+      type: 'string',
+      default: '1',
+    },
+    pch: {
+      type: 'boolean',
+    },
+    unity: {
+      type: 'string',
+    },
+    profile: {
+      type: 'string',
+    },
+    allow: {
+      type: 'string',
+      multiple: true,
+    },
+    allowlist: {
+      type: 'string',
+    },
+    plan: {
+      type: 'string',
+    },
+    jobs: {
+      type: 'string',
+      short: 'j',
+    },
     help: {
       type: 'boolean',
       short: 'h',
@@ -81,6 +138,21 @@ Options:
   --framework-path <p>    Framework search path (macOS) (can be specified multiple times)
   -H, --header-include <p> Path to use in #include directive (e.g., clang-c/Index.h)
   -D, --define <macro>    Define preprocessor macro (can be specified multiple times)
+  --native-extension <f>  Hand-written registrar called from Init (can be specified multiple times)
+  --ts-extension <m>      Hand-written TS module re-exported from index.ts (can be specified multiple times)
+  --struct-view <s>       Back struct/union <s> with an ArrayBuffer view, '*' for all (can be specified multiple times)
+  --many <fn>             Also export a vectorized <fn>_many over TypedArrays, '*' for all scalar functions (can be specified multiple times)
+  --threadsafe-callback <t>  Retain JS functions passed for callback typedef <t> and accept calls from other threads; <t> needs a void * user-data parameter, and each retained function is kept until exit (can be specified multiple times)
+  --owner <o>:<c>         Handles of type <c> pin the <o> they came from, e.g. CXTranslationUnit:CXCursor (can be specified multiple times)
+  --cache-dir <dir>       Cache parsed headers and generated wrappers in <dir> between runs
+  --shards <n>            Split src/binding.cpp into <n> translation units that compile in parallel (default: 1)
+  --pch                   Precompile napi.h and the library headers
+  --unity <n>             Compile the generated sources as unity builds of <n> files each
+  --profile <p>           Release build profile: speed (-O3, LTO, hidden visibility) or size (-Os, section GC, ICF)
+  --allow <name>          Only bind this function or type and what it reaches (can be specified multiple times)
+  --allowlist <file>      Like --allow, one name per line (# starts a comment)
+  --plan <file>           Like --allow, for every function and type a binding-gen StrategyPlan (JSON) uses
+  -j, --jobs <n>          Parse multiple headers on <n> worker threads (default: number of CPUs)
 
 Examples:
   # Generate bindings for a simple C library
@@ -97,6 +169,24 @@ Examples:
 `);
 }
 
+// Roots for tree-shaking from --allow, --allowlist and --plan; undefined
+// when none is given
+function readAllowlist(): string[] | undefined {
+  const names = [...((values.allow as string[]) || [])];
+  if (values.allowlist) {
+    for (const line of readFileSync(values.allowlist as string, 'utf-8').split('\n')) {
+      const name = line.replace(/#.*/, '').trim();
+      if (name) {
+        names.push(name);
+      }
+    }
+  }
+  if (values.plan) {
+    names.push(...planRoots(JSON.parse(readFileSync(values.plan as string, 'utf-8')) as PlanRoots));
+  }
+  return names.length > 0 ? names : undefined;
+}
+
 async function main() {
   if (values.help || positionals.length === 0) {
     showHelp();
@@ -110,6 +200,11 @@ async function main() {
     process.exit(1);
   }
 
+  if (values.profile && values.profile !== 'speed' && values.profile !== 'size') {
+    console.error(`Error: Unknown build profile '${values.profile}' (expected speed or size)`);
+    process.exit(1);
+  }
+
   const options: GeneratorOptions = {
     outputDir: resolve(values.output as string),
     packageName: values.name as string,
@@ -122,6 +217,25 @@ async function main() {
     frameworkPaths: (values['framework-path'] as string[]) || [],
     defines: (values.define as string[]) || [],
     headerIncludePath: values['header-include'] as string,
+    nativeExtensions: (values['native-extension'] as string[]) || [],
+    tsExtensions: (values['ts-extension'] as string[]) || [],
+    structViews: (values['struct-view'] as string[]) || [],
+    manyFunctions: (values.many as string[]) || [],
+    callbacks: ((values['threadsafe-callback'] as string[]) || []).map((ctype) => ({
+      ctype,
+      mode: 'threadsafe' as const,
+    })),
+    ownership: ((values.owner as string[]) || []).map((rule) => {
+      const [owner = '', child = ''] = rule.split(':');
+      return { owner, child };
+    }),
+    cacheDir: values['cache-dir'] ? resolve(values['cache-dir'] as string) : undefined,
+    shards: Number.parseInt(values.shards as string, 10) || 1,
+    precompileHeaders: Boolean(values.pch),
+    unityBatchSize: values.unity ? Number.parseInt(values.unity as string, 10) || 0 : 0,
+    buildProfile: values.profile as BuildProfile | undefined,
+    allowlist: readAllowlist(),
+    parseJobs: values.jobs ? Number.parseInt(values.jobs as string, 10) || 1 : availableParallelism(),
   };
 
   try {
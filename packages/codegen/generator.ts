@@ -1,11 +1,35 @@
-import { mkdir, writeFile } from 'node:fs/promises';
-import { dirname, join } from 'node:path';
-import { type HeaderAST, parseHeader } from './h-parser/index.ts';
+import { readdir, unlink } from 'node:fs/promises';
+import { join } from 'node:path';
+import { loadWrapperCache, saveWrapperCache, writeFileIfChanged } from './cache.ts';
+import { parseHeaderCached } from './h-parser/cache.ts';
+import { type HeaderAST, type ParseOptions, parseHeader } from './h-parser/index.ts';
+import { parseHeadersInParallel } from './h-parser/parallel.ts';
 import { BuildGenerator } from './generators/build-generator.ts';
 import { CppGenerator } from './generators/cpp-generator.ts';
 import { TsGenerator } from './generators/ts-generator.ts';
+import { treeShake } from './tree-shake.ts';
 import type { GeneratedFiles, GeneratorOptions } from './types.ts';
 
+// Headers that include one another each report the shared declarations, so
+// the same USR turns up in several ASTs. The first occurrence keeps its
+// place; a complete definition replaces an earlier forward declaration.
+function dedupeByUsr<T extends { usr?: string }>(decls: T[], isComplete: (decl: T) => boolean = () => true): T[] {
+  const positions = new Map<string, number>();
+  const result: T[] = [];
+  for (const decl of decls) {
+    const position = decl.usr === undefined ? undefined : positions.get(decl.usr);
+    if (position === undefined) {
+      if (decl.usr !== undefined) {
+        positions.set(decl.usr, result.length);
+      }
+      result.push(decl);
+    } else if (!isComplete(result[position]!) && isComplete(decl)) {
+      result[position] = decl;
+    }
+  }
+  return result;
+}
+
 function combineASTs(asts: HeaderAST[], headerPaths: string[]): HeaderAST {
   // Use the first AST as base and merge others into it
   const combined: HeaderAST = {
@@ -36,6 +60,10 @@ function combineASTs(asts: HeaderAST[], headerPaths: string[]): HeaderAST {
     combined.objc_protocols.push(...(ast.objc_protocols || []));
     combined.objc_categories.push(...(ast.objc_categories || []));
   }
+  combined.enums = dedupeByUsr(combined.enums);
+  combined.structs = dedupeByUsr(combined.structs, (struct) => struct.size !== undefined);
+  combined.typedefs = dedupeByUsr(combined.typedefs);
+  combined.functions = dedupeByUsr(combined.functions!);
 
   console.log(`🔗 Combined ${asts.length} ASTs:`);
   console.log(`   Functions: ${combined.functions.length}`);
@@ -52,8 +80,8 @@ export async function generateBindings(
   options: GeneratorOptions,
 ): Promise<void> {
   // Parse options for header files
-  const parseOptions = {
-    language: options.defines?.includes('__cplusplus') ? 'c++' : 'c' as const,
+  const parseOptions: ParseOptions = {
+    language: options.defines?.includes('__cplusplus') ? 'c++' : 'c',
     includePaths: options.includePaths || [],
     frameworkPaths: options.frameworkPaths || [],
     frameworks: options.frameworks || [],
@@ -62,20 +90,26 @@ export async function generateBindings(
     detailedProcessing: true,
   };
 
-  // Parse all header files and combine ASTs
+  // Parse all header files and combine ASTs, reusing cached ASTs of
+  // unchanged headers
+  const parse = (headerPath: string) =>
+    options.cacheDir
+      ? parseHeaderCached(headerPath, parseOptions, options.cacheDir)
+      : parseHeader(headerPath, parseOptions);
   let combinedAST: HeaderAST;
 
   if (headerPaths.length === 1) {
     // Single header file - parse normally
-    combinedAST = parseHeader(headerPaths[0], parseOptions);
+    combinedAST = parse(headerPaths[0]!);
   } else {
     // Multiple header files - parse each and combine ASTs
-    console.log(`📚 Parsing ${headerPaths.length} header files...`);
-    
-    const asts = headerPaths.map((headerPath, index) => {
-      console.log(`  ${index + 1}. ${headerPath}`);
-      return parseHeader(headerPath, parseOptions);
-    });
+    const jobs = options.parseJobs ?? 1;
+    console.log(`📚 Parsing ${headerPaths.length} header files${jobs > 1 ? ` on ${jobs} threads` : ''}...`);
+    headerPaths.forEach((headerPath, index) => console.log(`  ${index + 1}. ${headerPath}`));
+
+    const asts = jobs > 1
+      ? await parseHeadersInParallel(headerPaths, parseOptions, jobs, options.cacheDir)
+      : headerPaths.map(parse);
 
     // Combine all ASTs into one
     combinedAST = combineASTs(asts, headerPaths);
@@ -141,28 +175,49 @@ export async function generateBindingsFromJSON(
 }
 
 function generateFilesFromAST(
-  ast: HeaderAST,
+  fullAST: HeaderAST,
   options: GeneratorOptions,
 ): GeneratedFiles {
+  const ast = options.allowlist?.length ? treeShake(fullAST, options.allowlist, options.ownership) : fullAST;
+
+  // Wrappers of unchanged declarations come from the previous run
+  const wrapperCache = options.cacheDir ? loadWrapperCache(options.cacheDir) : undefined;
+
   // Initialize generators
   const cppGen = new CppGenerator(
     ast,
     options.packageName,
     options.headerIncludePath,
     options.headerIncludePaths,
+    options.nativeExtensions,
+    options.structViews,
+    options.manyFunctions,
+    options.callbacks,
+    options.ownership,
+    wrapperCache,
   );
-  const tsGen = new TsGenerator(ast, options.packageName);
+  const tsGen = new TsGenerator(ast, options.packageName, options.tsExtensions, options.manyFunctions);
   const buildGen = new BuildGenerator(options);
 
   // Generate all files
+  const shards = options.shards ?? 1;
+  const { 'src/binding.cpp': binding, ...shardFiles } =
+    shards > 1 ? cppGen.generateShards(shards) : { 'src/binding.cpp': cppGen.generate() };
   const files: GeneratedFiles = {
-    'src/binding.cpp': cppGen.generate(),
+    'src/binding.cpp': binding!,
+    ...shardFiles,
     'CMakeLists.txt': buildGen.generateCMakeLists(),
     'package.json': buildGen.generatePackageJson(),
     'index.ts': tsGen.generate(),
     'test.ts': buildGen.generateTestFile(),
   };
 
+  if (options.cacheDir) {
+    saveWrapperCache(options.cacheDir, cppGen.getWrapperCache());
+    const { reused, generated } = cppGen.getWrapperStats();
+    console.log(`  ♻️  Function wrappers: ${reused} reused, ${generated} regenerated`);
+  }
+
   return files;
 }
 
@@ -170,18 +225,19 @@ async function writeGeneratedFiles(
   outputDir: string,
   files: GeneratedFiles,
 ): Promise<void> {
-  // Create output directory
-  await mkdir(outputDir, { recursive: true });
-
-  // Write each file
+  // Files whose content is unchanged keep their mtime, so an incremental
+  // build of the output skips them
   for (const [relativePath, content] of Object.entries(files)) {
-    const fullPath = join(outputDir, relativePath);
-
-    // Ensure directory exists
-    await mkdir(dirname(fullPath), { recursive: true });
+    const written = await writeFileIfChanged(join(outputDir, relativePath), content);
+    console.log(written ? `  📝 ${relativePath}` : `  ✔️  ${relativePath} (unchanged)`);
+  }
 
-    // Write file
-    await writeFile(fullPath, content, 'utf-8');
-    console.log(`  📝 ${relativePath}`);
+  // Shards of an earlier run with a different shard count would still be
+  // picked up by the src/*.cpp glob
+  for (const name of await readdir(join(outputDir, 'src'))) {
+    if (/^binding_shard_\d+\.cpp$|^binding(_shards)?\.h$/.test(name) && !(`src/${name}` in files)) {
+      await unlink(join(outputDir, 'src', name));
+      console.log(`  🗑️  src/${name}`);
+    }
   }
 }
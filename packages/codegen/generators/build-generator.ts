@@ -1,4 +1,5 @@
 import type { GeneratorOptions } from '../types.ts';
+import { buildProfileLines } from './build-profile.ts';
 
 export class BuildGenerator {
   private options: GeneratorOptions;
@@ -10,7 +11,7 @@ export class BuildGenerator {
   generateCMakeLists(): string {
     const lines: string[] = [];
 
-    lines.push('cmake_minimum_required(VERSION 3.15)');
+    lines.push(`cmake_minimum_required(VERSION ${this.cmakeMinimumVersion()})`);
     lines.push('cmake_policy(SET CMP0091 NEW)');
     lines.push('cmake_policy(SET CMP0042 NEW)');
     lines.push('');
@@ -31,7 +32,9 @@ export class BuildGenerator {
     }
 
     // Add source files
-    lines.push('file(GLOB SOURCE_FILES "src/*.cpp" "src/*.cc")');
+    // CONFIGURE_DEPENDS re-globs on every build, so shards added by a
+    // regeneration are compiled without a fresh configure
+    lines.push('file(GLOB SOURCE_FILES CONFIGURE_DEPENDS "src/*.cpp" "src/*.cc")');
     lines.push('');
     lines.push(
       'add_library(${PROJECT_NAME} SHARED ${SOURCE_FILES} ${CMAKE_JS_SRC})',
@@ -127,6 +130,20 @@ export class BuildGenerator {
     lines.push('# define NAPI_CPP_EXCEPTIONS to disable exceptions');
     lines.push('add_definitions(-DNAPI_DISABLE_CPP_EXCEPTIONS)');
 
+    if (this.options.precompileHeaders) {
+      lines.push('');
+      lines.push(...this.generatePrecompiledHeaders());
+    }
+    if ((this.options.unityBatchSize ?? 0) > 0) {
+      lines.push('');
+      lines.push(...this.generateUnityBuild(this.options.unityBatchSize!));
+    }
+
+    if (this.options.buildProfile) {
+      lines.push('');
+      lines.push(...buildProfileLines(this.options.buildProfile));
+    }
+
     // Add compiler definitions
     if (this.options.defines?.length) {
       lines.push('');
@@ -139,6 +156,53 @@ export class BuildGenerator {
     return lines.join('\n');
   }
 
+  private cmakeMinimumVersion(): string {
+    // check_linker_flag
+    if (this.options.buildProfile === 'size') {
+      return '3.18';
+    }
+    // target_precompile_headers and UNITY_BUILD
+    if (this.options.precompileHeaders || (this.options.unityBatchSize ?? 0) > 0) {
+      return '3.16';
+    }
+    return '3.15';
+  }
+
+  // node-addon-api and the bound library's headers are parsed once instead of
+  // in every translation unit
+  private generatePrecompiledHeaders(): string[] {
+    const libraryHeaders = this.options.headerIncludePaths?.length
+      ? this.options.headerIncludePaths
+      : this.options.headerIncludePath
+        ? [this.options.headerIncludePath]
+        : [];
+    // The standard headers CppGenerator.generateHeaders always includes
+    const standardHeaders = ['string', 'vector', 'memory', 'cstring', 'algorithm', 'type_traits', 'tuple', 'utility'];
+    const headers = ['napi.h', ...standardHeaders, ...libraryHeaders];
+    return [
+      '# Precompiled headers (node-addon-api and the library headers)',
+      'target_precompile_headers(${PROJECT_NAME} PRIVATE',
+      ...headers.map((header) => `  <${header}>`),
+      ')',
+    ];
+  }
+
+  // Generated sources (src/binding*.cpp) are compiled in batches of
+  // batchSize; hand-written extensions keep their own translation unit, since
+  // their anonymous namespaces may define the same names
+  private generateUnityBuild(batchSize: number): string[] {
+    return [
+      '# Unity build of the generated sources',
+      `set_target_properties(\${PROJECT_NAME} PROPERTIES UNITY_BUILD ON UNITY_BUILD_BATCH_SIZE ${batchSize})`,
+      'foreach(source ${SOURCE_FILES} ${CMAKE_JS_SRC})',
+      '  get_filename_component(source_name ${source} NAME)',
+      '  if(NOT source_name MATCHES "^binding")',
+      '    set_source_files_properties(${source} PROPERTIES SKIP_UNITY_BUILD_INCLUSION ON)',
+      '  endif()',
+      'endforeach()',
+    ];
+  }
+
   generatePackageJson(): string {
     const pkg = {
       name: this.options.packageName,
@@ -0,0 +1,51 @@
+import type { BuildProfile } from '../types.ts';
+
+/**
+ * CMake lines applying a release build profile to ${PROJECT_NAME}: 'speed'
+ * adds -O3 and LTO, 'size' -Os, section GC and identical code folding. Also
+ * used by binding-gen's builder.
+ *
+ * Only NODE_API_MODULE's registration function is exported (napi marks it
+ * visibility("default")), so hidden visibility lets the compiler and linker
+ * treat every wrapper as internal.
+ */
+export function buildProfileLines(profile: BuildProfile): string[] {
+  const lines = [
+    `# Build profile: ${profile}`,
+    'set_target_properties(${PROJECT_NAME} PROPERTIES CXX_VISIBILITY_PRESET hidden VISIBILITY_INLINES_HIDDEN ON)',
+  ];
+  if (profile === 'speed') {
+    lines.push(
+      'include(CheckIPOSupported)',
+      'check_ipo_supported(RESULT IPO_SUPPORTED LANGUAGES CXX)',
+      'if(IPO_SUPPORTED)',
+      '  set_target_properties(${PROJECT_NAME} PROPERTIES INTERPROCEDURAL_OPTIMIZATION ON)',
+      'endif()',
+      'if(MSVC)',
+      '  target_compile_options(${PROJECT_NAME} PRIVATE /O2)',
+      'else()',
+      '  target_compile_options(${PROJECT_NAME} PRIVATE -O3)',
+      'endif()',
+    );
+  } else {
+    lines.push(
+      'include(CheckLinkerFlag)',
+      'if(MSVC)',
+      '  target_compile_options(${PROJECT_NAME} PRIVATE /O1 /Gy /Gw)',
+      '  target_link_options(${PROJECT_NAME} PRIVATE /OPT:REF /OPT:ICF)',
+      'elseif(APPLE)',
+      '  target_compile_options(${PROJECT_NAME} PRIVATE -Os)',
+      '  target_link_options(${PROJECT_NAME} PRIVATE -Wl,-dead_strip)',
+      'else()',
+      '  target_compile_options(${PROJECT_NAME} PRIVATE -Os -ffunction-sections -fdata-sections)',
+      '  target_link_options(${PROJECT_NAME} PRIVATE -Wl,--gc-sections)',
+      '  # Identical code folding needs gold or lld',
+      '  check_linker_flag(CXX -Wl,--icf=all HAVE_ICF)',
+      '  if(HAVE_ICF)',
+      '    target_link_options(${PROJECT_NAME} PRIVATE -Wl,--icf=all)',
+      '  endif()',
+      'endif()',
+    );
+  }
+  return lines;
+}
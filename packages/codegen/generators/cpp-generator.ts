@@ -1,5 +1,51 @@
-import type { HeaderAST } from '../h-parser/types.ts';
+import { hashContent } from '../cache.ts';
+import type { HeaderAST, StructField } from '../h-parser/types.ts';
 import { TypeMapper } from '../type-mapper.ts';
+import type { CallbackMode, CallbackSignature } from '../types.ts';
+
+// Generated code for one struct or function, kept apart so it can be placed
+// in any shard
+interface WrapperUnit {
+  name: string;
+  lines: string[];
+}
+
+// Sections of the generated binding, before they are laid out in one file or
+// in shards
+interface GeneratedSections {
+  headers: string;
+  // Helpers, view and lifetime helpers, wrap<&fn> templates
+  helpers: string[];
+  enums?: string;
+  // POD struct marshalers, callback helpers and trampolines
+  marshalers: string[];
+  structs?: WrapperUnit[];
+  templateTypeNames: string[];
+  functions?: WrapperUnit[];
+  manyHelpers?: string;
+  many?: WrapperUnit[];
+}
+
+// One napi_property_descriptor initializer; unit is the struct or function it
+// exports, undefined for enum exports
+interface ExportDescriptor {
+  unit?: string;
+  descriptor: string;
+}
+
+// Stable shard of a declaration (FNV-1a of its name)
+function shardIndex(name: string, count: number): number {
+  let hash = 0x811c9dc5;
+  for (let i = 0; i < name.length; i++) {
+    hash ^= name.charCodeAt(i);
+    hash = Math.imul(hash, 0x01000193);
+  }
+  return (hash >>> 0) % count;
+}
+
+function joinUnits(title: string, units: WrapperUnit[], prelude: string[] = []): string {
+  return [title, ...prelude, ...units.flatMap((unit) => unit.lines)].join('\n');
+}
 
 export class CppGenerator {
   private includes: Set<string> = new Set();
@@ -7,25 +53,193 @@ export class CppGenerator {
   private libraryName: string;
   private headerIncludePath: string | undefined;
   private headerIncludePaths: string[] = [];
-  private generatedConstants: Set<string> = new Set();
   private generatedFunctions: Set<string> = new Set();
   private generatedStructs: Set<string> = new Set();
+  private nativeExtensions: string[] = [];
+  // Enum constant name -> address of its BindingEnumConstant table entry
+  private enumConstantRefs: Map<string, string> = new Map();
+  // Named enums that get a lazily created object export
+  private enumTables: Array<{ name: string; table: string }> = [];
+  // Structs/unions backed by an ArrayBuffer ('*' for all)
+  private structViews: string[] = [];
+  // Scalar functions that get an fn_many companion ('*' for all eligible)
+  private manyFunctions: string[] = [];
+  private manyWrappers: HeaderAST['functions'] = [];
+  // Functions exported through the generic wrap<&fn> template, and the type
+  // names (by record) their wrapped struct results carry
+  private templateWrapped: Set<string> = new Set();
+  private templateTypeNames: Map<string, string> = new Map();
+  // Callback typedef modes, and the typedefs some wrapper takes a JS function for
+  private callbacks: Array<{ ctype: string; mode?: CallbackMode }> = [];
+  private usedCallbacks: Map<string, CallbackSignature> = new Map();
+  // Owner/child handle rules; with them or with dispose functions, handles
+  // get [Symbol.dispose] and pin their owner
+  private ownership: Array<{ owner: string; child: string }> = [];
+  private hasLifetimes = false;
+  // Function wrapper text from a previous run (see cache.ts), keyed by a hash
+  // of the declaration and wrapperContext; usedWrappers is what this run
+  // emitted, to be saved for the next one
+  private wrapperCache: ReadonlyMap<string, string> | undefined;
+  private wrapperContext = '';
+  private usedWrappers: Map<string, string> = new Map();
+  private wrapperStats = { reused: 0, generated: 0 };
 
   constructor(
     ast: HeaderAST,
     libraryName: string = 'binding',
     headerIncludePath?: string,
     headerIncludePaths?: string[],
+    nativeExtensions?: string[],
+    structViews?: string[],
+    manyFunctions?: string[],
+    callbacks?: Array<{ ctype: string; mode?: CallbackMode }>,
+    ownership?: Array<{ owner: string; child: string }>,
+    wrapperCache?: ReadonlyMap<string, string>,
   ) {
     this.ast = ast;
     this.libraryName = libraryName;
     this.headerIncludePath = headerIncludePath || undefined;
     this.headerIncludePaths = headerIncludePaths || [];
+    this.nativeExtensions = nativeExtensions || [];
+    this.structViews = structViews || [];
+    this.manyFunctions = manyFunctions || [];
+    this.callbacks = callbacks || [];
+    this.ownership = ownership || [];
+    this.wrapperCache = wrapperCache;
+  }
+
+  // Wrappers emitted by the last generate() call, by cache key
+  getWrapperCache(): ReadonlyMap<string, string> {
+    return this.usedWrappers;
+  }
+
+  getWrapperStats(): { reused: number; generated: number } {
+    return { ...this.wrapperStats };
   }
 
   generate(): string {
-    const sections: string[] = [];
+    const parts = this.generateSections();
+    const sections = [parts.headers, ...parts.helpers];
+    if (parts.enums) {
+      sections.push(parts.enums);
+    }
+    sections.push(...parts.marshalers);
+    if (parts.structs) {
+      sections.push(joinUnits('// Struct wrappers', parts.structs));
+    }
+    if (parts.functions) {
+      sections.push(joinUnits('// Function wrappers', parts.functions, parts.templateTypeNames));
+    }
+    if (parts.manyHelpers && parts.many) {
+      sections.push(parts.manyHelpers);
+      sections.push(joinUnits('// Vectorized function wrappers', parts.many));
+    }
+    sections.push(this.generateModuleInit(this.exportDescriptors()));
+
+    return sections.join('\n\n');
+  }
+
+  /**
+   * The binding split over `count` translation units that compile in
+   * parallel: src/binding.h holds the helpers every shard needs,
+   * src/binding_shard_<k>.cpp the struct and function wrappers whose name
+   * hashes to k along with their export descriptors, and src/binding.cpp the
+   * enum tables and an Init that collects the shards' exports through
+   * src/binding_shards.h. A declaration keeps its shard as others are added or
+   * removed, so an edit to the header recompiles few shards.
+   */
+  generateShards(count: number): Record<string, string> {
+    const parts = this.generateSections();
+    const shardOf = (name: string) => shardIndex(name, count);
+
+    // Shared helpers become inline so that every shard links to one copy (and
+    // callback state such as <Typedef>_current is shared)
+    const shared = [
+      parts.headers,
+      ...parts.helpers,
+      ...parts.marshalers,
+      ...(parts.templateTypeNames.length > 0 ? [parts.templateTypeNames.join('\n')] : []),
+      ...(parts.manyHelpers ? [parts.manyHelpers] : []),
+    ].join('\n\n');
+    const files: Record<string, string> = {
+      'src/binding.h': [
+        '// Helpers shared by binding.cpp and its shards',
+        '#pragma once',
+        '',
+        shared.replace(/^static /gm, 'inline '),
+        '',
+      ].join('\n'),
+    };
+
+    const tableName = (k: number) => `bindingShard${k}Exports`;
+    const registry = [
+      '// Export tables of the binding shards, collected by Init in binding.cpp',
+      '#pragma once',
+      '',
+      '#include <node_api.h>',
+      '#include <cstddef>',
+      '',
+      'struct BindingExportTable {',
+      '    const napi_property_descriptor* descriptors;',
+      '    size_t count;',
+      '};',
+      '',
+    ];
+    for (let k = 0; k < count; k++) {
+      registry.push(`BindingExportTable ${tableName(k)}();`);
+    }
+    registry.push('');
+    files['src/binding_shards.h'] = registry.join('\n');
+
+    const descriptors = this.exportDescriptors();
+    for (let k = 0; k < count; k++) {
+      const inShard = (unit: WrapperUnit) => shardOf(unit.name) === k;
+      const sections = [`// Binding shard ${k + 1} of ${count} (see binding.cpp)`, '#include "binding.h"\n#include "binding_shards.h"'];
+      const structs = parts.structs?.filter(inShard) ?? [];
+      if (structs.length > 0) {
+        sections.push(joinUnits('// Struct wrappers', structs));
+      }
+      const functions = parts.functions?.filter(inShard) ?? [];
+      if (functions.length > 0) {
+        sections.push(joinUnits('// Function wrappers', functions));
+      }
+      const many = parts.many?.filter(inShard) ?? [];
+      if (many.length > 0) {
+        sections.push(joinUnits('// Vectorized function wrappers', many));
+      }
+
+      const table = descriptors.filter((entry) => entry.unit !== undefined && shardOf(entry.unit) === k);
+      const lines = [`BindingExportTable ${tableName(k)}() {`];
+      if (table.length > 0) {
+        lines.push(`    static const napi_property_descriptor kExports[] = {`);
+        lines.push(...table.map((entry) => entry.descriptor));
+        lines.push(`    };`);
+        lines.push(`    return {kExports, sizeof(kExports) / sizeof(kExports[0])};`);
+      } else {
+        lines.push(`    return {nullptr, 0};`);
+      }
+      lines.push(`}`);
+      lines.push('');
+      sections.push(lines.join('\n'));
+      files[`src/binding_shard_${k}.cpp`] = sections.join('\n\n');
+    }
+
+    const main = ['#include "binding.h"\n#include "binding_shards.h"'];
+    if (parts.enums) {
+      main.push(parts.enums);
+    }
+    main.push(
+      this.generateModuleInit(
+        descriptors.filter((entry) => entry.unit === undefined),
+        Array.from({ length: count }, (_, k) => tableName(k)),
+      ),
+    );
+    files['src/binding.cpp'] = main.join('\n\n');
+
+    return files;
+  }
 
+  private generateSections(): GeneratedSections {
     // Create stable, sorted views of AST for deterministic output
     const sortedEnums = [...this.ast.enums].sort((a, b) => (a.name || '').localeCompare(b.name || ''));
     const sortedStructs = [...this.ast.structs].sort((a, b) => (a.name || '').localeCompare(b.name || ''));
@@ -44,31 +258,103 @@ export class CppGenerator {
     const enumNames = sortedEnums.map(e => e.name).filter(n => n);
     TypeMapper.setEnumTypes(enumNames);
 
-    // Headers
-    sections.push(this.generateHeaders());
+    // libclang's descriptions of the types in signatures, fields and
+    // typedefs, when the parser recorded them
+    TypeMapper.setTypeDescriptors(this.ast);
+
+    // View-backed records, then small POD structs marshaled by value (both
+    // need typedefs and enums)
+    const namedStructs = sortedStructs.flatMap((struct) => {
+      const name = this.structTypeName(struct);
+      return name ? [{ ...struct, name }] : [];
+    });
+    TypeMapper.setViewStructTypes(namedStructs, this.structViews);
+    TypeMapper.setPodStructTypes(namedStructs);
+
+    // Function-pointer typedefs that take JS functions through a trampoline
+    TypeMapper.setCallbackTypes(this.callbacks);
+    this.usedCallbacks = new Map();
+    for (const func of sortedFunctions) {
+      for (const { signature } of TypeMapper.getCallbackParams(func.params).values()) {
+        this.usedCallbacks.set(signature.name, signature);
+      }
+    }
+
+    // Handle lifetimes: dispose functions and owner/child links
+    TypeMapper.setDisposers(sortedFunctions);
+    TypeMapper.setOwnership(this.ownership);
+    this.hasLifetimes = TypeMapper.getDisposers().size > 0 || this.ownership.length > 0;
+
+    // Everything besides its own declaration that a function wrapper's text
+    // depends on
+    this.wrapperContext = hashContent(
+      JSON.stringify(sortedStructs),
+      JSON.stringify(this.ast.typedefs || []),
+      JSON.stringify(enumNames),
+      JSON.stringify(this.structViews),
+      JSON.stringify([...this.usedCallbacks.values()]),
+      JSON.stringify(this.ownership),
+      JSON.stringify([...TypeMapper.getDisposers()]),
+    );
+    this.usedWrappers = new Map();
+    this.wrapperStats = { reused: 0, generated: 0 };
+
+    const parts: GeneratedSections = {
+      headers: this.generateHeaders(),
+      helpers: [this.generateHelpers()],
+      marshalers: [],
+      templateTypeNames: [],
+    };
 
     // Helper functions
-    sections.push(this.generateHelpers());
+    if (TypeMapper.getViewStructTypes().size > 0) {
+      parts.helpers.push(this.generateViewHelpers());
+    }
+    if (this.hasLifetimes) {
+      parts.helpers.push(this.generateLifetimeHelpers());
+    }
+
+    // Functions whose signature the generic wrap<&fn> template handles
+    this.selectTemplateFunctions(sortedFunctions);
+    if (this.templateWrapped.size > 0) {
+      parts.helpers.push(this.generateWrapTemplates());
+    }
 
-    // Enum constants
+    // Enum tables
     if (sortedEnums.length > 0) {
-      sections.push(this.generateEnumConstants(sortedEnums));
+      parts.enums = this.generateEnumTables(sortedEnums);
+    }
+
+    // By-value struct conversions, used by struct and function wrappers
+    if (TypeMapper.getPodStructTypes().size > 0) {
+      parts.marshalers.push(this.generatePodMarshalers());
+    }
+
+    // Callback trampolines
+    if (this.usedCallbacks.size > 0) {
+      parts.marshalers.push(this.generateCallbackHelpers());
+      parts.marshalers.push(this.generateCallbackTrampolines([...this.usedCallbacks.values()]));
     }
 
     // Struct wrappers
     if (sortedStructs.length > 0) {
-      sections.push(this.generateStructWrappers(sortedStructs));
+      parts.structs = this.generateStructWrappers(sortedStructs);
     }
 
     // Function wrappers
     if (sortedFunctions.length) {
-      sections.push(this.generateFunctionWrappers(sortedFunctions));
+      parts.functions = this.generateFunctionWrappers(sortedFunctions);
+      parts.templateTypeNames = this.generateTemplateTypeNames();
     }
 
-    // Module initialization
-    sections.push(this.generateModuleInit());
+    // Vectorized fn_many companions of scalar functions
+    this.manyWrappers = TypeMapper.selectManyFunctions(sortedFunctions, this.manyFunctions);
+    if (this.manyWrappers.length > 0) {
+      parts.manyHelpers = this.generateManyHelpers();
+      parts.many = this.generateManyWrappers(this.manyWrappers);
+    }
 
-    return sections.join('\n\n');
+    return parts;
   }
 
   private generateHeaders(): string {
@@ -79,7 +365,18 @@ export class CppGenerator {
       '#include <vector>',
       '#include <memory>',
       '#include <cstring>',  // for strncpy
+      '#include <algorithm>',
+      '#include <type_traits>',
+      '#include <tuple>',
+      '#include <utility>',
     ];
+    if (this.usedCallbacks.size > 0) {
+      // Threadsafe callbacks block the calling thread until JS has run
+      headers.push('#include <thread>', '#include <mutex>', '#include <condition_variable>', '#include <functional>');
+    }
+    if (this.hasLifetimes) {
+      headers.push('#include <atomic>');
+    }
 
     // Include headers from multiple header paths if available
     if (this.headerIncludePaths.length > 0) {
@@ -102,6 +399,17 @@ export class CppGenerator {
     return headers.join('\n');
   }
 
+  // C type name of a struct; anonymous structs go by their typedef name
+  private structTypeName(struct: HeaderAST['structs'][number]): string | undefined {
+    if (!struct.name || struct.name.endsWith('Impl') || struct.fields.length === 0) {
+      return undefined;
+    }
+    if (struct.name.includes('(unnamed at ') || struct.name.includes('__') || struct.name.includes('/')) {
+      return this.ast.typedefs?.find(t => t.underlying === struct.name || t.spelling === struct.name)?.name;
+    }
+    return struct.name;
+  }
+
   private formatComment(comment: string): string {
     // Split comment into lines and ensure each line starts with //
     return comment
@@ -141,6 +449,100 @@ static void* unwrapPointer(Napi::Object obj) {
     return obj.Get("_ptr").As<Napi::External<void>>().Data();
 }
 
+// Raw argument conversions: napi_get_value_* report a value of the wrong type
+// through their status, which becomes a TypeError and a false return. A
+// negative number for an unsigned 64-bit type is a RangeError.
+static bool argTypeError(napi_env env, const char* message) {
+    napi_throw_type_error(env, nullptr, message);
+    return false;
+}
+
+static bool argRangeError(napi_env env, const char* message) {
+    napi_throw_range_error(env, nullptr, message);
+    return false;
+}
+
+template <typename T>
+static bool fromNapi(napi_env env, napi_value value, T* out) {
+    static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "fromNapi needs a number, bool or enum");
+    if constexpr (std::is_same_v<T, bool>) {
+        return napi_get_value_bool(env, value, out) == napi_ok || argTypeError(env, "Expected a boolean");
+    } else if constexpr (std::is_same_v<T, long long> || std::is_same_v<T, unsigned long long>) {
+        bool lossless;
+        napi_status status;
+        if constexpr (std::is_signed_v<T>) {
+            int64_t number;
+            status = napi_get_value_bigint_int64(env, value, &number, &lossless);
+            *out = static_cast<T>(number);
+        } else {
+            uint64_t number;
+            status = napi_get_value_bigint_uint64(env, value, &number, &lossless);
+            *out = static_cast<T>(number);
+            int sign = 0;
+            size_t count = 1;
+            uint64_t word;
+            if (status == napi_ok && !lossless &&
+                napi_get_value_bigint_words(env, value, &sign, &count, &word) == napi_ok && sign != 0) {
+                return argRangeError(env, "Expected a non-negative bigint");
+            }
+        }
+        return status == napi_ok || argTypeError(env, "Expected a bigint");
+    } else if constexpr (std::is_floating_point_v<T>) {
+        double number;
+        if (napi_get_value_double(env, value, &number) != napi_ok) {
+            return argTypeError(env, "Expected a number");
+        }
+        *out = static_cast<T>(number);
+        return true;
+    } else if constexpr (std::is_enum_v<T> || (std::is_signed_v<T> && sizeof(T) <= 4)) {
+        int32_t number;
+        if (napi_get_value_int32(env, value, &number) != napi_ok) {
+            return argTypeError(env, "Expected a number");
+        }
+        *out = static_cast<T>(number);
+        return true;
+    } else if constexpr (sizeof(T) <= 4) {
+        uint32_t number;
+        if (napi_get_value_uint32(env, value, &number) != napi_ok) {
+            return argTypeError(env, "Expected a number");
+        }
+        *out = static_cast<T>(number);
+        return true;
+    } else {
+        int64_t number;
+        if (napi_get_value_int64(env, value, &number) != napi_ok) {
+            return argTypeError(env, "Expected a number");
+        }
+        if (std::is_unsigned_v<T> && number < 0) {
+            return argRangeError(env, "Expected a non-negative number");
+        }
+        *out = static_cast<T>(number);
+        return true;
+    }
+}
+
+static bool fromNapi(napi_env env, napi_value value, std::string* out) {
+    size_t length;
+    if (napi_get_value_string_utf8(env, value, nullptr, 0, &length) != napi_ok) {
+        return argTypeError(env, "Expected a string");
+    }
+    out->resize(length);
+    napi_get_value_string_utf8(env, value, out->data(), length + 1, &length);
+    return true;
+}
+
+// Like unwrapPointer, but rejects anything that is not a wrapped pointer
+static bool unwrapArg(napi_env env, napi_value value, void** out) {
+    napi_valuetype type;
+    napi_value ptr;
+    if (napi_typeof(env, value, &type) != napi_ok || type != napi_object ||
+        napi_get_named_property(env, value, "_ptr", &ptr) != napi_ok ||
+        napi_get_value_external(env, ptr, out) != napi_ok) {
+        return argTypeError(env, "Expected a wrapped pointer");
+    }
+    return true;
+}
+
 // Helper to wrap owned pointers with a finalizer
 template <typename T>
 static Napi::Object wrapOwnedPointer(Napi::Env env, T* ptr, const std::string& typeName) {
@@ -151,556 +553,1910 @@ static Napi::Object wrapOwnedPointer(Napi::Env env, T* ptr, const std::string& t
     obj.Set("_ptr", ext);
     obj.Set("_type", Napi::String::New(env, typeName));
     return obj;
-}`;
-  }
+}
 
-  private generateEnumConstants(sortedEnums: HeaderAST['enums']): string {
-    const lines: string[] = ['// Enum constants'];
+// Adapts a wrapper to a plain napi_callback so Init can register every export
+// with a single napi_define_properties call
+template <Napi::Value (*Fn)(const Napi::CallbackInfo&)>
+static napi_value napiCallback(napi_env env, napi_callback_info info) {
+    Napi::CallbackInfo callbackInfo(env, info);
+    return Fn(callbackInfo);
+}
 
-    for (const enumDef of sortedEnums) {
-      if (enumDef.documentation) {
-        lines.push(this.formatComment(enumDef.documentation));
-      }
-      lines.push(`// enum ${enumDef.name}`);
-      const sortedConstants = [...enumDef.constants].sort((a, b) => a.name.localeCompare(b.name));
-      for (const constant of sortedConstants) {
-        const safeName = TypeMapper.sanitizeIdentifier(constant.name);
-        const functionName = `Get_${safeName}`;
+// Enum tables backing the enum exports and enumName()
+struct BindingEnumConstant {
+    const char* name;
+    int64_t value;
+};
 
-        // Skip if we've already generated this constant
-        if (this.generatedConstants.has(functionName)) {
-          continue;
-        }
-        this.generatedConstants.add(functionName);
+struct BindingEnumTable {
+    const char* name;
+    const BindingEnumConstant* constants;
+    size_t count;
+};
 
-        if (constant.documentation) {
-          lines.push(this.formatComment(constant.documentation));
-        }
-        lines.push(
-          `static Napi::Value ${functionName}(const Napi::CallbackInfo& info) {`,
-        );
-        lines.push(
-          `    return Napi::Number::New(info.Env(), ${constant.name});`,
-        );
-        lines.push(`}`);
-        lines.push('');
-      }
-    }
+static constexpr napi_property_attributes kLazyExport =
+    static_cast<napi_property_attributes>(napi_enumerable | napi_configurable);
 
-    return lines.join('\n');
-  }
+static constexpr void* exportData(const void* ptr) {
+    return const_cast<void*>(ptr);
+}
 
-  private generateStructWrappers(sortedStructs: HeaderAST['structs']): string {
-    const lines: string[] = ['// Struct wrappers'];
+// Replaces a lazy accessor on the receiver with a plain data property, so the
+// getter only runs on first access
+static napi_value materializeExport(napi_env env, napi_value self, const char* name, napi_value value) {
+    napi_property_descriptor desc = {
+        name, nullptr, nullptr, nullptr, nullptr, value, napi_default_jsproperty, nullptr};
+    napi_define_properties(env, self, 1, &desc);
+    return value;
+}
 
-    for (const struct of sortedStructs) {
-      if (!struct.name) continue;
+static napi_value getEnumConstant(napi_env env, napi_callback_info info) {
+    napi_value self;
+    void* data;
+    napi_get_cb_info(env, info, nullptr, nullptr, &self, &data);
+    const auto* constant = static_cast<const BindingEnumConstant*>(data);
+    napi_value value;
+    napi_create_int64(env, constant->value, &value);
+    return materializeExport(env, self, constant->name, value);
+}
 
-      // Skip opaque pointer types (ending with Impl or that are forward declarations)
-      if (struct.name.endsWith('Impl') || struct.fields.length === 0) {
-        continue;
-      }
+// Builds the frozen { NAME: value } object for a whole enum
+static napi_value getEnumObject(napi_env env, napi_callback_info info) {
+    napi_value self;
+    void* data;
+    napi_get_cb_info(env, info, nullptr, nullptr, &self, &data);
+    const auto* table = static_cast<const BindingEnumTable*>(data);
+    std::vector<napi_property_descriptor> props(table->count);
+    for (size_t i = 0; i < table->count; i++) {
+        napi_value value;
+        napi_create_int64(env, table->constants[i].value, &value);
+        props[i] = {table->constants[i].name, nullptr, nullptr, nullptr, nullptr, value, napi_enumerable, nullptr};
+    }
+    napi_value object;
+    napi_create_object(env, &object);
+    napi_define_properties(env, object, props.size(), props.data());
+    napi_object_freeze(env, object);
+    return materializeExport(env, self, table->name, object);
+}
 
-      // Handle anonymous structs with better naming
-      let structName = struct.name;
-      let actualTypeName = struct.name;
-      
-      if (structName.includes('(unnamed at ') || structName.includes('__') || structName.includes('/')) {
-        // Look for a typedef that might reference this struct
-        const typedef = this.ast.typedefs?.find(t => t.underlying === struct.name || t.spelling === struct.name);
-        if (typedef) {
-          actualTypeName = typedef.name;
-          structName = typedef.name;
-        } else {
-          // Use a generic name for function generation, but we can't use the struct
-          structName = `AnonymousStruct_${this.generatedStructs.size}`;
-          // Skip generating this struct since we can't reference it properly
-          continue;
+// Per-struct field tables used by create_<Struct> and get_<Struct>_field
+struct BindingStructField {
+    const char* name;
+    Napi::Value (*get)(Napi::Env env, void* ptr);
+    void (*set)(void* ptr, const Napi::Value& value);
+};
+
+// Copies the fields present in a JS init object into a struct; one property
+// lookup per field
+static void initStructFields(Napi::Object init, void* ptr, const BindingStructField* fields, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        Napi::Value value = init.Get(fields[i].name);
+        if (!value.IsUndefined()) {
+            fields[i].set(ptr, value);
         }
-      }
+    }
+}
 
-      const safeName = TypeMapper.sanitizeIdentifier(structName);
-      const createFunctionName = `Create_${safeName}`;
-      const getFieldFunctionName = `Get_${safeName}_Field`;
+// Reads field info[1] of the struct at ptr: a numeric field index dispatches
+// straight through the table, a field name falls back to a scan
+static Napi::Value readStructField(const Napi::CallbackInfo& info, void* ptr, const BindingStructField* fields, size_t count) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2 || !(info[1].IsNumber() || info[1].IsString())) {
+        Napi::TypeError::New(env, "Expected struct object and field name or index").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    if (info[1].IsNumber()) {
+        uint32_t index = info[1].As<Napi::Number>().Uint32Value();
+        return index < count ? fields[index].get(env, ptr) : env.Undefined();
+    }
+    std::string fieldName = info[1].As<Napi::String>().Utf8Value();
+    for (size_t i = 0; i < count; i++) {
+        if (fieldName == fields[i].name) {
+            return fields[i].get(env, ptr);
+        }
+    }
+    return env.Undefined();
+}
 
-      // Skip if already generated
-      if (this.generatedStructs.has(createFunctionName)) {
-        continue;
-      }
-      this.generatedStructs.add(createFunctionName);
-      this.generatedStructs.add(getFieldFunctionName);
+// get_<Struct>_field(struct, field) for structs behind a wrapped pointer
+static Napi::Value getStructField(const Napi::CallbackInfo& info, const BindingStructField* fields, size_t count) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected struct object and field name or index").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    void* ptr = unwrapPointer(info[0].As<Napi::Object>());
+    if (!ptr) {
+        return env.Undefined();
+    }
+    return readStructField(info, ptr, fields, count);
+}
 
-      if (struct.documentation) {
-        lines.push(this.formatComment(struct.documentation));
-      }
+// get_<Struct>_field(struct, field) for structs passed by value: reads a plain
+// object through a stack copy, and still accepts wrapped pointers (e.g. from
+// pointer fields)
+template <typename T, bool (*FromValue)(const Napi::Value&, T*)>
+static Napi::Value getValueStructField(const Napi::CallbackInfo& info, const BindingStructField* fields, size_t count) {
+    if (info.Length() > 0 && info[0].IsObject() && !info[0].As<Napi::Object>().Has("_ptr")) {
+        T value{};
+        FromValue(info[0], &value);
+        return readStructField(info, &value, fields, count);
+    }
+    return getStructField(info, fields, count);
+}
 
-      // Create struct wrapper
-      lines.push(
-        `static Napi::Value ${createFunctionName}(const Napi::CallbackInfo& info) {`,
-      );
-      lines.push(`    Napi::Env env = info.Env();`);
-      lines.push(`    `);
-      lines.push(`    // Allocate struct`);
-      lines.push(`    ${actualTypeName}* ptr = new ${actualTypeName}();`);
-      lines.push(`    `);
-      lines.push(`    // Initialize from JavaScript object if provided`);
-      lines.push(`    if (info.Length() > 0 && info[0].IsObject()) {`);
-      lines.push(`        Napi::Object obj = info[0].As<Napi::Object>();`);
+// TypedArray element type for a C element type T
+template <typename T>
+static constexpr napi_typedarray_type typedArrayType() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return sizeof(T) == 4 ? napi_float32_array : napi_float64_array;
+    } else if constexpr (sizeof(T) == 1) {
+        return std::is_signed_v<T> ? napi_int8_array : napi_uint8_array;
+    } else if constexpr (sizeof(T) == 2) {
+        return std::is_signed_v<T> ? napi_int16_array : napi_uint16_array;
+    } else if constexpr (sizeof(T) == 4) {
+        return std::is_signed_v<T> ? napi_int32_array : napi_uint32_array;
+    } else {
+        return std::is_signed_v<T> ? napi_bigint64_array : napi_biguint64_array;
+    }
+}
 
-      for (const field of struct.fields) {
-        // Skip fields with empty names (anonymous union members)
-        if (!field.name || field.name.trim() === '') {
-          continue;
-        }
-        
-        lines.push(`        if (obj.Has("${field.name}")) {`);
-
-        // Handle different field types appropriately
-        if (TypeMapper.isArrayType(field.type)) {
-          // Handle arrays specially
-          const elementType = TypeMapper.getArrayElementType(field.type);
-          if (elementType === 'char') {
-            // String arrays - copy as C strings
-            lines.push(`            std::string ${field.name}_str = obj.Get("${field.name}").As<Napi::String>().Utf8Value();`);
-            lines.push(`            strncpy(ptr->${field.name}, ${field.name}_str.c_str(), sizeof(ptr->${field.name}) - 1);`);
-            lines.push(`            ptr->${field.name}[sizeof(ptr->${field.name}) - 1] = '\\0';`);
-          } else {
-            // Numeric arrays - copy from JS array
-            lines.push(`            Napi::Array ${field.name}_arr = obj.Get("${field.name}").As<Napi::Array>();`);
-            lines.push(`            for (size_t i = 0; i < ${field.name}_arr.Length() && i < sizeof(ptr->${field.name})/sizeof(ptr->${field.name}[0]); i++) {`);
-            if (elementType === 'void *' || elementType === 'const void *') {
-              lines.push(`                if (${field.name}_arr.Get(i).IsExternal()) {`);
-              lines.push(`                    ptr->${field.name}[i] = ${field.name}_arr.Get(i).As<Napi::External<void>>().Data();`);
-              lines.push(`                } else {`);
-              lines.push(`                    ptr->${field.name}[i] = nullptr;`);
-              lines.push(`                }`);
-            } else {
-              lines.push(`                ptr->${field.name}[i] = ${TypeMapper.getNapiToC(`${field.name}_arr.Get(i)`, elementType)};`);
-            }
-            lines.push(`            }`);
-          }
-        } else if (TypeMapper.isStructType(field.type)) {
-          // Handle nested structs - unwrap pointer and copy struct
-          lines.push(`            ${field.type}* ${field.name}_ptr = static_cast<${field.type}*>(unwrapPointer(obj.Get("${field.name}").As<Napi::Object>()));`);
-          lines.push(`            if (${field.name}_ptr) {`);
-          lines.push(`                ptr->${field.name} = *${field.name}_ptr;`);
-          lines.push(`            }`);
-        } else if (TypeMapper.isEnumType(field.type)) {
-          // Handle enum types with explicit casting
-          lines.push(`            ptr->${field.name} = static_cast<${field.type}>(obj.Get("${field.name}").As<Napi::Number>().Int32Value());`);
-        } else if (TypeMapper.isFunctionPointerType(field.type)) {
-          // Handle function pointer fields - they can be passed as External
-          lines.push(`            if (obj.Get("${field.name}").IsExternal()) {`);
-          lines.push(`                ptr->${field.name} = reinterpret_cast<${field.type}>(obj.Get("${field.name}").As<Napi::External<void>>().Data());`);
-          lines.push(`            } else {`);
-          lines.push(`                ptr->${field.name} = nullptr;`);
-          lines.push(`            }`);
-        } else if (TypeMapper.isStringType(field.type)) {
-          // Special handling for string fields - store the string and keep it alive
-          lines.push(`            // Note: String lifetime management needed for production use`);
-          lines.push(`            std::string ${field.name}_str = obj.Get("${field.name}").As<Napi::String>().Utf8Value();`);
-          lines.push(`            ptr->${field.name} = ${field.name}_str.c_str();`);
-        } else if (field.type === 'void *' || field.type === 'void*') {
-          // Handle void* fields specifically
-          lines.push(`            if (obj.Get("${field.name}").IsExternal()) {`);
-          lines.push(`                ptr->${field.name} = obj.Get("${field.name}").As<Napi::External<void>>().Data();`);
-          lines.push(`            } else {`);
-          lines.push(`                ptr->${field.name} = nullptr;`);
-          lines.push(`            }`);
-        } else if (field.type.includes('*')) {
-          // Handle ALL pointer types (including ones not caught by isPointerType)
-          lines.push(`            if (obj.Get("${field.name}").IsObject()) {`);
-          lines.push(`                ptr->${field.name} = static_cast<${field.type}>(unwrapPointer(obj.Get("${field.name}").As<Napi::Object>()));`);
-          lines.push(`            } else if (obj.Get("${field.name}").IsNull() || obj.Get("${field.name}").IsUndefined()) {`);
-          lines.push(`                ptr->${field.name} = nullptr;`);
-          lines.push(`            } else {`);
-          lines.push(`                // Invalid value for pointer field`);
-          lines.push(`                ptr->${field.name} = nullptr;`);
-          lines.push(`            }`);
-        } else {
-          // Handle regular types (non-pointers)
-          const mapping = TypeMapper.getMapping(field.type);
-          if (mapping.needsConversion) {
-            lines.push(
-              `            ptr->${field.name} = ${TypeMapper.getNapiToC(`obj.Get("${field.name}")`, field.type)};`,
-            );
-          } else {
-            lines.push(
-              `            ptr->${field.name} = obj.Get("${field.name}");`,
-            );
-          }
-        }
+// Elements and length of a TypedArray holding T (any byte array when T is one
+// byte wide), or nullptr
+template <typename T>
+static T* typedArrayData(const Napi::Value& value, size_t* length) {
+    if (!value.IsTypedArray()) {
+        return nullptr;
+    }
+    Napi::TypedArray array = value.As<Napi::TypedArray>();
+    if (array.TypedArrayType() != typedArrayType<T>() && !(sizeof(T) == 1 && array.ElementSize() == 1)) {
+        return nullptr;
+    }
+    *length = array.ElementLength();
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset());
+}
 
-        lines.push(`        }`);
-      }
+// Copies a fixed-size array field into a new TypedArray in one memcpy
+template <typename T, size_t N>
+static Napi::Value arrayFieldToTypedArray(Napi::Env env, const T (&field)[N]) {
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, sizeof(field));
+    memcpy(buffer.Data(), field, sizeof(field));
+    napi_value array;
+    napi_create_typedarray(env, typedArrayType<T>(), N, buffer, 0, &array);
+    return Napi::Value(env, array);
+}
 
-      lines.push(`    }`);
-      lines.push(`    `);
-      lines.push(`    return wrapOwnedPointer(env, ptr, "${structName}");`);
-      lines.push(`}`);
-      lines.push('');
+// Copies a TypedArray of the field's element type into a fixed-size array
+// field; false when value is not one
+template <typename T, size_t N>
+static bool typedArrayToArrayField(const Napi::Value& value, T (&field)[N]) {
+    size_t length = 0;
+    const T* data = typedArrayData<T>(value, &length);
+    if (!data) {
+        return false;
+    }
+    memcpy(field, data, std::min(length, N) * sizeof(T));
+    return true;
+}`;
+  }
 
-      // Getter for struct fields
-      lines.push(
-        `static Napi::Value ${getFieldFunctionName}(const Napi::CallbackInfo& info) {`,
-      );
-      lines.push(`    Napi::Env env = info.Env();`);
-      lines.push(`    `);
-      lines.push(
-        `    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsString()) {`,
-      );
-      lines.push(
-        `        Napi::TypeError::New(env, "Expected struct object and field name").ThrowAsJavaScriptException();`,
-      );
-      lines.push(`        return env.Undefined();`);
-      lines.push(`    }`);
-      lines.push(`    `);
-      lines.push(
-        `    ${actualTypeName}* ptr = static_cast<${actualTypeName}*>(unwrapPointer(info[0].As<Napi::Object>()));`,
-      );
-      lines.push(
-        `    std::string fieldName = info[1].As<Napi::String>().Utf8Value();`,
-      );
-      lines.push(`    `);
+  private generateLifetimeHelpers(): string {
+    return `// Handle lifetimes. A handle type with a dispose function frees its native
+// value once, from whichever comes first: [Symbol.dispose] (so \`using\`
+// scopes free it eagerly), an explicit call to the dispose function, or the
+// finalizer of a handle some function returned. The stored value is zeroed
+// after disposal, which turns the others into no-ops.
+template <typename T>
+struct BindingDisposer {
+    static constexpr void (*dispose)(T) = nullptr;
+};
+
+template <typename T, void (*Dispose)(T)>
+static void disposeValue(T* value) {
+    static const unsigned char kCleared[sizeof(T)] = {};
+    if (std::memcmp(value, kCleared, sizeof(T)) != 0) {
+        Dispose(*value);
+        std::memset(static_cast<void*>(value), 0, sizeof(T));
+    }
+}
 
-      for (const field of [...struct.fields].sort((a, b) => (a.name||'').localeCompare(b.name||''))) {
-        // Skip fields with empty names (anonymous union members)
-        if (!field.name || field.name.trim() === '') {
-          continue;
-        }
-        
-        lines.push(`    if (fieldName == "${field.name}") {`);
-        
-        // Handle different field types in getters
-        if (TypeMapper.isArrayType(field.type)) {
-          const elementType = TypeMapper.getArrayElementType(field.type);
-          if (elementType === 'char') {
-            // Return string arrays as strings
-            lines.push(`        return Napi::String::New(env, ptr->${field.name});`);
-          } else {
-            // Return numeric arrays as JS arrays
-            lines.push(`        Napi::Array arr = Napi::Array::New(env);`);
-            lines.push(`        size_t arraySize = sizeof(ptr->${field.name})/sizeof(ptr->${field.name}[0]);`);
-            lines.push(`        for (size_t i = 0; i < arraySize; i++) {`);
-            if (elementType === 'void *' || elementType === 'const void *') {
-              lines.push(`            arr.Set(i, Napi::External<void>::New(env, const_cast<void*>(ptr->${field.name}[i])));`);
-            } else {
-              lines.push(`            arr.Set(i, ${TypeMapper.getCToNapi(`ptr->${field.name}[i]`, elementType)});`);
+// Per-environment cache of Symbol.dispose and of one dispose method per
+// handle type, filled on first use
+struct BindingInstanceData {
+    napi_ref disposeSymbol = nullptr;
+    bool disposeSymbolChecked = false;
+    std::vector<napi_ref> disposeMethods;
+};
+
+static BindingInstanceData* bindingInstanceData(napi_env env) {
+    void* data = nullptr;
+    napi_get_instance_data(env, &data);
+    if (data == nullptr) {
+        data = new BindingInstanceData();
+        napi_set_instance_data(env, data, [](napi_env env, void* data, void*) {
+            auto* instance = static_cast<BindingInstanceData*>(data);
+            if (instance->disposeSymbol != nullptr) {
+                napi_delete_reference(env, instance->disposeSymbol);
             }
-            lines.push(`        }`);
-            lines.push(`        return arr;`);
-          }
-        } else if (TypeMapper.isStructType(field.type)) {
-          // Return nested structs as new wrapped pointers
-          lines.push(`        ${field.type}* fieldPtr = new ${field.type}(ptr->${field.name});`);
-          lines.push(`        return wrapPointer(env, fieldPtr, "${field.type}");`);
-        } else if (TypeMapper.isFunctionPointerType(field.type)) {
-          // Handle function pointers - return as external pointer
-          lines.push(`        return Napi::External<void>::New(env, reinterpret_cast<void*>(ptr->${field.name}));`);
-        } else if (TypeMapper.isPointerType(field.type) && field.type.includes('const')) {
-          // Handle const pointers specially
-          const baseType = field.type.replace(/\s*\*\s*$/, '').replace(/^const\s+/, '');
-          lines.push(`        return wrapConstPointer(env, ptr->${field.name}, "${baseType}");`);
-        } else if (TypeMapper.isPointerType(field.type)) {
-          // Handle regular pointers
-          const baseType = field.type.replace(/\s*\*\s*$/, '');
-          lines.push(`        return wrapPointer(env, ptr->${field.name}, "${baseType}");`);
-        } else if (TypeMapper.isEnumType(field.type)) {
-          // Handle enum fields - return as number
-          lines.push(`        return Napi::Number::New(env, static_cast<int>(ptr->${field.name}));`);
-        } else {
-          // Handle regular types
-          lines.push(
-            `        return ${TypeMapper.getCToNapi(`ptr->${field.name}`, field.type)};`,
-          );
-        }
-        
-        lines.push(`    }`);
-      }
-
-      lines.push(`    `);
-      lines.push(`    return env.Undefined();`);
-      lines.push(`}`);
-      lines.push('');
+            for (napi_ref method : instance->disposeMethods) {
+                if (method != nullptr) {
+                    napi_delete_reference(env, method);
+                }
+            }
+            delete instance;
+        }, nullptr);
     }
+    return static_cast<BindingInstanceData*>(data);
+}
 
-    return lines.join('\n');
-  }
-
-  private generateFunctionWrappers(sortedFunctions: NonNullable<HeaderAST['functions']>): string {
-    const lines: string[] = ['// Function wrappers'];
+static std::atomic<size_t> nextDisposeSlot{0};
 
-    for (const func of sortedFunctions) {
-      const safeName = TypeMapper.sanitizeIdentifier(func.name);
-      const wrapperName = `${safeName}_wrapper`;
+// handle[Symbol.dispose]()
+template <typename T, void (*Dispose)(T)>
+static napi_value disposeThis(napi_env env, napi_callback_info info) {
+    napi_value self;
+    napi_get_cb_info(env, info, nullptr, nullptr, &self, nullptr);
+    void* wrapped;
+    if (unwrapArg(env, self, &wrapped)) {
+        disposeValue<T, Dispose>(static_cast<T*>(wrapped));
+    }
+    return nullptr;
+}
 
-      // Skip if we've already generated this function
-      if (this.generatedFunctions.has(wrapperName)) {
-        continue;
-      }
-      this.generatedFunctions.add(wrapperName);
+// Export of the dispose function itself, e.g. clang_disposeString(str)
+template <typename T, void (*Dispose)(T)>
+static napi_value disposeArg(napi_env env, napi_callback_info info) {
+    napi_value arg;
+    size_t argc = 1;
+    napi_get_cb_info(env, info, &argc, &arg, nullptr, nullptr);
+    void* wrapped;
+    if (argc < 1) {
+        napi_throw_type_error(env, nullptr, "Expected 1 arguments");
+    } else if (unwrapArg(env, arg, &wrapped)) {
+        disposeValue<T, Dispose>(static_cast<T*>(wrapped));
+    }
+    return nullptr;
+}
 
-      if (func.documentation) {
-        lines.push(this.formatComment(func.documentation));
-      }
+// Wraps a handle a function returned and now owns: the finalizer disposes
+// it unless that already happened, and the object gets [Symbol.dispose]
+template <typename T, void (*Dispose)(T)>
+static napi_value wrapDisposable(napi_env env, T* ptr, const char* typeName) {
+    static const size_t slot = nextDisposeSlot++;
+    napi_value external, object, type;
+    napi_create_external(env, ptr, [](napi_env, void* data, void*) {
+        auto* value = static_cast<T*>(data);
+        disposeValue<T, Dispose>(value);
+        delete value;
+    }, nullptr, &external);
+    napi_create_object(env, &object);
+    napi_set_named_property(env, object, "_ptr", external);
+    napi_create_string_utf8(env, typeName, NAPI_AUTO_LENGTH, &type);
+    napi_set_named_property(env, object, "_type", type);
+
+    BindingInstanceData* instance = bindingInstanceData(env);
+    napi_value symbol, method;
+    if (!instance->disposeSymbolChecked) {
+        // Symbol.dispose is missing before explicit resource management
+        napi_value global, symbolClass;
+        napi_valuetype symbolType;
+        napi_get_global(env, &global);
+        napi_get_named_property(env, global, "Symbol", &symbolClass);
+        napi_get_named_property(env, symbolClass, "dispose", &symbol);
+        if (napi_typeof(env, symbol, &symbolType) == napi_ok && symbolType == napi_symbol) {
+            napi_create_reference(env, symbol, 1, &instance->disposeSymbol);
+        }
+        instance->disposeSymbolChecked = true;
+    }
+    if (instance->disposeSymbol == nullptr) {
+        return object;
+    }
+    napi_get_reference_value(env, instance->disposeSymbol, &symbol);
+    if (instance->disposeMethods.size() <= slot) {
+        instance->disposeMethods.resize(slot + 1, nullptr);
+    }
+    if (instance->disposeMethods[slot] == nullptr) {
+        napi_create_function(env, "dispose", NAPI_AUTO_LENGTH, disposeThis<T, Dispose>, nullptr, &method);
+        napi_create_reference(env, method, 1, &instance->disposeMethods[slot]);
+    }
+    napi_get_reference_value(env, instance->disposeMethods[slot], &method);
+    napi_set_property(env, object, symbol, method);
+    return object;
+}
 
-      lines.push(
-        `static Napi::Value ${wrapperName}(const Napi::CallbackInfo& info) {`,
-      );
-      lines.push(`    Napi::Env env = info.Env();`);
-      lines.push(`    `);
+// The owner a child handle pinned, or nullptr
+static napi_value pinnedOwner(napi_env env, napi_value child) {
+    napi_valuetype type;
+    napi_value owner;
+    if (napi_typeof(env, child, &type) != napi_ok || type != napi_object ||
+        napi_get_named_property(env, child, "_owner", &owner) != napi_ok ||
+        napi_typeof(env, owner, &type) != napi_ok || type != napi_object) {
+        return nullptr;
+    }
+    return owner;
+}
 
-      // Parameter validation
-      if (func.params.length > 0) {
-        lines.push(`    if (info.Length() < ${func.params.length}) {`);
+// Child handles keep their owner reachable through \`_owner\` (a CXCursor its
+// CXTranslationUnit), so it is not collected first. \`source\` is the owner
+// itself, or another child of the same owner whose pin is copied.
+// Finalizers of objects collected together run in no particular order, so a
+// child with a dispose function (holdOwner) also holds a reference to the
+// owner that only its own finalizer drops: the owner is disposed after it.
+static void pinOwner(napi_env env, napi_value child, napi_value source, bool sourceIsOwner, bool holdOwner) {
+    napi_value owner = sourceIsOwner ? source : pinnedOwner(env, source);
+    if (owner == nullptr) {
+        return;
+    }
+    napi_set_named_property(env, child, "_owner", owner);
+    napi_ref ref;
+    if (holdOwner && napi_create_reference(env, owner, 1, &ref) == napi_ok) {
+        napi_add_finalizer(env, child, ref, [](napi_env env, void* data, void*) {
+            napi_delete_reference(env, static_cast<napi_ref>(data));
+        }, nullptr, nullptr);
+    }
+}`;
+  }
+
+  private generateViewHelpers(): string {
+    return `// ArrayBuffer-backed structs: the bytes of an ArrayBuffer, TypedArray or
+// DataView holding at least size bytes, or nullptr
+static void* viewData(const Napi::Value& value, size_t size) {
+    if (value.IsDataView()) {
+        Napi::DataView view = value.As<Napi::DataView>();
+        return view.ByteLength() >= size ? view.Data() : nullptr;
+    }
+    if (value.IsTypedArray()) {
+        Napi::TypedArray array = value.As<Napi::TypedArray>();
+        if (array.ByteLength() < size) {
+            return nullptr;
+        }
+        return static_cast<uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset();
+    }
+    if (value.IsArrayBuffer()) {
+        Napi::ArrayBuffer buffer = value.As<Napi::ArrayBuffer>();
+        return buffer.ByteLength() >= size ? buffer.Data() : nullptr;
+    }
+    return nullptr;
+}
+
+// Copies a struct returned by value into the caller's output view if one was
+// passed, otherwise into a new ArrayBuffer
+static Napi::Value returnView(Napi::Env env, const Napi::Value& out, const void* data, size_t size) {
+    if (!out.IsUndefined() && !out.IsNull()) {
+        void* target = viewData(out, size);
+        if (!target) {
+            Napi::TypeError::New(env, "Output view is too small").ThrowAsJavaScriptException();
+            return env.Undefined();
+        }
+        memcpy(target, data, size);
+        return out;
+    }
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, size);
+    memcpy(buffer.Data(), data, size);
+    return buffer;
+}
+
+// get_<Struct>_field(view, field) for ArrayBuffer-backed structs
+static Napi::Value getViewStructField(const Napi::CallbackInfo& info, size_t size, const BindingStructField* fields, size_t count) {
+    void* ptr = info.Length() > 0 ? viewData(info[0], size) : nullptr;
+    if (!ptr) {
+        Napi::TypeError::New(info.Env(), "Expected struct view and field name or index").ThrowAsJavaScriptException();
+        return info.Env().Undefined();
+    }
+    return readStructField(info, ptr, fields, count);
+}`;
+  }
+
+  // Picks the functions with only numbers, bools, enums, strings, opaque
+  // handles and wrapped records in their signature. Those need no generated
+  // wrapper; two spellings of the same struct result would need two type
+  // names, so only the first is templated.
+  private selectTemplateFunctions(sortedFunctions: NonNullable<HeaderAST['functions']>): void {
+    this.templateWrapped = new Set();
+    this.templateTypeNames = new Map();
+    const typeNames = new Map<string, string>();
+
+    for (const func of sortedFunctions) {
+      if (this.templateWrapped.has(func.name)) continue;
+      // Dispose functions are exported as disposeArg<T, &fn>; owner lookups
+      // return the pinned owner before calling C
+      if (this.isDisposer(func) || TypeMapper.getOwnerSource(func) !== undefined) continue;
+      if (!func.params.every((param) => this.isTemplateType(param.type.spelling, 'param'))) continue;
+
+      const returnType = func.return.spelling;
+      if (!TypeMapper.isVoidType(returnType) && !this.isTemplateType(returnType, 'result')) continue;
+      const record = TypeMapper.isStringType(returnType) ? undefined : TypeMapper.getRecordName(returnType);
+      if (record) {
+        const spelling = typeNames.get(record);
+        if (spelling !== undefined && spelling !== returnType) continue;
+        typeNames.set(record, returnType);
+      }
+      this.templateWrapped.add(func.name);
+    }
+    this.templateTypeNames = typeNames;
+  }
+
+  // A `void f(T)` registered as the function that frees handle type T
+  private isDisposer(func: NonNullable<HeaderAST['functions']>[number]): boolean {
+    return func.params.length === 1 && TypeMapper.getDisposer(func.params[0]!.type.spelling) === func.name;
+  }
+
+  // Whether Marshal<T> converts cType the same way the hand-expanded wrappers do
+  private isTemplateType(cType: string, position: 'param' | 'result'): boolean {
+    if (cType === 'const char *') return true;
+    if (cType === 'char *') return position === 'result';
+    if (TypeMapper.isEnumType(cType)) return true;
+    if (TypeMapper.isFunctionPointerType(cType)) return false;
+
+    const resolved = TypeMapper.resolveTypedef(cType);
+    if (resolved.includes('(') || resolved.includes('^') || resolved.includes('[')) return false;
+    if (!resolved.includes('*')) {
+      const napiType = TypeMapper.getMapping(resolved).napiType;
+      if (napiType === 'Napi::Number' || napiType === 'Napi::Boolean' || napiType === 'Napi::BigInt') {
+        return true;
+      }
+    }
+    if (TypeMapper.isPodStructType(cType) || TypeMapper.isViewStructType(cType)) return false;
+    if (!cType.includes('*') && TypeMapper.getRecordName(cType)) return true;
+
+    // Opaque handles: typedefs to (non-string) pointers, passed as wrapped pointers
+    return (
+      position === 'param' &&
+      !cType.includes('*') &&
+      resolved.endsWith('*') &&
+      !/^(const\s+)?char\s*\*$/.test(resolved)
+    );
+  }
+
+  private generateWrapTemplates(): string {
+    return `// Generic wrappers: Marshal<T> converts one parameter or result type, and
+// wrap<&fn> is the napi_callback for a C function, built from its signature.
+// Both work on raw napi_values, skipping the node-addon-api objects
+template <typename T, typename Enable = void>
+struct Marshal;
+
+// Numbers and bools; long long is a BigInt
+template <typename T>
+struct Marshal<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>> {
+    using Storage = T;
+    static bool from(napi_env env, napi_value value, T* out) {
+        return fromNapi(env, value, out);
+    }
+    static T pass(T value) {
+        return value;
+    }
+    static napi_value to(napi_env env, T value) {
+        napi_value result;
+        if constexpr (std::is_same_v<T, bool>) {
+            napi_get_boolean(env, value, &result);
+        } else if constexpr (std::is_same_v<T, long long>) {
+            napi_create_bigint_int64(env, static_cast<int64_t>(value), &result);
+        } else if constexpr (std::is_same_v<T, unsigned long long>) {
+            napi_create_bigint_uint64(env, static_cast<uint64_t>(value), &result);
+        } else if constexpr (std::is_enum_v<T> || (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) <= 4)) {
+            napi_create_int32(env, static_cast<int32_t>(value), &result);
+        } else if constexpr (std::is_integral_v<T> && sizeof(T) <= 4) {
+            napi_create_uint32(env, static_cast<uint32_t>(value), &result);
+        } else {
+            napi_create_double(env, static_cast<double>(value), &result);
+        }
+        return result;
+    }
+};
+
+// Strings are copied for the duration of the call; null results are null
+template <>
+struct Marshal<const char*> {
+    using Storage = std::string;
+    static bool from(napi_env env, napi_value value, std::string* out) {
+        return fromNapi(env, value, out);
+    }
+    static const char* pass(const std::string& value) {
+        return value.c_str();
+    }
+    static napi_value to(napi_env env, const char* value) {
+        napi_value result;
+        if (value == nullptr) {
+            napi_get_null(env, &result);
+        } else {
+            napi_create_string_utf8(env, value, NAPI_AUTO_LENGTH, &result);
+        }
+        return result;
+    }
+};
+
+template <>
+struct Marshal<char*> {
+    static napi_value to(napi_env env, const char* value) {
+        return Marshal<const char*>::to(env, value);
+    }
+};
+
+// Records by value are read from wrapped pointers; results are copied to the
+// heap behind a finalizer and tagged with BindingTypeName<T>
+template <typename T>
+struct BindingTypeName;
+
+template <typename T>
+struct Marshal<T, std::enable_if_t<std::is_class_v<T> || std::is_union_v<T>>> {
+    using Storage = T*;
+    static bool from(napi_env env, napi_value value, T** out) {
+        void* wrapped;
+        if (!unwrapArg(env, value, &wrapped)) {
+            return false;
+        }
+        *out = static_cast<T*>(wrapped);
+        return true;
+    }
+    static T pass(T* value) {
+        return *value;
+    }
+    static napi_value to(napi_env env, const T& value) {
+${
+      this.hasLifetimes
+        ? `        if constexpr (BindingDisposer<T>::dispose != nullptr) {
+            return wrapDisposable<T, BindingDisposer<T>::dispose>(env, new T(value), BindingTypeName<T>::value);
+        } else {
+            return wrapOwnedPointer(Napi::Env(env), new T(value), BindingTypeName<T>::value);
+        }`
+        : `        return wrapOwnedPointer(Napi::Env(env), new T(value), BindingTypeName<T>::value);`
+    }
+    }
+};
+
+// Opaque handles (pointer typedefs) are stored behind a wrapped pointer
+template <typename T>
+struct Marshal<T*, std::enable_if_t<!std::is_same_v<std::remove_cv_t<T>, char>>> {
+    using Storage = T*;
+    static bool from(napi_env env, napi_value value, T** out) {
+        void* wrapped;
+        if (!unwrapArg(env, value, &wrapped)) {
+            return false;
+        }
+        *out = *static_cast<T**>(wrapped);
+        return true;
+    }
+    static T* pass(T* value) {
+        return value;
+    }
+};
+
+template <auto Fn, typename R, typename... Args, size_t... I>
+static napi_value callWrapped(napi_env env, napi_callback_info info, std::index_sequence<I...>) {
+    // The arguments land in a stack array; argc comes back as the passed count
+    [[maybe_unused]] napi_value argv[sizeof...(Args) > 0 ? sizeof...(Args) : 1];
+    size_t argc = sizeof...(Args);
+    if constexpr (sizeof...(Args) > 0) {
+        napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+        if (argc < sizeof...(Args)) {
+            std::string message = "Expected " + std::to_string(sizeof...(Args)) + " arguments";
+            napi_throw_type_error(env, nullptr, message.c_str());
+            return nullptr;
+        }
+    }
+    // The fold stops at the first argument that fails to convert
+    [[maybe_unused]] std::tuple<typename Marshal<Args>::Storage...> args;
+    if (!(Marshal<Args>::from(env, argv[I], &std::get<I>(args)) && ...)) {
+        return nullptr;
+    }
+    if constexpr (std::is_void_v<R>) {
+        Fn(Marshal<Args>::pass(std::get<I>(args))...);
+        return nullptr;
+    } else {
+        return Marshal<R>::to(env, Fn(Marshal<Args>::pass(std::get<I>(args))...));
+    }
+}
+
+// Deduces the signature; noexcept C functions convert to a plain pointer
+template <auto Fn, typename R, typename... Args>
+static napi_value callWrapped(napi_env env, napi_callback_info info, R (*)(Args...)) {
+    return callWrapped<Fn, std::decay_t<R>, std::decay_t<Args>...>(env, info, std::index_sequence_for<Args...>{});
+}
+
+template <auto Fn>
+static napi_value wrap(napi_env env, napi_callback_info info) {
+    return callWrapped<Fn>(env, info, Fn);
+}${
+      this.ownership.length > 0
+        ? `
+
+// wrap<&fn> for a function returning a child handle, which pins the owner
+// found in argument Source (see pinOwner)
+template <auto Fn, size_t Source, bool SourceIsOwner, bool HoldOwner>
+static napi_value wrapPinned(napi_env env, napi_callback_info info) {
+    napi_value result = wrap<Fn>(env, info);
+    if (result != nullptr) {
+        napi_value argv[Source + 1];
+        size_t argc = Source + 1;
+        napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+        pinOwner(env, result, argv[Source], SourceIsOwner, HoldOwner);
+    }
+    return result;
+}`
+        : ''
+    }`;
+  }
+
+  private generateCallbackHelpers(): string {
+    return `// JS function behind a C function pointer. Sync callbacks borrow the
+// argument for the duration of the call; retained (threadsafe) ones hold a
+// reference and queue calls made from other threads onto the JS thread.
+// \`owner\` (or \`ownerRef\` when retained) is what child handles passed to
+// the function are pinned to (see pinOwner), or null.
+struct JsCallback {
+    napi_env env;
+    napi_value fn;
+    napi_ref ref;
+    napi_threadsafe_function tsfn;
+    std::thread::id jsThread;
+    bool threw;
+    napi_value owner;
+    napi_ref ownerRef;
+};
+
+// The owner of child handles passed to the callback, or nullptr
+static napi_value jsCallbackOwner(napi_env env, JsCallback* callback) {
+    napi_value owner = callback->owner;
+    if (callback->ownerRef != nullptr) {
+        napi_get_reference_value(env, callback->ownerRef, &owner);
+    }
+    return owner;
+}
+
+// Runs on the JS thread. After a sync callback throws, later calls in the
+// same C call are skipped and the exception propagates once it returns.
+template <typename Call>
+static void runJsCallback(JsCallback* callback, Call& call) {
+    Napi::Env env(callback->env);
+    Napi::HandleScope scope(env);
+    napi_value fn = callback->fn;
+    if (callback->ref != nullptr) {
+        napi_get_reference_value(env, callback->ref, &fn);
+    }
+    call(env, Napi::Function(env, fn));
+    if (callback->ref == nullptr && env.IsExceptionPending()) {
+        callback->threw = true;
+    }
+}
+
+// A call made off the JS thread, waiting for the JS thread to run it
+struct QueuedJsCall {
+    std::function<void()> run;
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+};
+
+static void runQueuedJsCall(napi_env env, napi_value, void*, void* data) {
+    auto* queued = static_cast<QueuedJsCall*>(data);
+    if (env != nullptr) {
+        queued->run();
+    }
+    std::lock_guard<std::mutex> lock(queued->mutex);
+    queued->done = true;
+    queued->finished.notify_one();
+}
+
+template <typename Call>
+static void invokeJsCallback(JsCallback* callback, Call&& call) {
+    if (callback == nullptr) {
+        return;
+    }
+    if (std::this_thread::get_id() == callback->jsThread) {
+        if (!callback->threw) {
+            runJsCallback(callback, call);
+        }
+        return;
+    }
+    // Sync callbacks are not called from other threads; retained ones wait
+    // for the JS thread, which must not be blocked on this thread meanwhile
+    if (callback->tsfn == nullptr) {
+        return;
+    }
+    QueuedJsCall queued;
+    queued.run = [&] { runJsCallback(callback, call); };
+    if (napi_call_threadsafe_function(callback->tsfn, &queued, napi_tsfn_blocking) != napi_ok) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(queued.mutex);
+    queued.finished.wait(lock, [&] { return queued.done; });
+}
+
+// Marks a JS function whose napi_wrap holds its retained JsCallbacks
+static const napi_type_tag kRetainedCallbacksTag = {0x6a7343616c6c6261, 0x636b5265746169ee};
+
+// The retained JsCallbacks of a JS function, one per owner, or nullptr.
+// \`create\` wraps an empty list on a function that has none yet.
+static std::vector<JsCallback*>* retainedJsCallbacks(napi_env env, napi_value fn, bool create) {
+    bool tagged = false;
+    void* data = nullptr;
+    if (napi_check_object_type_tag(env, fn, &kRetainedCallbacksTag, &tagged) == napi_ok && tagged) {
+        napi_unwrap(env, fn, &data);
+        return static_cast<std::vector<JsCallback*>*>(data);
+    }
+    if (!create) {
+        return nullptr;
+    }
+    // Functions wrapped by someone else are not reused
+    auto* retained = new std::vector<JsCallback*>();
+    if (napi_wrap(env, fn, retained, nullptr, nullptr, nullptr) != napi_ok) {
+        delete retained;
+        return nullptr;
+    }
+    napi_type_tag_object(env, fn, &kRetainedCallbacksTag);
+    return retained;
+}
+
+// Threadsafe callbacks live as long as the addon, since C may keep the
+// pointer and never says when it is done with it: each JS function (per
+// owner) retains one reference and one tsfn for good, and passing it again
+// reuses them. Their queue does not keep the event loop alive
+static JsCallback* retainJsCallback(napi_env env, napi_value fn, napi_value owner) {
+    std::vector<JsCallback*>* retained = retainedJsCallbacks(env, fn, false);
+    if (retained != nullptr) {
+        for (JsCallback* callback : *retained) {
+            napi_value callbackOwner = jsCallbackOwner(env, callback);
+            bool same = callbackOwner == nullptr && owner == nullptr;
+            if (callbackOwner != nullptr && owner != nullptr) {
+                napi_strict_equals(env, callbackOwner, owner, &same);
+            }
+            if (same) {
+                return callback;
+            }
+        }
+    }
+    auto* callback = new JsCallback{env, nullptr, nullptr, nullptr, std::this_thread::get_id(), false, nullptr, nullptr};
+    napi_create_reference(env, fn, 1, &callback->ref);
+    if (owner != nullptr) {
+        napi_create_reference(env, owner, 1, &callback->ownerRef);
+    }
+    napi_value name;
+    napi_create_string_utf8(env, "callback", NAPI_AUTO_LENGTH, &name);
+    napi_create_threadsafe_function(
+        env, nullptr, nullptr, name, 0, 1, nullptr, nullptr, nullptr, runQueuedJsCall, &callback->tsfn);
+    napi_unref_threadsafe_function(env, callback->tsfn);
+    if (retained == nullptr) {
+        retained = retainedJsCallbacks(env, fn, true);
+    }
+    if (retained != nullptr) {
+        retained->push_back(callback);
+    }
+    return callback;
+}
+
+// Function-pointer argument. A JS function becomes \`trampoline\` bound to a
+// JsCallback (\`sync\` storage, or a retained one when null). An External is a
+// native function pointer, e.g. exported by another addon, passed through so
+// C calls it directly. null/undefined is a null pointer. Child handles the
+// trampoline passes to JS pin \`owner\` when it is not null.
+template <typename Fn>
+static bool callbackArg(napi_env env, napi_value value, Fn trampoline, JsCallback* sync, Fn* out, JsCallback** callback,
+                        napi_value owner = nullptr) {
+    *out = nullptr;
+    *callback = nullptr;
+    napi_valuetype type;
+    napi_typeof(env, value, &type);
+    if (type == napi_function) {
+        if (sync != nullptr) {
+            *sync = JsCallback{env, value, nullptr, nullptr, std::this_thread::get_id(), false, owner, nullptr};
+            *callback = sync;
+        } else {
+            *callback = retainJsCallback(env, value, owner);
+        }
+        *out = trampoline;
+        return true;
+    }
+    if (type == napi_external) {
+        void* data;
+        napi_get_value_external(env, value, &data);
+        *out = reinterpret_cast<Fn>(data);
+        return true;
+    }
+    if (type == napi_null || type == napi_undefined) {
+        return true;
+    }
+    return argTypeError(env, "Expected a function");
+}
+
+// Binds a trampoline without a user-data argument to its JsCallback for the
+// duration of a sync call
+struct JsCallbackSlot {
+    JsCallback** slot;
+    JsCallback* previous;
+    JsCallbackSlot(JsCallback** slot, JsCallback* callback) : slot(slot), previous(*slot) {
+        if (callback != nullptr) {
+            *slot = callback;
+        }
+    }
+    ~JsCallbackSlot() {
+        *slot = previous;
+    }
+};`;
+  }
+
+  // JS value for argument `cVar` of a trampoline
+  private callbackArgToJs(cVar: string, cType: string): string {
+    const clean = cType.replace(/^const\s+/, '').trim();
+    switch (TypeMapper.getCallbackArgKind(cType)) {
+      case 'enum':
+        return `Napi::Number::New(env, static_cast<int>(${cVar}))`;
+      case 'string':
+        return `${cVar} ? Napi::Value(Napi::String::New(env, ${cVar})) : env.Null()`;
+      case 'value':
+        return TypeMapper.isPodStructType(clean)
+          ? TypeMapper.getCToNapi(cVar, clean)
+          : TypeMapper.getCToNapi(cVar, TypeMapper.resolveTypedef(clean));
+      case 'owned':
+        return `wrapOwnedPointer(env, new ${clean}(${cVar}), "${clean}")`;
+      default:
+        return TypeMapper.getCToNapi(cVar, clean);
+    }
+  }
+
+  private generateCallbackTrampolines(callbacks: CallbackSignature[]): string {
+    const lines: string[] = [];
+    for (const callback of callbacks) {
+      const args = callback.params.map((type, i) => `${type} arg${i}`).join(', ');
+      const context =
+        callback.userData !== undefined
+          ? `static_cast<JsCallback*>(arg${callback.userData})`
+          : `${callback.name}_current`;
+      // Child handles (a visitor's CXCursor) pin the owner bound with the
+      // JS function, so they outlive a dropped or disposed owner handle
+      const pinned = callback.params.flatMap((type, i) =>
+        i !== callback.userData && TypeMapper.getCallbackArgKind(type) === 'owned' && TypeMapper.getOwner(type)
+          ? [i]
+          : [],
+      );
+      const jsArgs = callback.params.flatMap((type, i) => {
+        if (i === callback.userData) return [];
+        return [pinned.includes(i) ? `jsArg${i}` : this.callbackArgToJs(`arg${i}`, type)];
+      });
+      const returnsValue = !TypeMapper.isVoidType(callback.result);
+
+      lines.push(`// ${callback.name} -> the bound JS function (${callback.mode})`);
+      if (callback.userData === undefined) {
+        lines.push(`static JsCallback* ${callback.name}_current = nullptr;`);
+      }
+      lines.push(`static ${callback.result} ${callback.name}_trampoline(${args}) {`);
+      if (returnsValue) {
+        lines.push(`    ${callback.result} result{};`);
+      }
+      lines.push(`    invokeJsCallback(${context}, [&](Napi::Env env, Napi::Function fn) {`);
+      if (pinned.length > 0) {
+        lines.push(`        napi_value owner = jsCallbackOwner(env, ${context});`);
+      }
+      for (const i of pinned) {
+        lines.push(`        Napi::Value jsArg${i} = ${this.callbackArgToJs(`arg${i}`, callback.params[i]!)};`);
+        lines.push(`        pinOwner(env, jsArg${i}, owner, true, false);`);
+      }
+      const call = jsArgs.length > 0 ? `fn.Call({${jsArgs.join(', ')}})` : 'fn.Call({})';
+      if (returnsValue) {
+        // undefined keeps the zero result (e.g. CXChildVisit_Break)
+        lines.push(`        Napi::Value value = ${call};`);
+        lines.push(`        if (!value.IsEmpty() && !value.IsUndefined()) {`);
+        lines.push(`            fromNapi(env, value, &result);`);
+        lines.push(`        }`);
+      } else {
+        lines.push(`        ${call};`);
+      }
+      lines.push(`    });`);
+      if (returnsValue) {
+        lines.push(`    return result;`);
+      }
+      lines.push(`}`);
+      lines.push('');
+    }
+    return lines.join('\n');
+  }
+
+  private generateManyHelpers(): string {
+    return `// fn_many companions: column index of the call, a TypedArray of T as long as
+// the columns before it
+template <typename T>
+static bool manyInput(const Napi::CallbackInfo& info, size_t index, size_t* count, const T** data) {
+    if (index >= info.Length() || !info[index].IsTypedArray()) {
+        return false;
+    }
+    Napi::TypedArray array = info[index].As<Napi::TypedArray>();
+    if (array.TypedArrayType() != typedArrayType<T>() || (index > 0 && array.ElementLength() != *count)) {
+        return false;
+    }
+    *count = array.ElementLength();
+    *data = reinterpret_cast<const T*>(static_cast<const uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset());
+    return true;
+}
+
+// Result column of an fn_many call: the caller's TypedArray of R (at least
+// count long) when one is passed at index, otherwise a new one
+template <typename R>
+static bool manyOutput(const Napi::CallbackInfo& info, size_t index, size_t count, R** data, Napi::Value* out) {
+    Napi::Env env = info.Env();
+    if (index < info.Length() && !info[index].IsUndefined()) {
+        Napi::TypedArray array = info[index].As<Napi::TypedArray>();
+        if (!info[index].IsTypedArray() || array.TypedArrayType() != typedArrayType<R>() || array.ElementLength() < count) {
+            Napi::TypeError::New(env, "Output array has the wrong type or is too short").ThrowAsJavaScriptException();
+            return false;
+        }
+        *data = reinterpret_cast<R*>(static_cast<uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset());
+        *out = array;
+        return true;
+    }
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, count * sizeof(R));
+    *data = static_cast<R*>(buffer.Data());
+    napi_value array;
+    napi_create_typedarray(env, typedArrayType<R>(), count, buffer, 0, &array);
+    *out = Napi::Value(env, array);
+    return true;
+}`;
+  }
+
+  // <fn>_many(columns..., out?): calls fn once per row of equal-length
+  // TypedArray columns in a plain loop the compiler can vectorize when fn is
+  // inlinable
+  private generateManyWrappers(functions: NonNullable<HeaderAST['functions']>): WrapperUnit[] {
+    const units: WrapperUnit[] = [];
+
+    for (const func of functions) {
+      const lines: string[] = [];
+      units.push({ name: func.name, lines });
+      const safeName = TypeMapper.sanitizeIdentifier(func.name);
+      const result = TypeMapper.getManyColumn(func.return.spelling)!;
+      const columns = func.params.map((param, i) => ({
+        name: `${param.name || `arg${i}`}_in`,
+        type: param.type.spelling,
+        ...TypeMapper.getManyColumn(param.type.spelling)!,
+      }));
+
+      lines.push(`static Napi::Value ${safeName}_many_wrapper(const Napi::CallbackInfo& info) {`);
+      lines.push(`    Napi::Env env = info.Env();`);
+      lines.push(`    size_t count = 0;`);
+      for (const column of columns) {
+        lines.push(`    const ${column.elementType}* ${column.name} = nullptr;`);
+      }
+      const inputs = columns.map((column, i) => `!manyInput(info, ${i}, &count, &${column.name})`);
+      lines.push(`    if (${inputs.join(' || ')}) {`);
+      lines.push(
+        `        Napi::TypeError::New(env, "Expected ${columns.map((c) => c.typedArray).join(', ')} of equal length").ThrowAsJavaScriptException();`,
+      );
+      lines.push(`        return env.Undefined();`);
+      lines.push(`    }`);
+      lines.push(`    ${result.elementType}* result = nullptr;`);
+      lines.push(`    Napi::Value out;`);
+      lines.push(`    if (!manyOutput(info, ${columns.length}, count, &result, &out)) {`);
+      lines.push(`        return env.Undefined();`);
+      lines.push(`    }`);
+      const args = columns.map((column) =>
+        TypeMapper.isEnumType(column.type)
+          ? `static_cast<${column.type}>(${column.name}[i])`
+          : `${column.name}[i]`,
+      );
+      const call = `${func.name}(${args.join(', ')})`;
+      lines.push(`    for (size_t i = 0; i < count; i++) {`);
+      lines.push(
+        `        result[i] = ${TypeMapper.isEnumType(func.return.spelling) ? `static_cast<int32_t>(${call})` : call};`,
+      );
+      lines.push(`    }`);
+      lines.push(`    return out;`);
+      lines.push(`}`);
+      lines.push('');
+    }
+
+    return units;
+  }
+
+  private generateEnumTables(sortedEnums: HeaderAST['enums']): string {
+    const lines: string[] = ['// Enum tables (exports are created lazily on first access)'];
+    const seenEnums = new Set<string>();
+
+    sortedEnums.forEach((enumDef, index) => {
+      const isNamed = /^[A-Za-z_]\w*$/.test(enumDef.name);
+      if (isNamed) {
+        if (seenEnums.has(enumDef.name)) return;
+        seenEnums.add(enumDef.name);
+      }
+
+      // Declaration order, so reverse lookups prefer the original constant
+      // over aliases declared after it (e.g. CXCursor_FirstDecl)
+      const constants: typeof enumDef.constants = [];
+      const seenConstants = new Set<string>();
+      for (const constant of enumDef.constants) {
+        if (seenConstants.has(constant.name)) continue;
+        seenConstants.add(constant.name);
+        constants.push(constant);
+      }
+      if (constants.length === 0) return;
+
+      const tableName = `kEnum_${isNamed ? TypeMapper.sanitizeIdentifier(enumDef.name) : `Unnamed${index}`}`;
+      if (enumDef.documentation) {
+        lines.push(this.formatComment(enumDef.documentation));
+      }
+      lines.push(`// enum ${enumDef.name}`);
+      lines.push(`static constexpr BindingEnumConstant ${tableName}[] = {`);
+      constants.forEach((constant, i) => {
+        lines.push(`    {"${constant.name}", ${constant.name}},`);
+        if (!this.enumConstantRefs.has(constant.name)) {
+          this.enumConstantRefs.set(constant.name, `&${tableName}[${i}]`);
+        }
+      });
+      lines.push(`};`);
+
+      if (isNamed) {
+        const objectTable = `${tableName}_Table`;
+        lines.push(
+          `static constexpr BindingEnumTable ${objectTable} = {"${enumDef.name}", ${tableName}, ${constants.length}};`,
+        );
+        this.enumTables.push({ name: enumDef.name, table: objectTable });
+      }
+      lines.push('');
+    });
+
+    if (this.enumTables.length > 0) {
+      lines.push('static constexpr const BindingEnumTable* kEnumTables[] = {');
+      for (const { table } of this.enumTables) {
+        lines.push(`    &${table},`);
+      }
+      lines.push('};');
+      lines.push('');
+      lines.push(`// enumName(enumName, value) -> name of the first constant declared with value
+static Napi::Value bindingEnumName(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2 || !info[0].IsString() || !(info[1].IsNumber() || info[1].IsBigInt())) {
+        Napi::TypeError::New(env, "Expected (enumName: string, value: number)").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    std::string name = info[0].As<Napi::String>().Utf8Value();
+    bool lossless = true;
+    int64_t value = info[1].IsBigInt() ? info[1].As<Napi::BigInt>().Int64Value(&lossless)
+                                       : info[1].As<Napi::Number>().Int64Value();
+    for (const BindingEnumTable* table : kEnumTables) {
+        if (name != table->name) continue;
+        for (size_t i = 0; i < table->count; i++) {
+            if (table->constants[i].value == value) {
+                return Napi::String::New(env, table->constants[i].name);
+            }
+        }
+        return env.Undefined();
+    }
+    Napi::RangeError::New(env, "Unknown enum: " + name).ThrowAsJavaScriptException();
+    return env.Undefined();
+}`);
+    }
+
+    return lines.join('\n');
+  }
+
+  private generatePodMarshalers(): string {
+    const lines: string[] = [
+      '// By-value structs: small POD structs are copied to and from plain JS objects',
+      '// on the stack. Properties are always set in declaration order, so all values',
+      '// of one struct share a single object shape.',
+    ];
+
+    for (const [name, fields] of TypeMapper.getPodStructTypes()) {
+      const safeName = TypeMapper.sanitizeIdentifier(name);
+
+      lines.push(`static bool ${safeName}_fromValue(const Napi::Value& value, ${name}* out) {`);
+      lines.push(`    if (!value.IsObject()) {`);
+      lines.push(`        return false;`);
+      lines.push(`    }`);
+      lines.push(`    Napi::Object obj = value.As<Napi::Object>();`);
+      for (const field of fields) {
+        const fieldValue = `obj.Get("${field.name}")`;
+        const podName = TypeMapper.getPodStructName(field.type);
+        if (podName) {
+          lines.push(
+            `    if (!${TypeMapper.sanitizeIdentifier(podName)}_fromValue(${fieldValue}, &out->${field.name})) {`,
+          );
+          lines.push(`        return false;`);
+          lines.push(`    }`);
+        } else if (TypeMapper.isEnumType(field.type)) {
+          lines.push(
+            `    out->${field.name} = static_cast<${field.type}>(${fieldValue}.As<Napi::Number>().Int32Value());`,
+          );
+        } else {
+          const cType = TypeMapper.resolveTypedef(field.type);
+          lines.push(`    out->${field.name} = ${TypeMapper.getNapiToC(fieldValue, cType)};`);
+        }
+      }
+      lines.push(`    return true;`);
+      lines.push(`}`);
+      lines.push('');
+
+      lines.push(`static Napi::Value ${safeName}_toValue(Napi::Env env, const ${name}& value) {`);
+      lines.push(`    Napi::Object obj = Napi::Object::New(env);`);
+      for (const field of fields) {
+        const podName = TypeMapper.getPodStructName(field.type);
+        let fieldValue: string;
+        if (podName) {
+          fieldValue = `${TypeMapper.sanitizeIdentifier(podName)}_toValue(env, value.${field.name})`;
+        } else if (TypeMapper.isEnumType(field.type)) {
+          fieldValue = `Napi::Number::New(env, static_cast<int>(value.${field.name}))`;
+        } else {
+          fieldValue = TypeMapper.getCToNapi(`value.${field.name}`, TypeMapper.resolveTypedef(field.type));
+        }
+        lines.push(`    obj.Set("${field.name}", ${fieldValue});`);
+      }
+      lines.push(`    return obj;`);
+      lines.push(`}`);
+      lines.push('');
+    }
+
+    return lines.join('\n');
+  }
+
+  private generateStructWrappers(sortedStructs: HeaderAST['structs']): WrapperUnit[] {
+    const units: WrapperUnit[] = [];
+
+    for (const struct of sortedStructs) {
+      if (!struct.name) continue;
+
+      // Skip opaque pointer types (ending with Impl or that are forward declarations)
+      if (struct.name.endsWith('Impl') || struct.fields.length === 0) {
+        continue;
+      }
+
+      // Handle anonymous structs with better naming
+      let structName = struct.name;
+      let actualTypeName = struct.name;
+      
+      if (structName.includes('(unnamed at ') || structName.includes('__') || structName.includes('/')) {
+        // Look for a typedef that might reference this struct
+        const typedef = this.ast.typedefs?.find(t => t.underlying === struct.name || t.spelling === struct.name);
+        if (typedef) {
+          actualTypeName = typedef.name;
+          structName = typedef.name;
+        } else {
+          // Use a generic name for function generation, but we can't use the struct
+          structName = `AnonymousStruct_${this.generatedStructs.size}`;
+          // Skip generating this struct since we can't reference it properly
+          continue;
+        }
+      }
+
+      const safeName = TypeMapper.sanitizeIdentifier(structName);
+      const createFunctionName = `Create_${safeName}`;
+      const getFieldFunctionName = `Get_${safeName}_Field`;
+
+      // Skip if already generated
+      if (this.generatedStructs.has(createFunctionName)) {
+        continue;
+      }
+      this.generatedStructs.add(createFunctionName);
+      this.generatedStructs.add(getFieldFunctionName);
+      const lines: string[] = [];
+      units.push({ name: structName, lines });
+
+      if (struct.documentation) {
+        lines.push(this.formatComment(struct.documentation));
+      }
+
+      // Fields in name order; the position in this list is the field index
+      // accepted by get_<Struct>_field and used by the TS helpers
+      const fields = [...struct.fields]
+        .filter((field) => field.name && field.name.trim() !== '')
+        .sort((a, b) => a.name.localeCompare(b.name));
+
+      for (const field of fields) {
+        const fieldName = TypeMapper.sanitizeIdentifier(field.name);
+
+        lines.push(`static Napi::Value ${safeName}_get_${fieldName}(Napi::Env env, void* data) {`);
+        lines.push(`    auto* ptr = static_cast<${actualTypeName}*>(data);`);
+        lines.push(...this.generateFieldGetter(field));
+        lines.push(`}`);
+        lines.push('');
+
+        lines.push(`static void ${safeName}_set_${fieldName}(void* data, const Napi::Value& value) {`);
+        lines.push(`    auto* ptr = static_cast<${actualTypeName}*>(data);`);
+        lines.push(...this.generateFieldSetter(field));
+        lines.push(`}`);
+        lines.push('');
+      }
+
+      // Structs with only anonymous members have no table
+      const tableName = fields.length > 0 ? `kFields_${safeName}` : 'nullptr';
+      if (fields.length > 0) {
+        lines.push(`static constexpr BindingStructField ${tableName}[] = {`);
+        for (const field of fields) {
+          const fieldName = TypeMapper.sanitizeIdentifier(field.name);
+          lines.push(`    {"${field.name}", ${safeName}_get_${fieldName}, ${safeName}_set_${fieldName}},`);
+        }
+        lines.push(`};`);
+        lines.push('');
+      }
+
+      if (TypeMapper.isViewStructType(actualTypeName)) {
+        // ArrayBuffer-backed struct: initialized in place in a new buffer
         lines.push(
-          `        Napi::TypeError::New(env, "Expected ${func.params.length} arguments").ThrowAsJavaScriptException();`,
+          `static Napi::Value ${createFunctionName}(const Napi::CallbackInfo& info) {`,
+        );
+        lines.push(`    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(info.Env(), sizeof(${actualTypeName}));`);
+        lines.push(`    if (info.Length() > 0 && info[0].IsObject()) {`);
+        lines.push(
+          `        initStructFields(info[0].As<Napi::Object>(), buffer.Data(), ${tableName}, ${fields.length});`,
         );
-        lines.push(`        return env.Undefined();`);
         lines.push(`    }`);
-        lines.push(`    `);
-      }
-
-      // Special handling for libclang-style visitor APIs: clang_visitChildren
-      if (func.name === 'clang_visitChildren') {
-        // Handle all three parameters specially: parent, JS visitor, client_data (ignored)
-        lines.push(`    // Parameter: parent (CXCursor)`);
-        lines.push(`    CXCursor parent = *static_cast<CXCursor*>(unwrapPointer(info[0].As<Napi::Object>()));`);
-        lines.push(`    `);
-        lines.push(`    // Parameter: visitor (JavaScript callback function)`);
-        lines.push(`    if (!info[1].IsFunction()) {`);
-        lines.push(`        Napi::TypeError::New(env, "Expected function for visitor parameter").ThrowAsJavaScriptException();`);
-        lines.push(`        return env.Undefined();`);
+        lines.push(`    return buffer;`);
+        lines.push(`}`);
+        lines.push('');
+
+        lines.push(
+          `static Napi::Value ${getFieldFunctionName}(const Napi::CallbackInfo& info) {`,
+        );
+        lines.push(
+          `    return getViewStructField(info, sizeof(${actualTypeName}), ${tableName}, ${fields.length});`,
+        );
+        lines.push(`}`);
+        lines.push('');
+        continue;
+      }
+
+      if (TypeMapper.isPodStructType(actualTypeName)) {
+        // By-value struct: built on the stack and returned as a plain object
+        lines.push(
+          `static Napi::Value ${createFunctionName}(const Napi::CallbackInfo& info) {`,
+        );
+        lines.push(`    ${actualTypeName} value{};`);
+        lines.push(`    if (info.Length() > 0 && info[0].IsObject()) {`);
+        lines.push(
+          `        initStructFields(info[0].As<Napi::Object>(), &value, ${tableName}, ${fields.length});`,
+        );
         lines.push(`    }`);
-        lines.push(`    Napi::Function jsVisitor = info[1].As<Napi::Function>();`);
-        lines.push(`    `);
-        lines.push(`    // Create C++ visitor function that forwards to JS`);
-        lines.push(`    struct VisitorThunkData { Napi::FunctionReference fnRef; };`);
-        lines.push(`    VisitorThunkData data{ Napi::Persistent(jsVisitor) };`);
-        lines.push(`    auto visitor = [](CXCursor cursor, CXCursor parent, CXClientData client_data) -> enum CXChildVisitResult {`);
-        lines.push(`        auto* d = static_cast<VisitorThunkData*>(client_data);`);
-        lines.push(`        Napi::Env env = d->fnRef.Env();`);
-        lines.push(`        CXCursor* cursorPtr = new CXCursor(cursor);`);
-        lines.push(`        Napi::Object cursorObj = wrapOwnedPointer(env, cursorPtr, "CXCursor");`);
-        lines.push(`        CXCursor* parentPtr = new CXCursor(parent);`);
-        lines.push(`        Napi::Object parentObj = wrapOwnedPointer(env, parentPtr, "CXCursor");`);
-        lines.push(`        Napi::Value result = d->fnRef.Call({cursorObj, parentObj});`);
-        lines.push(`        if (result.IsNumber()) {`);
-        lines.push(`            return static_cast<enum CXChildVisitResult>(result.As<Napi::Number>().Int32Value());`);
-        lines.push(`        }`);
-        lines.push(`        return CXChildVisit_Break;`);
-        lines.push(`    };`);
-        lines.push(`    auto result = clang_visitChildren(parent, visitor, &data);`);
-        lines.push(`    return Napi::Number::New(env, result);`);
+        lines.push(`    return ${safeName}_toValue(info.Env(), value);`);
+        lines.push(`}`);
+        lines.push('');
+
+        lines.push(
+          `static Napi::Value ${getFieldFunctionName}(const Napi::CallbackInfo& info) {`,
+        );
+        lines.push(
+          `    return getValueStructField<${actualTypeName}, ${safeName}_fromValue>(info, ${tableName}, ${fields.length});`,
+        );
         lines.push(`}`);
         lines.push('');
-        continue; // Skip generic handling for this function
+        continue;
       }
 
-      // Convert parameters
-      for (let i = 0; i < func.params.length; i++) {
-        const param = func.params[i];
-        if (!param) continue;
-        const paramName = param.name || `arg${i}`;
-        const paramType = param.type.spelling;
+      // Create struct wrapper
+      lines.push(
+        `static Napi::Value ${createFunctionName}(const Napi::CallbackInfo& info) {`,
+      );
+      lines.push(`    ${actualTypeName}* ptr = new ${actualTypeName}();`);
+      lines.push(`    if (info.Length() > 0 && info[0].IsObject()) {`);
+      lines.push(
+        `        initStructFields(info[0].As<Napi::Object>(), ptr, ${tableName}, ${fields.length});`,
+      );
+      lines.push(`    }`);
+      lines.push(`    return wrapOwnedPointer(info.Env(), ptr, "${structName}");`);
+      lines.push(`}`);
+      lines.push('');
 
-        lines.push(`    // Parameter: ${paramName} (${paramType})`);
+      // Getter for struct fields, by index or by name
+      lines.push(
+        `static Napi::Value ${getFieldFunctionName}(const Napi::CallbackInfo& info) {`,
+      );
+      lines.push(`    return getStructField(info, ${tableName}, ${fields.length});`);
+      lines.push(`}`);
+      lines.push('');
+    }
 
-        const mapping = TypeMapper.getMapping(paramType);
-        if (TypeMapper.isStructType(paramType)) {
-          // Struct passed by value - unwrap the pointer and dereference
-          lines.push(
-            `    ${paramType} ${paramName} = *static_cast<${paramType}*>(unwrapPointer(info[${i}].As<Napi::Object>()));`,
-          );
-        } else if (TypeMapper.isEnumType(paramType)) {
-          // Enum parameters need explicit casting
-          lines.push(
-            `    ${paramType} ${paramName} = static_cast<${paramType}>(info[${i}].As<Napi::Number>().Int32Value());`,
-          );
-        } else if (TypeMapper.isFunctionPointerType(paramType)) {
-          // Handle function pointers - they're passed as External
-          lines.push(`    // Parameter: ${paramName} (${paramType})`);
-          // For function pointers like "void (*)(void *)", we need to insert the variable name
-          // in the middle: "void (*fn)(void *)"
-          let declarationType = paramType;
-          if (paramType.includes('(*)')) {
-            declarationType = paramType.replace('(*)', `(*${paramName})`);
-            lines.push(`    ${declarationType} = nullptr;`);
-          } else {
-            // For typedef'd function pointers like MathFunc
-            lines.push(`    ${paramType} ${paramName} = nullptr;`);
-          }
-          lines.push(`    if (info[${i}].IsExternal()) {`);
-          lines.push(`        ${paramName} = reinterpret_cast<${paramType}>(info[${i}].As<Napi::External<void>>().Data());`);
-          lines.push(`    }`);
-        } else if (TypeMapper.isStructPointer(paramType)) {
-          // Handle struct pointers (including const)
-          // Allow null/undefined for optional struct pointers
-          lines.push(`    ${paramType} ${paramName} = nullptr;`);
-          lines.push(`    if (!info[${i}].IsNull() && !info[${i}].IsUndefined() && info[${i}].IsObject()) {`);
-          lines.push(`        ${paramName} = static_cast<${paramType}>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
-          lines.push(`    }`);
-        } else if (paramType === 'int *' && func.name === 'clang_getFileContents' && paramName === 'size') {
-          // Special-case: some platforms resolve size_t* to int* in headers; ensure correct type for libclang API
-          lines.push(`    size_t * ${paramName} = static_cast<size_t *>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
-        } else if (paramType === 'size_t *' || paramType === 'int *') {
-          // Handle integer pointer buffers via wrapped pointers
-          if (paramType === 'size_t *') {
-            lines.push(`    size_t * ${paramName} = static_cast<size_t *>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
-          } else {
-            lines.push(`    int * ${paramName} = static_cast<int *>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
-          }
-        } else if (paramType === 'const char *const *' || paramType === 'const char * const *' || paramType === 'char **') {
-          // Handle string array parameters (usually for command-line args)
-          // These can be null or a JavaScript array of strings
-          lines.push(`    ${paramType} ${paramName} = nullptr;`);
-          lines.push(`    std::vector<std::string> ${paramName}_strings;`);
-          if (paramType === 'char **') {
-            // For non-const char**, we need a vector of char*
-            lines.push(`    std::vector<char*> ${paramName}_cstrs;`);
-            lines.push(`    if (!info[${i}].IsNull() && !info[${i}].IsUndefined()) {`);
-            lines.push(`        if (info[${i}].IsArray()) {`);
-            lines.push(`            Napi::Array arr = info[${i}].As<Napi::Array>();`);
-            lines.push(`            for (uint32_t j = 0; j < arr.Length(); j++) {`);
-            lines.push(`                ${paramName}_strings.push_back(arr.Get(j).As<Napi::String>().Utf8Value());`);
-            lines.push(`            }`);
-            lines.push(`            for (auto& s : ${paramName}_strings) {`);
-            lines.push(`                ${paramName}_cstrs.push_back(const_cast<char*>(s.c_str()));`);
-            lines.push(`            }`);
-            lines.push(`            ${paramName} = ${paramName}_cstrs.data();`);
-          } else {
-            lines.push(`    std::vector<const char*> ${paramName}_cstrs;`);
-            lines.push(`    if (!info[${i}].IsNull() && !info[${i}].IsUndefined()) {`);
-            lines.push(`        if (info[${i}].IsArray()) {`);
-            lines.push(`            Napi::Array arr = info[${i}].As<Napi::Array>();`);
-            lines.push(`            for (uint32_t j = 0; j < arr.Length(); j++) {`);
-            lines.push(`                ${paramName}_strings.push_back(arr.Get(j).As<Napi::String>().Utf8Value());`);
-            lines.push(`            }`);
-            lines.push(`            for (const auto& s : ${paramName}_strings) {`);
-            lines.push(`                ${paramName}_cstrs.push_back(s.c_str());`);
-            lines.push(`            }`);
-            lines.push(`            ${paramName} = ${paramName}_cstrs.data();`)
-          };
-          lines.push(`        } else if (info[${i}].IsObject()) {`);
-          lines.push(`            // Assume it's a wrapped pointer`);
-          lines.push(`            ${paramName} = *static_cast<${paramType}*>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
-          lines.push(`        }`);
-          lines.push(`    }`);
-        } else if (
-          TypeMapper.isPointerType(paramType) &&
-          !TypeMapper.isStringType(paramType)
-        ) {
-          // Handle pointer types (including typedef pointers)
-          // Need to dereference because unwrapPointer returns a pointer to the stored pointer
-          lines.push(
-            `    ${paramType} ${paramName} = *static_cast<${paramType}*>(unwrapPointer(info[${i}].As<Napi::Object>()));`,
-          );
-        } else if (paramType.endsWith(' *') && TypeMapper.isEnumType(paramType.replace(' *', ''))) {
-          // Handle enum pointers
-          const enumType = paramType.replace(' *', '');
-          lines.push(`    ${enumType} ${paramName}_val = static_cast<${enumType}>(info[${i}].As<Napi::Number>().Int32Value());`);
-          lines.push(`    ${enumType}* ${paramName} = &${paramName}_val;`);
-        } else if (paramType === 'size_t') {
-          // Handle size_t as number
-          lines.push(
-            `    size_t ${paramName} = info[${i}].As<Napi::Number>().Uint32Value();`,
-          );
-        } else if (TypeMapper.isStringType(paramType)) {
-          // Handle string parameters - need to keep the string alive
-          lines.push(
-            `    std::string ${paramName}_str = info[${i}].As<Napi::String>().Utf8Value();`,
-          );
-          lines.push(
-            `    const char* ${paramName} = ${paramName}_str.c_str();`,
-          );
-        } else if (mapping.needsConversion) {
-          lines.push(
-            `    auto ${paramName} = ${TypeMapper.getNapiToC(`info[${i}]`, paramType)};`,
-          );
+    return units;
+  }
+
+  // Body of <Struct>_get_<field>: converts ptr->field to a JS value
+  private generateFieldGetter(field: StructField): string[] {
+    const lines: string[] = [];
+
+    if (TypeMapper.isArrayType(field.type)) {
+      const elementType = TypeMapper.getArrayElementType(field.type);
+      if (elementType === 'char') {
+        // Return string arrays as strings
+        lines.push(`    return Napi::String::New(env, ptr->${field.name});`);
+      } else if (TypeMapper.getTypedArrayName(elementType)) {
+        // Numeric arrays are copied out as a TypedArray of the same element type
+        lines.push(`    return arrayFieldToTypedArray(env, ptr->${field.name});`);
+      } else {
+        // Return numeric arrays as JS arrays
+        lines.push(`    Napi::Array arr = Napi::Array::New(env);`);
+        lines.push(`    size_t arraySize = sizeof(ptr->${field.name})/sizeof(ptr->${field.name}[0]);`);
+        lines.push(`    for (size_t i = 0; i < arraySize; i++) {`);
+        if (elementType === 'void *' || elementType === 'const void *') {
+          lines.push(`        arr.Set(i, Napi::External<void>::New(env, const_cast<void*>(ptr->${field.name}[i])));`);
         } else {
-          lines.push(`    auto ${paramName} = info[${i}];`);
+          lines.push(`        arr.Set(i, ${TypeMapper.getCToNapi(`ptr->${field.name}[i]`, elementType)});`);
         }
+        lines.push(`    }`);
+        lines.push(`    return arr;`);
       }
+    } else if (TypeMapper.isViewStructType(field.type)) {
+      // ArrayBuffer-backed structs are copied out into a new buffer
+      lines.push(`    return returnView(env, env.Undefined(), &ptr->${field.name}, sizeof(ptr->${field.name}));`);
+    } else if (TypeMapper.isPodStructType(field.type)) {
+      // Small POD structs are copied out as plain objects
+      const podName = TypeMapper.sanitizeIdentifier(TypeMapper.getPodStructName(field.type)!);
+      lines.push(`    return ${podName}_toValue(env, ptr->${field.name});`);
+    } else if (TypeMapper.isStructType(field.type)) {
+      // Return nested structs as new wrapped pointers
+      lines.push(`    ${field.type}* fieldPtr = new ${field.type}(ptr->${field.name});`);
+      lines.push(`    return wrapPointer(env, fieldPtr, "${field.type}");`);
+    } else if (TypeMapper.isFunctionPointerType(field.type)) {
+      // Handle function pointers - return as external pointer
+      lines.push(`    return Napi::External<void>::New(env, reinterpret_cast<void*>(ptr->${field.name}));`);
+    } else if (TypeMapper.isPointerType(field.type) && field.type.includes('const')) {
+      // Handle const pointers specially
+      const baseType = field.type.replace(/\s*\*\s*$/, '').replace(/^const\s+/, '');
+      lines.push(`    return wrapConstPointer(env, ptr->${field.name}, "${baseType}");`);
+    } else if (TypeMapper.isPointerType(field.type)) {
+      // Handle regular pointers
+      const baseType = field.type.replace(/\s*\*\s*$/, '');
+      lines.push(`    return wrapPointer(env, ptr->${field.name}, "${baseType}");`);
+    } else if (TypeMapper.isEnumType(field.type)) {
+      // Handle enum fields - return as number
+      lines.push(`    return Napi::Number::New(env, static_cast<int>(ptr->${field.name}));`);
+    } else {
+      // Handle regular types
+      lines.push(`    return ${TypeMapper.getCToNapi(`ptr->${field.name}`, field.type)};`);
+    }
 
-      lines.push(`    `);
-
-      // Special handling for clang_visitChildren - all parameters have been processed above
-      // No need to process anymore, just generate the call
+    return lines;
+  }
 
-      // Call the function
-      const returnType = func.return.spelling;
-      const paramNames = func.params
-        .map((p, i) => p.name || `arg${i}`)
-        .join(', ');
-
-      if (TypeMapper.isVoidType(returnType)) {
-        lines.push(`    ${func.name}(${paramNames});`);
-        lines.push(`    return env.Undefined();`);
-      } else if (TypeMapper.isStructType(returnType)) {
-        // Struct returned by value - allocate on heap and wrap as pointer
-        lines.push(`    ${returnType} result = ${func.name}(${paramNames});`);
-        lines.push(`    ${returnType}* resultPtr = new ${returnType}(result);`);
-        lines.push(`    return wrapOwnedPointer(env, resultPtr, "${returnType}");`);
-      } else if (TypeMapper.isPointerType(returnType)) {
-        // Handle pointer types (including typedefs to pointers like CXTranslationUnit)
-        lines.push(`    ${returnType} result = ${func.name}(${paramNames});`);
-        // For typedef pointers, we need to create a heap-allocated copy to match unwrap expectations
-        lines.push(`    ${returnType}* resultPtr = new ${returnType};`);
-        lines.push(`    *resultPtr = result;`);
-        lines.push(`    return wrapOwnedPointer(env, resultPtr, "${returnType}");`);
+  // Body of <Struct>_set_<field>: stores the JS `value` into ptr->field
+  private generateFieldSetter(field: StructField): string[] {
+    const lines: string[] = [];
+
+    if (TypeMapper.isArrayType(field.type)) {
+      // Handle arrays specially
+      const elementType = TypeMapper.getArrayElementType(field.type);
+      if (elementType === 'char') {
+        // String arrays - copy as C strings, or raw bytes from a byte array
+        lines.push(`    if (typedArrayToArrayField(value, ptr->${field.name})) {`);
+        lines.push(`        ptr->${field.name}[sizeof(ptr->${field.name}) - 1] = '\\0';`);
+        lines.push(`    } else {`);
+        lines.push(`        std::string str = value.As<Napi::String>().Utf8Value();`);
+        lines.push(`        strncpy(ptr->${field.name}, str.c_str(), sizeof(ptr->${field.name}) - 1);`);
+        lines.push(`        ptr->${field.name}[sizeof(ptr->${field.name}) - 1] = '\\0';`);
+        lines.push(`    }`);
+      } else if (TypeMapper.getTypedArrayName(elementType)) {
+        // Numeric arrays - one memcpy from a matching TypedArray, else per element
+        lines.push(`    if (!typedArrayToArrayField(value, ptr->${field.name}) && value.IsArray()) {`);
+        lines.push(`        Napi::Array arr = value.As<Napi::Array>();`);
+        lines.push(`        for (size_t i = 0; i < arr.Length() && i < sizeof(ptr->${field.name})/sizeof(ptr->${field.name}[0]); i++) {`);
+        lines.push(`            ptr->${field.name}[i] = ${TypeMapper.getNapiToC('arr.Get(i)', elementType)};`);
+        lines.push(`        }`);
+        lines.push(`    }`);
       } else {
-        lines.push(`    auto result = ${func.name}(${paramNames});`);
-        if (TypeMapper.isEnumType(returnType)) {
-          // Return enums as numbers
-          lines.push(`    return Napi::Number::New(env, static_cast<int>(result));`);
-        } else if (TypeMapper.isStringType(returnType)) {
-          // Handle string returns - check for null
-          lines.push(`    if (result == nullptr) {`);
-          lines.push(`        return env.Null();`);
-          lines.push(`    }`);
-          lines.push(`    return Napi::String::New(env, result);`);
+        // Numeric arrays - copy from JS array
+        lines.push(`    Napi::Array arr = value.As<Napi::Array>();`);
+        lines.push(`    for (size_t i = 0; i < arr.Length() && i < sizeof(ptr->${field.name})/sizeof(ptr->${field.name}[0]); i++) {`);
+        if (elementType === 'void *' || elementType === 'const void *') {
+          lines.push(`        if (arr.Get(i).IsExternal()) {`);
+          lines.push(`            ptr->${field.name}[i] = arr.Get(i).As<Napi::External<void>>().Data();`);
+          lines.push(`        } else {`);
+          lines.push(`            ptr->${field.name}[i] = nullptr;`);
+          lines.push(`        }`);
         } else {
-          lines.push(
-            `    return ${TypeMapper.getCToNapi('result', returnType)};`,
-          );
+          lines.push(`        ptr->${field.name}[i] = ${TypeMapper.getNapiToC('arr.Get(i)', elementType)};`);
         }
+        lines.push(`    }`);
+      }
+    } else if (TypeMapper.isViewStructType(field.type)) {
+      // ArrayBuffer-backed structs are copied in from any view of their bytes
+      lines.push(`    if (const void* src = viewData(value, sizeof(ptr->${field.name}))) {`);
+      lines.push(`        memcpy(&ptr->${field.name}, src, sizeof(ptr->${field.name}));`);
+      lines.push(`    }`);
+    } else if (TypeMapper.isPodStructType(field.type)) {
+      // Small POD structs are copied in from plain objects
+      const podName = TypeMapper.sanitizeIdentifier(TypeMapper.getPodStructName(field.type)!);
+      lines.push(`    ${podName}_fromValue(value, &ptr->${field.name});`);
+    } else if (TypeMapper.isStructType(field.type)) {
+      // Handle nested structs - unwrap pointer and copy struct
+      lines.push(`    ${field.type}* fieldPtr = static_cast<${field.type}*>(unwrapPointer(value.As<Napi::Object>()));`);
+      lines.push(`    if (fieldPtr) {`);
+      lines.push(`        ptr->${field.name} = *fieldPtr;`);
+      lines.push(`    }`);
+    } else if (TypeMapper.isEnumType(field.type)) {
+      // Handle enum types with explicit casting
+      lines.push(`    ptr->${field.name} = static_cast<${field.type}>(value.As<Napi::Number>().Int32Value());`);
+    } else if (TypeMapper.isFunctionPointerType(field.type)) {
+      // Handle function pointer fields - they can be passed as External
+      lines.push(`    if (value.IsExternal()) {`);
+      lines.push(`        ptr->${field.name} = reinterpret_cast<${field.type}>(value.As<Napi::External<void>>().Data());`);
+      lines.push(`    } else {`);
+      lines.push(`        ptr->${field.name} = nullptr;`);
+      lines.push(`    }`);
+    } else if (TypeMapper.isStringType(field.type)) {
+      // Special handling for string fields - store the string and keep it alive
+      lines.push(`    // Note: String lifetime management needed for production use`);
+      lines.push(`    std::string str = value.As<Napi::String>().Utf8Value();`);
+      lines.push(`    ptr->${field.name} = str.c_str();`);
+    } else if (field.type === 'void *' || field.type === 'void*') {
+      // Handle void* fields specifically
+      lines.push(`    if (value.IsExternal()) {`);
+      lines.push(`        ptr->${field.name} = value.As<Napi::External<void>>().Data();`);
+      lines.push(`    } else {`);
+      lines.push(`        ptr->${field.name} = nullptr;`);
+      lines.push(`    }`);
+    } else if (field.type.includes('*')) {
+      // Handle ALL pointer types (including ones not caught by isPointerType)
+      lines.push(`    if (value.IsObject()) {`);
+      lines.push(`        ptr->${field.name} = static_cast<${field.type}>(unwrapPointer(value.As<Napi::Object>()));`);
+      lines.push(`    } else {`);
+      lines.push(`        // null, undefined or an invalid value for a pointer field`);
+      lines.push(`        ptr->${field.name} = nullptr;`);
+      lines.push(`    }`);
+    } else {
+      // Handle regular types (non-pointers)
+      const mapping = TypeMapper.getMapping(field.type);
+      if (mapping.needsConversion) {
+        lines.push(`    ptr->${field.name} = ${TypeMapper.getNapiToC('value', field.type)};`);
+      } else {
+        lines.push(`    ptr->${field.name} = value;`);
       }
+    }
 
-      lines.push(`}`);
+    return lines;
+  }
+
+  // Type tags (and disposers) of struct results returned through wrap<&fn>
+  private generateTemplateTypeNames(): string[] {
+    const lines: string[] = [];
+    for (const [, spelling] of this.templateTypeNames) {
+      lines.push(
+        `template <> struct BindingTypeName<${spelling}> { static constexpr const char* value = "${spelling}"; };`,
+      );
+      const disposer = TypeMapper.getDisposer(spelling);
+      if (disposer) {
+        lines.push(
+          `template <> struct BindingDisposer<${spelling}> { static constexpr void (*dispose)(${spelling}) = ${disposer}; };`,
+        );
+      }
+    }
+    if (this.templateTypeNames.size > 0) {
       lines.push('');
     }
+    return lines;
+  }
+
+  private generateFunctionWrappers(sortedFunctions: NonNullable<HeaderAST['functions']>): WrapperUnit[] {
+    const units: WrapperUnit[] = [];
+
+    for (const func of sortedFunctions) {
+      const safeName = TypeMapper.sanitizeIdentifier(func.name);
+      const wrapperName = `${safeName}_wrapper`;
+
+      // Skip if we've already generated this function, or wrap<&fn> or
+      // disposeArg handles it
+      if (this.generatedFunctions.has(wrapperName) || this.templateWrapped.has(func.name) || this.isDisposer(func)) {
+        continue;
+      }
+      this.generatedFunctions.add(wrapperName);
+
+      units.push({ name: func.name, lines: [this.cachedFunctionWrapper(func)] });
+    }
+
+    return units;
+  }
+
+  // Reuses the previous run's text for a wrapper whose declaration and
+  // generation context are unchanged
+  private cachedFunctionWrapper(func: NonNullable<HeaderAST['functions']>[number]): string {
+    if (!this.wrapperCache) {
+      return this.generateFunctionWrapper(func);
+    }
+    const key = hashContent(this.wrapperContext, JSON.stringify(func));
+    let text = this.wrapperCache.get(key);
+    if (text === undefined) {
+      text = this.generateFunctionWrapper(func);
+      this.wrapperStats.generated++;
+    } else {
+      this.wrapperStats.reused++;
+    }
+    this.usedWrappers.set(key, text);
+    return text;
+  }
+
+  private generateFunctionWrapper(func: NonNullable<HeaderAST['functions']>[number]): string {
+    const lines: string[] = [];
+    const wrapperName = `${TypeMapper.sanitizeIdentifier(func.name)}_wrapper`;
+
+    if (func.documentation) {
+      lines.push(this.formatComment(func.documentation));
+    }
+
+    lines.push(
+      `static Napi::Value ${wrapperName}(const Napi::CallbackInfo& info) {`,
+    );
+    lines.push(`    Napi::Env env = info.Env();`);
+    lines.push(`    `);
+
+    // (T *data, size_t n) pairs take a TypedArray, with n defaulting to its
+    // length (so a trailing n may be omitted)
+    const typedArrayParams = TypeMapper.getTypedArrayParams(func.params);
+    const typedArrayLengths = new Map([...typedArrayParams].map(([data, length]) => [length, data]));
+    // JS functions for callback typedefs; the user-data argument that
+    // carries them is optional when last
+    const callbackParams = TypeMapper.getCallbackParams(func.params);
+    const userDataOf = new Map(
+      [...callbackParams].flatMap(([index, { userData }]) => (userData !== undefined ? [[userData, index]] : [])),
+    );
+    const lastParam = func.params.length - 1;
+    const requiredParams =
+      typedArrayLengths.has(lastParam) || userDataOf.has(lastParam) ? lastParam : func.params.length;
+
+    // Parameter validation
+    if (requiredParams > 0) {
+      lines.push(`    if (info.Length() < ${requiredParams}) {`);
+      lines.push(
+        `        Napi::TypeError::New(env, "Expected ${requiredParams} arguments").ThrowAsJavaScriptException();`,
+      );
+      lines.push(`        return env.Undefined();`);
+      lines.push(`    }`);
+      lines.push(`    `);
+    }
+
+    // Convert parameters
+    for (let i = 0; i < func.params.length; i++) {
+      const param = func.params[i];
+      if (!param) continue;
+      const paramName = param.name || `arg${i}`;
+      const paramType = param.type.spelling;
+
+      lines.push(`    // Parameter: ${paramName} (${paramType})`);
+
+      const mapping = TypeMapper.getMapping(paramType);
+      const podName = TypeMapper.getPodStructName(paramType);
+      const viewName = TypeMapper.getViewStructName(paramType);
+      const viewPointerName = TypeMapper.getViewStructPointerName(paramType);
+      const lengthOf = typedArrayLengths.get(i);
+      const callback = callbackParams.get(i);
+      const userDataFor = userDataOf.get(i);
+      if (callback) {
+        // JS function through the typedef's trampoline, or a native pointer
+        const { signature } = callback;
+        const sync = signature.mode === 'sync';
+        if (sync) {
+          lines.push(`    JsCallback ${paramName}_sync;`);
+        }
+        lines.push(`    JsCallback* ${paramName}_js;`);
+        // Owner for the child handles the trampoline passes to JS
+        const pin = TypeMapper.getCallbackPinSource(func, signature);
+        const owner = pin
+          ? `, ${pin.isOwner ? `info[${pin.index}]` : `pinnedOwner(env, info[${pin.index}])`}`
+          : '';
+        this.pushCheckedParam(
+          lines,
+          `${paramType} ${paramName}`,
+          `callbackArg(env, info[${i}], ${signature.name}_trampoline, ${sync ? `&${paramName}_sync` : 'nullptr'}, &${paramName}, &${paramName}_js${owner})`,
+        );
+        // Threadsafe typedefs always have user data (see setCallbackTypes)
+        if (signature.userData === undefined) {
+          lines.push(`    JsCallbackSlot ${paramName}_slot(&${signature.name}_current, ${paramName}_js);`);
+        }
+      } else if (userDataFor !== undefined) {
+        // User data: the trampoline's JsCallback for a JS function, otherwise
+        // passed through to a native callback
+        const callbackName = func.params[userDataFor]!.name || `arg${userDataFor}`;
+        lines.push(`    ${paramType} ${paramName} = ${callbackName}_js;`);
+        lines.push(`    if (!${callbackName}_js && !info[${i}].IsNull() && !info[${i}].IsUndefined()) {`);
+        lines.push(`        void* ${paramName}_ptr;`);
+        lines.push(`        if (!unwrapArg(env, info[${i}], &${paramName}_ptr)) {`);
+        lines.push(`            return env.Undefined();`);
+        lines.push(`        }`);
+        lines.push(`        ${paramName} = *static_cast<${paramType}*>(${paramName}_ptr);`);
+        lines.push(`    }`);
+      } else if (typedArrayParams.has(i)) {
+        // Numeric buffer - used in place from a TypedArray of its element
+        // type; wrapped pointers still work but have no known length
+        const elementType = TypeMapper.getTypedArrayPointerElement(paramType)!.replace(/^const\s+/, '');
+        lines.push(`    size_t ${paramName}_length = 0;`);
+        lines.push(`    ${paramType} ${paramName} = typedArrayData<${elementType}>(info[${i}], &${paramName}_length);`);
+        lines.push(`    if (!${paramName} && info[${i}].IsObject()) {`);
+        lines.push(`        if (void* wrapped = unwrapPointer(info[${i}].As<Napi::Object>())) {`);
+        lines.push(`            ${paramName} = *static_cast<${paramType}*>(wrapped);`);
+        lines.push(`            ${paramName}_length = SIZE_MAX;`);
+        lines.push(`        }`);
+        lines.push(`    }`);
+      } else if (lengthOf !== undefined) {
+        // Element count for the preceding buffer: defaults to the TypedArray's
+        // length and may not exceed it
+        const dataName = func.params[lengthOf]!.name || `arg${lengthOf}`;
+        lines.push(`    if (info[${i}].IsUndefined() && ${dataName}_length == SIZE_MAX) {`);
+        lines.push(
+          `        Napi::TypeError::New(env, "Expected ${paramName} for a wrapped ${dataName} pointer").ThrowAsJavaScriptException();`,
+        );
+        lines.push(`        return env.Undefined();`);
+        lines.push(`    }`);
+        lines.push(
+          `    ${paramType} ${paramName} = info[${i}].IsUndefined() ? static_cast<${paramType}>(${dataName}_length) : ${TypeMapper.getNapiToC(`info[${i}]`, TypeMapper.resolveTypedef(paramType))};`,
+        );
+        lines.push(`    if (static_cast<size_t>(${paramName}) > ${dataName}_length) {`);
+        lines.push(
+          `        Napi::RangeError::New(env, "${paramName} exceeds the length of ${dataName}").ThrowAsJavaScriptException();`,
+        );
+        lines.push(`        return env.Undefined();`);
+        lines.push(`    }`);
+      } else if (viewName) {
+        // ArrayBuffer-backed struct passed by value - copied from its bytes
+        lines.push(`    const void* ${paramName}_view = viewData(info[${i}], sizeof(${viewName}));`);
+        lines.push(`    if (!${paramName}_view) {`);
+        lines.push(
+          `        Napi::TypeError::New(env, "Expected ${viewName} view for ${paramName}").ThrowAsJavaScriptException();`,
+        );
+        lines.push(`        return env.Undefined();`);
+        lines.push(`    }`);
+        lines.push(`    ${viewName} ${paramName};`);
+        lines.push(`    memcpy(&${paramName}, ${paramName}_view, sizeof(${viewName}));`);
+      } else if (viewPointerName) {
+        // Pointer to an ArrayBuffer-backed struct - the callee works on the
+        // view's bytes in place (null when no view is given)
+        lines.push(
+          `    ${paramType} ${paramName} = static_cast<${paramType}>(viewData(info[${i}], sizeof(${viewPointerName})));`,
+        );
+      } else if (podName) {
+        // Small POD struct passed by value - copied from a plain object
+        lines.push(`    ${podName} ${paramName};`);
+        lines.push(`    if (!${TypeMapper.sanitizeIdentifier(podName)}_fromValue(info[${i}], &${paramName})) {`);
+        lines.push(
+          `        Napi::TypeError::New(env, "Expected ${podName} object for ${paramName}").ThrowAsJavaScriptException();`,
+        );
+        lines.push(`        return env.Undefined();`);
+        lines.push(`    }`);
+      } else if (TypeMapper.isStructType(paramType)) {
+        // Struct passed by value - unwrap the pointer and dereference
+        this.pushCheckedParam(lines, `void* ${paramName}_ptr`, `unwrapArg(env, info[${i}], &${paramName}_ptr)`);
+        lines.push(`    ${paramType} ${paramName} = *static_cast<${paramType}*>(${paramName}_ptr);`);
+      } else if (TypeMapper.isEnumType(paramType)) {
+        // Enum parameters are read as int32
+        this.pushCheckedParam(
+          lines,
+          `${paramType.replace(/^const\s+/, '')} ${paramName}`,
+          `fromNapi(env, info[${i}], &${paramName})`,
+        );
+      } else if (TypeMapper.isFunctionPointerType(paramType)) {
+        // Handle function pointers - they're passed as External
+        lines.push(`    // Parameter: ${paramName} (${paramType})`);
+        // For function pointers like "void (*)(void *)", we need to insert the variable name
+        // in the middle: "void (*fn)(void *)"
+        let declarationType = paramType;
+        if (paramType.includes('(*)')) {
+          declarationType = paramType.replace('(*)', `(*${paramName})`);
+          lines.push(`    ${declarationType} = nullptr;`);
+        } else {
+          // For typedef'd function pointers like MathFunc
+          lines.push(`    ${paramType} ${paramName} = nullptr;`);
+        }
+        lines.push(`    if (info[${i}].IsExternal()) {`);
+        lines.push(`        ${paramName} = reinterpret_cast<${paramType}>(info[${i}].As<Napi::External<void>>().Data());`);
+        lines.push(`    }`);
+      } else if (TypeMapper.isStructPointer(paramType)) {
+        // Handle struct pointers (including const)
+        // Allow null/undefined for optional struct pointers
+        lines.push(`    ${paramType} ${paramName} = nullptr;`);
+        lines.push(`    if (!info[${i}].IsNull() && !info[${i}].IsUndefined() && info[${i}].IsObject()) {`);
+        lines.push(`        ${paramName} = static_cast<${paramType}>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
+        lines.push(`    }`);
+      } else if (paramType === 'int *' && func.name === 'clang_getFileContents' && paramName === 'size') {
+        // Special-case: some platforms resolve size_t* to int* in headers; ensure correct type for libclang API
+        lines.push(`    size_t * ${paramName} = static_cast<size_t *>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
+      } else if (paramType === 'size_t *' || paramType === 'int *') {
+        // Handle integer pointer buffers via wrapped pointers
+        if (paramType === 'size_t *') {
+          lines.push(`    size_t * ${paramName} = static_cast<size_t *>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
+        } else {
+          lines.push(`    int * ${paramName} = static_cast<int *>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
+        }
+      } else if (paramType === 'const char *const *' || paramType === 'const char * const *' || paramType === 'char **') {
+        // Handle string array parameters (usually for command-line args)
+        // These can be null or a JavaScript array of strings
+        lines.push(`    ${paramType} ${paramName} = nullptr;`);
+        lines.push(`    std::vector<std::string> ${paramName}_strings;`);
+        if (paramType === 'char **') {
+          // For non-const char**, we need a vector of char*
+          lines.push(`    std::vector<char*> ${paramName}_cstrs;`);
+          lines.push(`    if (!info[${i}].IsNull() && !info[${i}].IsUndefined()) {`);
+          lines.push(`        if (info[${i}].IsArray()) {`);
+          lines.push(`            Napi::Array arr = info[${i}].As<Napi::Array>();`);
+          lines.push(`            for (uint32_t j = 0; j < arr.Length(); j++) {`);
+          lines.push(`                ${paramName}_strings.push_back(arr.Get(j).As<Napi::String>().Utf8Value());`);
+          lines.push(`            }`);
+          lines.push(`            for (auto& s : ${paramName}_strings) {`);
+          lines.push(`                ${paramName}_cstrs.push_back(const_cast<char*>(s.c_str()));`);
+          lines.push(`            }`);
+          lines.push(`            ${paramName} = ${paramName}_cstrs.data();`);
+        } else {
+          lines.push(`    std::vector<const char*> ${paramName}_cstrs;`);
+          lines.push(`    if (!info[${i}].IsNull() && !info[${i}].IsUndefined()) {`);
+          lines.push(`        if (info[${i}].IsArray()) {`);
+          lines.push(`            Napi::Array arr = info[${i}].As<Napi::Array>();`);
+          lines.push(`            for (uint32_t j = 0; j < arr.Length(); j++) {`);
+          lines.push(`                ${paramName}_strings.push_back(arr.Get(j).As<Napi::String>().Utf8Value());`);
+          lines.push(`            }`);
+          lines.push(`            for (const auto& s : ${paramName}_strings) {`);
+          lines.push(`                ${paramName}_cstrs.push_back(s.c_str());`);
+          lines.push(`            }`);
+          lines.push(`            ${paramName} = ${paramName}_cstrs.data();`)
+        };
+        lines.push(`        } else if (info[${i}].IsObject()) {`);
+        lines.push(`            // Assume it's a wrapped pointer`);
+        lines.push(`            ${paramName} = *static_cast<${paramType}*>(unwrapPointer(info[${i}].As<Napi::Object>()));`);
+        lines.push(`        }`);
+        lines.push(`    }`);
+      } else if (
+        TypeMapper.isPointerType(paramType) &&
+        !TypeMapper.isStringType(paramType)
+      ) {
+        // Handle pointer types (including typedef pointers)
+        // Need to dereference because unwrapArg returns a pointer to the stored pointer
+        this.pushCheckedParam(lines, `void* ${paramName}_ptr`, `unwrapArg(env, info[${i}], &${paramName}_ptr)`);
+        lines.push(`    ${paramType} ${paramName} = *static_cast<${paramType}*>(${paramName}_ptr);`);
+      } else if (paramType.endsWith(' *') && TypeMapper.isEnumType(paramType.replace(' *', ''))) {
+        // Handle enum pointers
+        const enumType = paramType.replace(' *', '');
+        lines.push(`    ${enumType} ${paramName}_val = static_cast<${enumType}>(info[${i}].As<Napi::Number>().Int32Value());`);
+        lines.push(`    ${enumType}* ${paramName} = &${paramName}_val;`);
+      } else if (paramType === 'size_t') {
+        // Handle size_t as number
+        this.pushCheckedParam(lines, `size_t ${paramName}`, `fromNapi(env, info[${i}], &${paramName})`);
+      } else if (TypeMapper.isStringType(paramType)) {
+        // Handle string parameters - need to keep the string alive
+        this.pushCheckedParam(
+          lines,
+          `std::string ${paramName}_str`,
+          `fromNapi(env, info[${i}], &${paramName}_str)`,
+        );
+        lines.push(
+          `    const char* ${paramName} = ${paramName}_str.c_str();`,
+        );
+      } else if (TypeMapper.getNapiToCChecked(`info[${i}]`, paramType, paramName)) {
+        this.pushCheckedParam(
+          lines,
+          `${paramType.replace(/^const\s+/, '')} ${paramName}`,
+          TypeMapper.getNapiToCChecked(`info[${i}]`, paramType, paramName)!,
+        );
+      } else if (mapping.needsConversion) {
+        lines.push(
+          `    auto ${paramName} = ${TypeMapper.getNapiToC(`info[${i}]`, paramType)};`,
+        );
+      } else {
+        lines.push(`    auto ${paramName} = info[${i}];`);
+      }
+    }
+
+    lines.push(`    `);
+
+    // A child pinned to its owner hands back the owner's own wrapper
+    const ownerSource = TypeMapper.getOwnerSource(func);
+    if (ownerSource !== undefined) {
+      lines.push(`    if (napi_value owner = pinnedOwner(env, info[${ownerSource}])) {`);
+      lines.push(`        return Napi::Value(env, owner);`);
+      lines.push(`    }`);
+    }
+
+    // Call the function
+    const returnType = func.return.spelling;
+    const paramNames = func.params
+      .map((p, i) => p.name || `arg${i}`)
+      .join(', ');
+
+    if (TypeMapper.isVoidType(returnType)) {
+      lines.push(`    ${func.name}(${paramNames});`);
+      lines.push(`    return env.Undefined();`);
+    } else if (TypeMapper.isViewStructType(returnType)) {
+      // ArrayBuffer-backed struct returned by value - written to the optional
+      // trailing output view, or to a new buffer
+      lines.push(`    ${returnType} result = ${func.name}(${paramNames});`);
+      lines.push(`    return returnView(env, info[${func.params.length}], &result, sizeof(result));`);
+    } else if (TypeMapper.isPodStructType(returnType)) {
+      // Small POD struct returned by value - no heap copy
+      lines.push(`    ${returnType} result = ${func.name}(${paramNames});`);
+      lines.push(`    return ${TypeMapper.getCToNapi('result', returnType)};`);
+    } else if (TypeMapper.isStructType(returnType)) {
+      // Struct returned by value - allocate on heap and wrap as pointer
+      lines.push(`    ${returnType} result = ${func.name}(${paramNames});`);
+      lines.push(`    ${returnType}* resultPtr = new ${returnType}(result);`);
+      this.pushHandleResult(lines, func, 'resultPtr');
+    } else if (TypeMapper.isPointerType(returnType)) {
+      // Handle pointer types (including typedefs to pointers like CXTranslationUnit)
+      lines.push(`    ${returnType} result = ${func.name}(${paramNames});`);
+      // For typedef pointers, we need to create a heap-allocated copy to match unwrap expectations
+      lines.push(`    ${returnType}* resultPtr = new ${returnType};`);
+      lines.push(`    *resultPtr = result;`);
+      this.pushHandleResult(lines, func, 'resultPtr');
+    } else {
+      lines.push(`    auto result = ${func.name}(${paramNames});`);
+      if (TypeMapper.isEnumType(returnType)) {
+        // Return enums as numbers
+        lines.push(`    return Napi::Number::New(env, static_cast<int>(result));`);
+      } else if (TypeMapper.isStringType(returnType)) {
+        // Handle string returns - check for null
+        lines.push(`    if (result == nullptr) {`);
+        lines.push(`        return env.Null();`);
+        lines.push(`    }`);
+        lines.push(`    return Napi::String::New(env, result);`);
+      } else {
+        lines.push(
+          `    return ${TypeMapper.getCToNapi('result', returnType)};`,
+        );
+      }
+    }
+
+    lines.push(`}`);
+    lines.push('');
 
     return lines.join('\n');
   }
 
-  private generateModuleInit(): string {
-    const lines: string[] = [
-      `static Napi::Object Init(Napi::Env env, Napi::Object exports) {`,
-    ];
+  // Returns a heap copy of a record or handle result. A handle the function
+  // hands over (one with a dispose function) is disposed with its wrapper,
+  // and a child handle pins its owner.
+  private pushHandleResult(lines: string[], func: NonNullable<HeaderAST['functions']>[number], ptrVar: string): void {
+    const returnType = func.return.spelling;
+    const disposer = TypeMapper.getOwnerSource(func) === undefined ? TypeMapper.getDisposer(returnType) : undefined;
+    const wrapped = disposer
+      ? `Napi::Value(env, wrapDisposable<${returnType}, &${disposer}>(env, ${ptrVar}, "${returnType}"))`
+      : `wrapOwnedPointer(env, ${ptrVar}, "${returnType}")`;
+    const pin = TypeMapper.getPinSource(func);
+    if (!pin) {
+      lines.push(`    return ${wrapped};`);
+      return;
+    }
+    lines.push(`    Napi::Value resultHandle = ${wrapped};`);
+    lines.push(`    pinOwner(env, resultHandle, info[${pin.index}], ${pin.isOwner}, ${disposer !== undefined});`);
+    lines.push(`    return resultHandle;`);
+  }
+
+  // Declares a parameter and fills it with a raw napi conversion, returning
+  // early when the argument has the wrong type (the TypeError is pending)
+  private pushCheckedParam(lines: string[], declaration: string, conversion: string): void {
+    lines.push(`    ${declaration};`);
+    lines.push(`    if (!${conversion}) {`);
+    lines.push(`        return env.Undefined();`);
+    lines.push(`    }`);
+  }
+
+  // Every export's property descriptor, in export order
+  private exportDescriptors(): ExportDescriptor[] {
+    const descriptors: ExportDescriptor[] = [];
+    const addFunction = (name: string, wrapper: string, unit?: string) => {
+      descriptors.push({
+        unit,
+        descriptor: `        {"${name}", nullptr, napiCallback<${wrapper}>, nullptr, nullptr, nullptr, napi_default_jsproperty, nullptr},`,
+      });
+    };
+    const addLazy = (name: string, getter: string, data: string) => {
+      descriptors.push({
+        descriptor: `        {"${name}", nullptr, nullptr, ${getter}, nullptr, nullptr, kLazyExport, exportData(${data})},`,
+      });
+    };
 
     // Track exported names to avoid duplicates
     const exportedNames = new Set<string>();
 
-    // Export enum constants
+    // Export enum constants (numbers are created on first access)
     for (const enumDef of this.ast.enums) {
       for (const constant of enumDef.constants) {
-        const safeName = TypeMapper.sanitizeIdentifier(constant.name);
-        const functionName = `Get_${safeName}`;
-
-        // Only export if we actually generated this constant
-        if (
-          this.generatedConstants.has(functionName) &&
-          !exportedNames.has(constant.name)
-        ) {
-          // Export as a direct number value, not as a function
-          lines.push(
-            `    exports.Set("${constant.name}", Napi::Number::New(env, ${constant.name}));`,
-          );
+        const ref = this.enumConstantRefs.get(constant.name);
+        if (ref && !exportedNames.has(constant.name)) {
+          addLazy(constant.name, 'getEnumConstant', ref);
           exportedNames.add(constant.name);
         }
       }
     }
 
+    // Export enums as frozen objects, built on first access
+    for (const { name, table } of this.enumTables) {
+      if (!exportedNames.has(name)) {
+        addLazy(name, 'getEnumObject', `&${table}`);
+        exportedNames.add(name);
+      }
+    }
+    if (this.enumTables.length > 0 && !exportedNames.has('enumName')) {
+      addFunction('enumName', 'bindingEnumName');
+      exportedNames.add('enumName');
+    }
+
     // Export struct creators
     for (const struct of this.ast.structs) {
       if (!struct.name) continue;
@@ -734,18 +2490,14 @@ static Napi::Object wrapOwnedPointer(Napi::Env env, T* ptr, const std::string& t
         this.generatedStructs.has(createFunctionName) &&
         !exportedNames.has(createName)
       ) {
-        lines.push(
-          `    exports.Set("${createName}", Napi::Function::New(env, ${createFunctionName}));`,
-        );
+        addFunction(createName, createFunctionName, structName);
         exportedNames.add(createName);
       }
       if (
         this.generatedStructs.has(getFieldFunctionName) &&
         !exportedNames.has(getName)
       ) {
-        lines.push(
-          `    exports.Set("${getName}", Napi::Function::New(env, ${getFieldFunctionName}));`,
-        );
+        addFunction(getName, getFieldFunctionName, structName);
         exportedNames.add(getName);
       }
     }
@@ -753,12 +2505,80 @@ static Napi::Object wrapOwnedPointer(Napi::Env env, T* ptr, const std::string& t
     // Export functions
     for (const func of this.ast.functions || []) {
       const safeName = TypeMapper.sanitizeIdentifier(func.name);
-      if (!exportedNames.has(func.name)) {
-        lines.push(
-          `    exports.Set("${func.name}", Napi::Function::New(env, ${safeName}_wrapper));`,
-        );
-        exportedNames.add(func.name);
+      if (exportedNames.has(func.name)) continue;
+      const pin = TypeMapper.getPinSource(func);
+      if (this.isDisposer(func)) {
+        const handleType = func.params[0]!.type.spelling.replace(/^const\s+/, '');
+        descriptors.push({
+          unit: func.name,
+          descriptor: `        {"${func.name}", nullptr, disposeArg<${handleType}, &${func.name}>, nullptr, nullptr, nullptr, napi_default_jsproperty, nullptr},`,
+        });
+      } else if (this.templateWrapped.has(func.name)) {
+        const holdOwner = TypeMapper.getDisposer(func.return.spelling) !== undefined;
+        const callback = pin
+          ? `wrapPinned<&${func.name}, ${pin.index}, ${pin.isOwner}, ${holdOwner}>`
+          : `wrap<&${func.name}>`;
+        descriptors.push({
+          unit: func.name,
+          descriptor: `        {"${func.name}", nullptr, ${callback}, nullptr, nullptr, nullptr, napi_default_jsproperty, nullptr},`,
+        });
+      } else {
+        addFunction(func.name, `${safeName}_wrapper`, func.name);
+      }
+      exportedNames.add(func.name);
+    }
+    for (const func of this.manyWrappers) {
+      const name = `${func.name}_many`;
+      if (!exportedNames.has(name)) {
+        addFunction(name, `${TypeMapper.sanitizeIdentifier(func.name)}_many_wrapper`, func.name);
+        exportedNames.add(name);
+      }
+    }
+
+    return descriptors;
+  }
+
+  // Init defines the given exports and those of each shard export table
+  private generateModuleInit(descriptors: ExportDescriptor[], shardTables: string[] = []): string {
+    const lines: string[] = [];
+
+    // Hand-written extension registrars are defined in other translation units
+    if (this.nativeExtensions.length > 0) {
+      lines.push('// Native extensions (hand-written, see src/*.cpp)');
+      for (const registrar of this.nativeExtensions) {
+        lines.push(`void ${registrar}(Napi::Env env, Napi::Object exports);`);
       }
+      lines.push('');
+    }
+
+    lines.push(`static Napi::Object Init(Napi::Env env, Napi::Object exports) {`);
+
+    // Every export goes into one descriptor table so Init makes a single
+    // napi_define_properties call instead of one exports.Set per name
+    if (descriptors.length > 0) {
+      lines.push(`    static const napi_property_descriptor kExports[] = {`);
+      lines.push(...descriptors.map((entry) => entry.descriptor));
+      lines.push(`    };`);
+    }
+    if (shardTables.length > 0) {
+      lines.push(
+        descriptors.length > 0
+          ? `    std::vector<napi_property_descriptor> descriptors(std::begin(kExports), std::end(kExports));`
+          : `    std::vector<napi_property_descriptor> descriptors;`,
+      );
+      lines.push(`    for (const BindingExportTable& table : {${shardTables.map((table) => `${table}()`).join(', ')}}) {`);
+      lines.push(`        descriptors.insert(descriptors.end(), table.descriptors, table.descriptors + table.count);`);
+      lines.push(`    }`);
+      lines.push(`    napi_define_properties(env, exports, descriptors.size(), descriptors.data());`);
+    } else if (descriptors.length > 0) {
+      lines.push(
+        `    napi_define_properties(env, exports, sizeof(kExports) / sizeof(kExports[0]), kExports);`,
+      );
+    }
+
+    // Register native extensions last so they can reuse generated exports
+    for (const registrar of this.nativeExtensions) {
+      lines.push(`    ${registrar}(env, exports);`);
     }
 
     lines.push(`    return exports;`);
@@ -1,11 +1,46 @@
-import type { HeaderAST } from '../h-parser/types.ts';
+import type { HeaderAST, Struct, StructField } from '../h-parser/types.ts';
 import { TypeMapper } from '../type-mapper.ts';
+import type { CallbackSignature } from '../types.ts';
+
+// Struct view fields with these names get a trailing `_` so they don't shadow
+// DataView members
+const dataViewMembers = new Set([
+  'buffer',
+  'byteLength',
+  'byteOffset',
+  'constructor',
+  ...Object.getOwnPropertyNames(DataView.prototype),
+]);
+
+const typedArrayByAccessor: Record<string, string> = {
+  Int8: 'Int8Array',
+  Uint8: 'Uint8Array',
+  Int16: 'Int16Array',
+  Uint16: 'Uint16Array',
+  Int32: 'Int32Array',
+  Uint32: 'Uint32Array',
+  Float32: 'Float32Array',
+  Float64: 'Float64Array',
+  BigInt64: 'BigInt64Array',
+  BigUint64: 'BigUint64Array',
+};
+
+interface ViewAccessor {
+  property: string;
+  tsType: string;
+  get: string;
+  set?: string;
+}
 
 export class TsGenerator {
   private ast: HeaderAST;
+  private extensions: string[];
+  private manyFunctions: string[];
 
-  constructor(ast: HeaderAST, _packageName: string) {
+  constructor(ast: HeaderAST, _packageName: string, extensions?: string[], manyFunctions?: string[]) {
     this.ast = ast;
+    this.extensions = extensions || [];
+    this.manyFunctions = manyFunctions || [];
   }
 
   generate(): string {
@@ -34,11 +69,22 @@ export class TsGenerator {
       sections.push(this.generateFunctionExports(sortedFunctions));
     }
 
+    // Vectorized fn_many companions
+    const manyFunctions = TypeMapper.selectManyFunctions(sortedFunctions, this.manyFunctions);
+    if (manyFunctions.length > 0) {
+      sections.push(this.generateManyExports(manyFunctions));
+    }
+
     // Struct helpers
     if (sortedStructs.length > 0) {
       sections.push(this.generateStructHelpers(sortedStructs));
     }
 
+    // Hand-written extension modules
+    if (this.extensions.length > 0) {
+      sections.push(this.generateExtensionExports());
+    }
+
     return sections.join('\n\n');
   }
 
@@ -49,9 +95,29 @@ export class TsGenerator {
 const addon = nodeGypBuild(import.meta.dirname) as any;`;
   }
 
+  private generateExtensionExports(): string {
+    const lines: string[] = ['// Native extensions'];
+    for (const module of this.extensions) {
+      lines.push(`export * from '${module}';`);
+    }
+    return lines.join('\n');
+  }
+
   private generateStructInterfaces(sortedStructs: HeaderAST['structs']): string {
     const lines: string[] = ['// Struct type definitions'];
 
+    if (TypeMapper.getViewStructTypes().size > 0) {
+      lines.push(`// Struct views use the platform's byte order
+const nativeEndian = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1;
+
+function copyView(source: DataView, target: DataView, offset: number, size: number): void {
+  new Uint8Array(target.buffer, target.byteOffset + offset, size).set(
+    new Uint8Array(source.buffer, source.byteOffset, size),
+  );
+}
+`);
+    }
+
     // Deduplicate structs by name
     const seenStructNames = new Set<string>();
 
@@ -83,10 +149,11 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
         lines.push(` */`);
       }
 
-      lines.push(`export interface ${structName} {`);
-      lines.push(`  _ptr: unknown;`);
-      lines.push(`  _type: '${structName}';`);
-      lines.push(`}`);
+      if (TypeMapper.isViewStructType(structName)) {
+        lines.push(...this.generateViewClass(struct, structName));
+      } else {
+        lines.push(...this.generateStructInterface(struct, structName));
+      }
       lines.push('');
 
       // Create init interface for struct creation
@@ -96,8 +163,7 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
         if (!field.name || field.name.trim() === '') {
           continue;
         }
-        const tsType = TypeMapper.getTsType(field.type);
-        lines.push(`  ${field.name}?: ${tsType};`);
+        lines.push(`  ${field.name}?: ${this.initFieldType(field.type)};`);
       }
       lines.push(`}`);
       lines.push('');
@@ -106,6 +172,171 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
     return lines.join('\n');
   }
 
+  // Init objects also accept plain arrays for numeric array fields, and the
+  // bytes of char array fields
+  private initFieldType(cType: string): string {
+    const tsType = TypeMapper.getTsType(cType);
+    if (!TypeMapper.isArrayType(cType)) return tsType;
+    if (tsType === 'string') return 'string | Uint8Array';
+    if (tsType.startsWith('Big')) return 'ArrayLike<bigint>';
+    if (tsType.endsWith('Array')) return 'ArrayLike<number>';
+    return tsType;
+  }
+
+  private generateStructInterface(struct: Struct, structName: string): string[] {
+    const lines: string[] = [`export interface ${structName} {`];
+    if (TypeMapper.isPodStructType(structName)) {
+      // Passed by value as a plain object, fields in declaration order
+      for (const field of struct.fields) {
+        lines.push(`  ${field.name}: ${TypeMapper.getTsType(field.type)};`);
+      }
+    } else {
+      lines.push(`  _ptr: unknown;`);
+      lines.push(`  _type: '${structName}';`);
+    }
+    lines.push(`}`);
+    return lines;
+  }
+
+  // ArrayBuffer-backed struct: a DataView over sizeof(T) bytes with typed
+  // accessors at the compiler-reported field offsets
+  private generateViewClass(struct: Struct, structName: string): string[] {
+    const size = struct.size!;
+    const lines: string[] = [
+      `export class ${structName} extends DataView {`,
+      `  static readonly byteLength = ${size};`,
+      '',
+      `  constructor(buffer: ArrayBufferLike = new ArrayBuffer(${size}), byteOffset = 0) {`,
+      `    super(buffer, byteOffset, ${size});`,
+      `  }`,
+    ];
+    for (const field of struct.fields) {
+      const accessor = this.viewAccessor(field);
+      if (!accessor) continue;
+      lines.push('');
+      lines.push(`  get ${accessor.property}(): ${accessor.tsType} {`);
+      lines.push(`    return ${accessor.get};`);
+      lines.push(`  }`);
+      if (accessor.set) {
+        lines.push('');
+        lines.push(`  set ${accessor.property}(value: ${accessor.tsType}) {`);
+        lines.push(`    ${accessor.set};`);
+        lines.push(`  }`);
+      }
+    }
+    lines.push(`}`);
+    return lines;
+  }
+
+  // Typed access to one field of a struct view, or undefined when the field
+  // has no byte offset (bit-fields) or no fixed-size representation
+  private viewAccessor(field: StructField): ViewAccessor | undefined {
+    if (!field.name || field.offset === undefined || field.size === undefined) {
+      return undefined;
+    }
+    const property = dataViewMembers.has(field.name) ? `${field.name}_` : field.name;
+    const offset = field.offset;
+
+    const nested = TypeMapper.getViewStructName(field.type);
+    if (nested) {
+      return {
+        property,
+        tsType: nested,
+        get: `new ${nested}(this.buffer, this.byteOffset + ${offset})`,
+        set: `copyView(value, this, ${offset}, ${nested}.byteLength)`,
+      };
+    }
+
+    const array = /^(.+?)\s*\[(\d+)\]$/.exec(field.type);
+    if (array) {
+      const [, elementType, count] = array;
+      const length = Number(count);
+      if (length === 0) return undefined;
+      const element = this.viewScalar(elementType!, field.size / length);
+      if (!element) return undefined;
+      // char arrays are usually text; unsigned bytes suit TextDecoder
+      const typedArray =
+        TypeMapper.resolveTypedef(elementType!) === 'char'
+          ? 'Uint8Array'
+          : typedArrayByAccessor[element.accessor]!;
+      return {
+        property,
+        tsType: typedArray,
+        get: `new ${typedArray}(this.buffer, this.byteOffset + ${offset}, ${length})`,
+      };
+    }
+
+    const scalar = this.viewScalar(field.type, field.size);
+    if (!scalar) return undefined;
+    const endian = field.size > 1 ? ', nativeEndian' : '';
+    const read = `this.get${scalar.accessor}(${offset}${endian})`;
+    if (scalar.kind === 'boolean') {
+      return {
+        property,
+        tsType: 'boolean',
+        get: `${read} !== 0`,
+        set: `this.set${scalar.accessor}(${offset}, value ? 1 : 0)`,
+      };
+    }
+    if (scalar.kind === 'number64') {
+      // 64-bit integers the bindings otherwise expose as numbers
+      return {
+        property,
+        tsType: 'number',
+        get: `Number(${read})`,
+        set: `this.set${scalar.accessor}(${offset}, BigInt(value)${endian})`,
+      };
+    }
+    return {
+      property,
+      tsType: scalar.kind,
+      get: read,
+      set: `this.set${scalar.accessor}(${offset}, value${endian})`,
+    };
+  }
+
+  // DataView accessor (Int32, Float64, ...) for a scalar C type of `size` bytes
+  private viewScalar(
+    cType: string,
+    size: number,
+  ): { accessor: string; kind: 'number' | 'bigint' | 'boolean' | 'number64' } | undefined {
+    const resolved = TypeMapper.resolveTypedef(cType);
+    const integer = (signed: boolean, wide: 'bigint' | 'number64') => {
+      const bits = size * 8;
+      if (size === 8) return { accessor: signed ? 'BigInt64' : 'BigUint64', kind: wide };
+      if (size === 1 || size === 2 || size === 4) {
+        return { accessor: `${signed ? 'Int' : 'Uint'}${bits}`, kind: 'number' as const };
+      }
+      return undefined;
+    };
+
+    // Pointers are exposed as raw addresses
+    if (
+      resolved.endsWith('*') ||
+      TypeMapper.isPointerType(cType) ||
+      TypeMapper.isFunctionPointerType(cType)
+    ) {
+      return integer(false, 'bigint');
+    }
+    if (TypeMapper.isEnumType(cType)) {
+      return integer(true, 'number64');
+    }
+    if (resolved === 'bool' || resolved === '_Bool') {
+      return size === 1 ? { accessor: 'Uint8', kind: 'boolean' } : undefined;
+    }
+    if (resolved === 'float' || resolved === 'double') {
+      if (size === 4) return { accessor: 'Float32', kind: 'number' };
+      if (size === 8) return { accessor: 'Float64', kind: 'number' };
+      return undefined;
+    }
+    const mapping = TypeMapper.getMapping(resolved);
+    if (mapping.napiType === 'Napi::Number' || mapping.napiType === 'Napi::BigInt') {
+      const signed = !resolved.includes('unsigned') && resolved !== 'size_t';
+      return integer(signed, mapping.tsType === 'bigint' ? 'bigint' : 'number64');
+    }
+    return undefined;
+  }
+
   private generateEnumExports(sortedEnums: HeaderAST['enums']): string {
     const lines: string[] = ['// Enum constants'];
 
@@ -156,12 +387,34 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
       lines.push('');
     }
 
+    // Native reverse lookup over the enum tables in binding.cpp
+    if (sortedEnums.some((enumDef) => /^[A-Za-z_]\w*$/.test(enumDef.name))) {
+      lines.push(`/**
+ * Name of the first constant declared with \`value\` in the enum named
+ * \`enumId\`, or undefined if none matches.
+ */
+export function enumName(enumId: string, value: number | bigint): string | undefined {
+  return addon.enumName(enumId, value);
+}`);
+      lines.push('');
+    }
+
     return lines.join('\n');
   }
 
   private generateFunctionExports(sortedFunctions: NonNullable<HeaderAST['functions']>): string {
     const lines: string[] = ['// Function exports'];
 
+    if (sortedFunctions.some((func) => TypeMapper.getCallbackParams(func.params).size > 0)) {
+      lines.push(`declare const nativeFunctionPointer: unique symbol;
+/**
+ * A C function pointer from another addon, as an N-API External. Passed where
+ * a callback is expected, C calls it directly instead of going through JS.
+ */
+export type NativeFunctionPointer = { readonly [nativeFunctionPointer]: true };
+`);
+    }
+
     for (const func of sortedFunctions) {
       if (func.documentation) {
         lines.push(`/**`);
@@ -180,22 +433,54 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
         lines.push(` */`);
       }
 
-      const paramList = func.params
-        .map((param, i) => {
-          const paramName = param.name || `arg${i}`;
-          const tsType = TypeMapper.getTsType(param.type.spelling);
-          return `${paramName}: ${tsType}`;
-        })
-        .join(', ');
-
-      const returnType = TypeMapper.getTsType(func.return.spelling);
+      // (T *data, size_t n) pairs take a TypedArray; n defaults to its length
+      const typedArrayParams = TypeMapper.getTypedArrayParams(func.params);
+      const typedArrayLengths = new Set(typedArrayParams.values());
+      // Callback typedefs take JS functions; their user data is optional
+      const callbackParams = TypeMapper.getCallbackParams(func.params);
+      const userDataParams = new Set(
+        [...callbackParams.values()].flatMap(({ userData }) => (userData !== undefined ? [userData] : [])),
+      );
+      const params = func.params.map((param, i) => {
+        const paramName = param.name || `arg${i}`;
+        const callback = callbackParams.get(i);
+        if (callback) {
+          return `${paramName}: ${this.callbackTsType(callback.signature)} | NativeFunctionPointer | null`;
+        }
+        if (userDataParams.has(i)) {
+          const tsType = `${TypeMapper.getTsParamType(param.type.spelling)} | null`;
+          return i === func.params.length - 1 ? `${paramName}?: ${tsType}` : `${paramName}: ${tsType}`;
+        }
+        if (typedArrayParams.has(i)) {
+          const element = TypeMapper.getTypedArrayPointerElement(param.type.spelling)!;
+          return `${paramName}: ${TypeMapper.getTypedArrayName(element)}`;
+        }
+        if (typedArrayLengths.has(i)) {
+          return i === func.params.length - 1 ? `${paramName}?: number` : `${paramName}: number | undefined`;
+        }
+        const tsType = TypeMapper.getTsParamType(param.type.spelling);
+        return `${paramName}: ${tsType}`;
+      });
+
+      // Handles with a dispose function free it on `using` scope exit
+      const disposable =
+        TypeMapper.getDisposer(func.return.spelling) !== undefined && TypeMapper.getOwnerSource(func) === undefined;
+      const returnType = TypeMapper.getTsType(func.return.spelling) + (disposable ? ' & Disposable' : '');
+      const returnsView = TypeMapper.isViewStructType(func.return.spelling);
+      if (returnsView) {
+        // Optional preallocated view the result is written into
+        params.push(`out?: ${returnType}`);
+      }
 
-      lines.push(`export function ${func.name}(${paramList}): ${returnType} {`);
+      lines.push(`export function ${func.name}(${params.join(', ')}): ${returnType} {`);
 
       const args = func.params
         .map((param, i) => param.name || `arg${i}`)
         .join(', ');
-      if (TypeMapper.isVoidType(func.return.spelling)) {
+      if (returnsView) {
+        lines.push(`  const result = addon.${func.name}(${args ? `${args}, ` : ''}out);`);
+        lines.push(`  return out ?? new ${returnType}(result);`);
+      } else if (TypeMapper.isVoidType(func.return.spelling)) {
         lines.push(`  addon.${func.name}(${args});`);
       } else {
         lines.push(`  return addon.${func.name}(${args});`);
@@ -208,6 +493,41 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
     return lines.join('\n');
   }
 
+  // TS function type of a callback typedef, without its user-data argument
+  private callbackTsType(signature: CallbackSignature): string {
+    const args = signature.params.flatMap((type, i) =>
+      i === signature.userData ? [] : [`arg${i}: ${TypeMapper.getTsType(type)}`],
+    );
+    const result = TypeMapper.isVoidType(signature.result) ? 'void' : `${TypeMapper.getTsType(signature.result)} | void`;
+    return `((${args.join(', ')}) => ${result})`;
+  }
+
+  private generateManyExports(functions: NonNullable<HeaderAST['functions']>): string {
+    const lines: string[] = ['// Vectorized function exports'];
+
+    for (const func of functions) {
+      const params = func.params.map((param, i) => ({
+        name: param.name || `arg${i}`,
+        typedArray: TypeMapper.getManyColumn(param.type.spelling)!.typedArray,
+      }));
+      const resultType = TypeMapper.getManyColumn(func.return.spelling)!.typedArray;
+      const names = params.map((param) => param.name);
+
+      lines.push(`/**`);
+      lines.push(` * ${func.name} over equal-length columns in one native call:`);
+      lines.push(` * out[i] = ${func.name}(${names.map((name) => `${name}[i]`).join(', ')})`);
+      lines.push(` */`);
+      lines.push(
+        `export function ${func.name}_many(${[...params.map((p) => `${p.name}: ${p.typedArray}`), `out?: ${resultType}`].join(', ')}): ${resultType} {`,
+      );
+      lines.push(`  return addon.${func.name}_many(${[...names, 'out'].join(', ')});`);
+      lines.push(`}`);
+      lines.push('');
+    }
+
+    return lines.join('\n');
+  }
+
   private generateStructHelpers(): string {
     const lines: string[] = ['// Struct helper functions'];
 
@@ -246,28 +566,53 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
       lines.push(
         `export function create${structName}(init?: ${structName}Init): ${structName} {`,
       );
-      lines.push(`  return addon.create_${structName}(init);`);
+      const isView = TypeMapper.isViewStructType(structName);
+      lines.push(
+        isView
+          ? `  return new ${structName}(addon.create_${structName}(init));`
+          : `  return addon.create_${structName}(init);`,
+      );
       lines.push(`}`);
       lines.push('');
 
-      // Field getters
+      // Field getters pass the field's index in the native field table
+      // (named fields in name order) instead of its name
+      const fieldIndex = new Map<string, number>();
+
+      // By-value structs are plain objects or views, so their fields are read
+      // in JS; the rest go through the native field table. POD structs reached
+      // through a pointer (a pointer field or result) are still wrapped
+      // handles, which the native table reads.
+      const isPod = TypeMapper.isPodStructType(structName);
+      const structType = isPod ? `${structName} | { _ptr: unknown }` : structName;
+      const readField = (field: StructField): { expr: string; tsType: string } => {
+        const accessor = isView ? this.viewAccessor(field) : undefined;
+        if (accessor) {
+          return { expr: `struct.${accessor.property}`, tsType: accessor.tsType };
+        }
+        const native = `addon.get_${structName}_field(struct, ${fieldIndex.get(field.name)})`;
+        return {
+          expr: isPod ? `'_ptr' in struct ? ${native} : struct.${field.name}` : native,
+          tsType: TypeMapper.getTsType(field.type),
+        };
+      };
+
       for (const field of [...struct.fields].sort((a, b) => (a.name||'').localeCompare(b.name||''))) {
         // Skip fields with empty names (anonymous union members)
         if (!field.name || field.name.trim() === '') {
           continue;
         }
+        fieldIndex.set(field.name, fieldIndex.size);
         const fieldName = TypeMapper.sanitizeIdentifier(field.name);
-        const tsType = TypeMapper.getTsType(field.type);
+        const { expr, tsType } = readField(field);
 
         lines.push(`/**`);
         lines.push(` * Get ${field.name} field from ${structName}`);
         lines.push(` */`);
         lines.push(
-          `export function get${structName}_${fieldName}(struct: ${structName}): ${tsType} {`,
-        );
-        lines.push(
-          `  return addon.get_${structName}_field(struct, '${field.name}');`,
+          `export function get${structName}_${fieldName}(struct: ${structType}): ${tsType} {`,
         );
+        lines.push(`  return ${expr};`);
         lines.push(`}`);
         lines.push('');
       }
@@ -277,7 +622,7 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
       lines.push(` * Get all fields from ${structName} as an object`);
       lines.push(` */`);
       lines.push(
-        `export function get${structName}Fields(struct: ${structName}): ${structName}Init {`,
+        `export function get${structName}Fields(struct: ${structType}): ${structName}Init {`,
       );
       lines.push(`  return {`);
       for (const field of struct.fields) {
@@ -285,9 +630,10 @@ const addon = nodeGypBuild(import.meta.dirname) as any;`;
         if (!field.name || field.name.trim() === '') {
           continue;
         }
-        lines.push(
-          `    ${field.name}: addon.get_${structName}_field(struct, '${field.name}'),`,
-        );
+        // Typed-array views are copied so the result doesn't alias the struct
+        const { expr, tsType } = readField(field);
+        const aliases = isView && Object.values(typedArrayByAccessor).includes(tsType);
+        lines.push(`    ${field.name}: ${aliases ? `${expr}.slice()` : expr},`);
       }
       lines.push(`  };`);
       lines.push(`}`);
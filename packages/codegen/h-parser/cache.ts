@@ -0,0 +1,85 @@
+import { mkdirSync, readFileSync, writeFileSync } from 'node:fs';
+import { dirname, join } from 'node:path';
+import { fileURLToPath } from 'node:url';
+import * as clang from 'node-clang-raw';
+import { CACHE_VERSION, hashContent, hashFile, readJson } from '../cache.ts';
+import { parseHeader } from './index.ts';
+import type { HeaderAST, ParseOptions } from './types.ts';
+
+interface AstCacheEntry {
+  version: number;
+  // Content hash of every file the header pulled in, by path
+  dependencies: Record<string, string>;
+  ast: HeaderAST;
+}
+
+function clangVersion(): string {
+  const version = clang.clang_getClangVersion();
+  const text = clang.clang_getCString(version) || '';
+  clang.clang_disposeString(version);
+  return text;
+}
+
+// A cached AST is only reusable with the same parser: the JS walker here and
+// node-clang-raw's native one, whose source and version are hashed
+function parserFingerprint(): string {
+  const nodeClangRaw = import.meta.resolve('node-clang-raw');
+  return hashContent(
+    ...['./index.ts', './utils.ts'].map((path) =>
+      readFileSync(new URL(path, import.meta.url), 'utf-8'),
+    ),
+    ...['./package.json', './src/header_ast.cpp'].map(
+      (path) => hashFile(fileURLToPath(new URL(path, nodeClangRaw))) ?? '',
+    ),
+  );
+}
+
+/**
+ * parseHeader with an on-disk cache keyed by the header's content, the
+ * parse options, the parser and the libclang version. An entry is only reused
+ * while every file the header included still has the content it was parsed
+ * with.
+ */
+export function parseHeaderCached(
+  headerPath: string,
+  options: ParseOptions,
+  cacheDir: string,
+): HeaderAST {
+  const headerHash = hashFile(headerPath);
+  if (headerHash === undefined) {
+    return parseHeader(headerPath, options);
+  }
+  const key = hashContent(
+    String(CACHE_VERSION),
+    clangVersion(),
+    parserFingerprint(),
+    headerPath,
+    headerHash,
+    JSON.stringify(options),
+  );
+  const entryPath = join(cacheDir, 'ast', `${key}.json`);
+
+  const cached = readJson<AstCacheEntry>(entryPath);
+  if (
+    cached?.version === CACHE_VERSION &&
+    Object.entries(cached.dependencies).every(([path, hash]) => hashFile(path) === hash)
+  ) {
+    console.log(`  ♻️  ${headerPath} (cached AST)`);
+    return cached.ast;
+  }
+
+  const ast = parseHeader(headerPath, { ...options, collectDependencies: true });
+  const dependencies: Record<string, string> = {};
+  for (const path of ast.dependencies ?? [headerPath]) {
+    const hash = hashFile(path);
+    if (hash !== undefined) {
+      dependencies[path] = hash;
+    }
+  }
+  delete ast.dependencies;
+
+  const entry: AstCacheEntry = { version: CACHE_VERSION, dependencies, ast };
+  mkdirSync(dirname(entryPath), { recursive: true });
+  writeFileSync(entryPath, JSON.stringify(entry), 'utf-8');
+  return ast;
+}
@@ -19,6 +19,7 @@ import {
   buildCompilerArgs,
   buildParseOptions,
   cleanDocumentation,
+  getTypeInfo,
 } from './utils.ts';
 
 // Helper to get string from CXString
@@ -34,27 +35,6 @@ function getStringFromCXString(cxString: any): string {
   }
 }
 
-// Helper to get type info
-function getTypeInfo(type: any): { spelling: string; nullability?: string } {
-  const spelling = getStringFromCXString(clang.clang_getTypeSpelling(type));
-  const info: any = { spelling };
-  
-  // Get nullability if available
-  const nullability = clang.clang_Type_getNullability(type);
-  const nullabilityMap: Record<number, string> = {
-    0: 'nonnull',
-    1: 'nullable',
-    2: 'unspecified',
-    3: 'nullable_result',
-  };
-  
-  if (nullability in nullabilityMap) {
-    info.nullability = nullabilityMap[nullability];
-  }
-  
-  return info;
-}
-
 /**
  * Collect method information from a cursor
  */
@@ -197,6 +177,10 @@ function collectEnum(cursor: any): Enum {
   if (doc) {
     enumDecl.documentation = doc;
   }
+  const usr = getStringFromCXString(clang.clang_getCursorUSR(cursor));
+  if (usr) {
+    enumDecl.usr = usr;
+  }
 
   // Visit children to collect enum constants
   clang.clang_visitChildren(cursor, (child: any, _parent: any) => {
@@ -247,6 +231,7 @@ function collectStruct(cursor: any): Struct {
   const struct: Struct = {
     name: getStringFromCXString(clang.clang_getCursorSpelling(cursor)),
     fields: [],
+    kind: clang.clang_getCursorKind(cursor) === clang.CXCursor_UnionDecl ? 'union' : 'struct',
   };
 
   // Add documentation if available
@@ -254,16 +239,38 @@ function collectStruct(cursor: any): Struct {
   if (doc) {
     struct.documentation = doc;
   }
+  const usr = getStringFromCXString(clang.clang_getCursorUSR(cursor));
+  if (usr) {
+    struct.usr = usr;
+  }
+
+  // Negative values are CXTypeLayoutError codes (incomplete, dependent, ...)
+  const size = Number(clang.clang_Type_getSizeOf(clang.clang_getCursorType(cursor)));
+  if (size >= 0) {
+    struct.size = size;
+  }
 
   // Visit children to collect fields
   clang.clang_visitChildren(cursor, (child: any, _parent: any) => {
     const kind = clang.clang_getCursorKind(child);
 
     if (kind === clang.CXCursor_FieldDecl) {
+      const fieldType = clang.clang_getCursorType(child);
       const field: StructField = {
         name: getStringFromCXString(clang.clang_getCursorSpelling(child)),
-        type: getStringFromCXString(clang.clang_getTypeSpelling(clang.clang_getCursorType(child))),
+        type: getStringFromCXString(clang.clang_getTypeSpelling(fieldType)),
+        typeInfo: getTypeInfo(fieldType),
       };
+
+      // Layout as the compiler sees it; offsets are reported in bits
+      const offsetBits = Number(clang.clang_Cursor_getOffsetOfField(child));
+      if (offsetBits >= 0 && offsetBits % 8 === 0 && !clang.clang_Cursor_isBitField(child)) {
+        field.offset = offsetBits / 8;
+      }
+      const fieldSize = Number(clang.clang_Type_getSizeOf(fieldType));
+      if (fieldSize >= 0) {
+        field.size = fieldSize;
+      }
       struct.fields.push(field);
     }
 
@@ -277,9 +284,11 @@ function collectStruct(cursor: any): Struct {
  * Collect typedef information
  */
 function collectTypedef(cursor: any): Typedef {
+  const underlying = clang.clang_getTypedefDeclUnderlyingType(cursor);
   const typedef: Typedef = {
     name: getStringFromCXString(clang.clang_getCursorSpelling(cursor)),
-    underlying: getStringFromCXString(clang.clang_getTypeSpelling(clang.clang_getTypedefDeclUnderlyingType(cursor))),
+    underlying: getStringFromCXString(clang.clang_getTypeSpelling(underlying)),
+    underlyingType: getTypeInfo(underlying),
     spelling: getStringFromCXString(clang.clang_getTypeSpelling(clang.clang_getCursorType(cursor))),
   };
 
@@ -288,6 +297,10 @@ function collectTypedef(cursor: any): Typedef {
   if (doc) {
     typedef.documentation = doc;
   }
+  const usr = getStringFromCXString(clang.clang_getCursorUSR(cursor));
+  if (usr) {
+    typedef.usr = usr;
+  }
 
   return typedef;
 }
@@ -307,6 +320,10 @@ function collectFunction(cursor: any): FunctionDecl {
   if (doc) {
     func.documentation = doc;
   }
+  const usr = getStringFromCXString(clang.clang_getCursorUSR(cursor));
+  if (usr) {
+    func.usr = usr;
+  }
 
   // Get function arguments
   const numArgs = clang.clang_Cursor_getNumArguments(cursor);
@@ -322,6 +339,78 @@ function collectFunction(cursor: any): FunctionDecl {
   return func;
 }
 
+/**
+ * Walk a translation unit cursor by cursor from JS. This is the reference
+ * implementation of node-clang-raw's native extractHeaderAST, kept behind
+ * ParseOptions.jsWalker.
+ */
+function walkHeader(tu: any, ast: HeaderAST): void {
+  // Get root cursor
+  const cursor = clang.clang_getTranslationUnitCursor(tu);
+
+  // Recursively visit nodes
+  const visitNode = (
+    node: any,
+    parentInHeader: boolean = false,
+  ) => {
+    // For now, assume all nodes from the parsed file are in the target header
+    // TODO: Properly check source location once output parameters are supported
+    const inThisHeader = true;
+
+    // Process if in target header or if parent was in header (for nested decls)
+    if (inThisHeader || parentInHeader) {
+      const kind = clang.clang_getCursorKind(node);
+
+      // Process based on cursor kind
+      switch (kind) {
+        case clang.CXCursor_ObjCInterfaceDecl:
+          ast.interfaces.push(collectInterface(node));
+          break;
+
+        case clang.CXCursor_ObjCProtocolDecl:
+          ast.protocols.push(collectProtocol(node));
+          break;
+
+        case clang.CXCursor_ClassDecl:
+          if (ast.classes) {
+            ast.classes.push(collectInterface(node));
+          }
+          break;
+
+        case clang.CXCursor_EnumDecl:
+          // Parse both named and anonymous enums
+          ast.enums.push(collectEnum(node));
+          break;
+
+        case clang.CXCursor_StructDecl:
+        case clang.CXCursor_UnionDecl:
+          // Parse both named and anonymous structs and unions
+          ast.structs.push(collectStruct(node));
+          break;
+
+        case clang.CXCursor_TypedefDecl:
+          ast.typedefs.push(collectTypedef(node));
+          break;
+
+        case clang.CXCursor_FunctionDecl:
+          if (ast.functions) {
+            ast.functions.push(collectFunction(node));
+          }
+          break;
+      }
+    }
+
+    // Recurse into children
+    clang.clang_visitChildren(node, (child: any, _parent: any) => {
+      visitNode(child, inThisHeader);
+      return clang.CXChildVisit_Continue;
+    }, null);
+  };
+
+  // Start visiting from root
+  visitNode(cursor);
+}
+
 /**
  * Parse a header file and return structured AST
  */
@@ -374,74 +463,23 @@ export function parseHeader(
         objc_categories: [],
       };
 
-      // Get root cursor
-      const cursor = clang.clang_getTranslationUnitCursor(tu);
-
-      // Recursively visit nodes
-      const visitNode = (
-        node: any,
-        parentInHeader: boolean = false,
-      ) => {
-        // For now, assume all nodes from the parsed file are in the target header
-        // TODO: Properly check source location once output parameters are supported
-        const inThisHeader = true;
-
-        // Process if in target header or if parent was in header (for nested decls)
-        if (inThisHeader || parentInHeader) {
-          const kind = clang.clang_getCursorKind(node);
-
-          // Process based on cursor kind
-          switch (kind) {
-            case clang.CXCursor_ObjCInterfaceDecl:
-              ast.interfaces.push(collectInterface(node));
-              break;
-
-            case clang.CXCursor_ObjCProtocolDecl:
-              ast.protocols.push(collectProtocol(node));
-              break;
-
-            case clang.CXCursor_ClassDecl:
-              if (ast.classes) {
-                ast.classes.push(collectInterface(node));
-              }
-              break;
-
-            case clang.CXCursor_EnumDecl:
-              // Parse both named and anonymous enums
-              ast.enums.push(collectEnum(node));
-              break;
-
-            case clang.CXCursor_StructDecl:
-              // Parse both named and anonymous structs
-              ast.structs.push(collectStruct(node));
-              break;
-
-            case clang.CXCursor_TypedefDecl:
-              ast.typedefs.push(collectTypedef(node));
-              break;
-
-            case clang.CXCursor_FunctionDecl:
-              if (ast.functions) {
-                ast.functions.push(collectFunction(node));
-              }
-              break;
-          }
-        }
-
-        // Recurse into children
-        clang.clang_visitChildren(node, (child: any, _parent: any) => {
-          visitNode(child, inThisHeader);
-          return clang.CXChildVisit_Continue;
-        }, null);
-      };
-
-      // Start visiting from root
-      visitNode(cursor);
+      if (options.jsWalker) {
+        walkHeader(tu, ast);
+      } else {
+        // One native pass; the declaration arrays arrive as a single JSON string
+        Object.assign(ast, clang.extractHeaderAST(tu, {
+          includeDocumentation: options.includeDocumentation !== false,
+        }));
+      }
 
       // Update convenience aliases
       ast.objc_interfaces = ast.interfaces;
       ast.objc_protocols = ast.protocols;
 
+      if (options.collectDependencies) {
+        ast.dependencies = clang.getIncludeGraph(tu).files;
+      }
+
       return ast;
     } finally {
       clang.clang_disposeTranslationUnit(tu);
@@ -0,0 +1,69 @@
+import { Worker } from 'node:worker_threads';
+import type { HeaderAST, ParseOptions } from './types.ts';
+
+/**
+ * Parse headers on a pool of up to `jobs` worker threads, each running
+ * parseHeader (or parseHeaderCached with `cacheDir`). The ASTs come back in
+ * `headerPaths` order whatever order the workers finish in, so merging them
+ * gives the same result as parsing serially.
+ */
+export function parseHeadersInParallel(
+  headerPaths: string[],
+  options: ParseOptions,
+  jobs: number,
+  cacheDir?: string,
+): Promise<HeaderAST[]> {
+  if (headerPaths.length === 0) {
+    return Promise.resolve([]);
+  }
+  const results = new Array<HeaderAST>(headerPaths.length);
+  const workers = Array.from(
+    { length: Math.max(1, Math.min(jobs, headerPaths.length)) },
+    () => new Worker(new URL('./parse-worker.ts', import.meta.url), { workerData: { options, cacheDir } }),
+  );
+
+  return new Promise((resolve, reject) => {
+    let next = 0;
+    let done = 0;
+    let settled = false;
+    const finish = (error?: Error) => {
+      if (settled) {
+        return;
+      }
+      settled = true;
+      for (const worker of workers) {
+        void worker.terminate();
+      }
+      if (error) {
+        reject(error);
+      } else {
+        resolve(results);
+      }
+    };
+    // Headers are handed out one at a time, so a slow header does not hold
+    // up a whole batch
+    const dispatch = (worker: Worker) => {
+      if (next < headerPaths.length) {
+        const index = next++;
+        worker.postMessage({ index, headerPath: headerPaths[index] });
+      }
+    };
+
+    for (const worker of workers) {
+      worker.on('message', (message: { index: number; ast?: HeaderAST; error?: string }) => {
+        if (message.error !== undefined) {
+          finish(new Error(`Failed to parse ${headerPaths[message.index]}: ${message.error}`));
+          return;
+        }
+        results[message.index] = message.ast!;
+        if (++done === headerPaths.length) {
+          finish();
+        } else {
+          dispatch(worker);
+        }
+      });
+      worker.on('error', finish);
+      dispatch(worker);
+    }
+  });
+}
@@ -0,0 +1,17 @@
+import { parentPort, workerData } from 'node:worker_threads';
+import { parseHeaderCached } from './cache.ts';
+import { parseHeader } from './index.ts';
+import type { ParseOptions } from './types.ts';
+
+// Worker side of parseHeadersInParallel. Every parseHeader call creates and
+// disposes its own CXIndex, so workers share no libclang state.
+const { options, cacheDir } = workerData as { options: ParseOptions; cacheDir?: string };
+
+parentPort!.on('message', ({ index, headerPath }: { index: number; headerPath: string }) => {
+  try {
+    const ast = cacheDir ? parseHeaderCached(headerPath, options, cacheDir) : parseHeader(headerPath, options);
+    parentPort!.postMessage({ index, ast });
+  } catch (error) {
+    parentPort!.postMessage({ index, error: error instanceof Error ? error.message : String(error) });
+  }
+});
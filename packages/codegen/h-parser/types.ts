@@ -4,11 +4,16 @@ export interface TypeInfo {
   spelling: string;
   nullability?: 'nonnull' | 'nullable' | 'unspecified' | 'nullable_result';
   kind?: number; // CXTypeKind enum value
-  canonicalKind?: number; // CXTypeKind of the canonical type (for typedefs)
+  canonicalKind?: number; // CXTypeKind of the canonical type, when it differs (typedefs)
   isPointer?: boolean;
   isConst?: boolean;
-  isFunctionPointer?: boolean;
+  isFunctionPointer?: boolean; // Pointers to functions, and blocks
   pointeeType?: TypeInfo; // For pointer types, the type being pointed to
+  elementType?: TypeInfo; // For constant arrays
+  arraySize?: number;
+  resultType?: TypeInfo; // For function types (pointees of function pointers)
+  argTypes?: TypeInfo[];
+  declaration?: string; // Name of the struct/union/enum a record or enum type declares
 }
 
 export interface MethodParam {
@@ -55,24 +60,33 @@ export interface Enum {
   name: string;
   constants: EnumConstant[];
   documentation?: string;
+  usr?: string; // clang_getCursorUSR; identical across translation units
 }
 
 export interface StructField {
   name: string;
   type: string;
+  typeInfo?: TypeInfo; // Structure of `type`
+  offset?: number; // Byte offset in the record (absent for bit-fields)
+  size?: number; // sizeof the field type in bytes
 }
 
 export interface Struct {
   name: string;
   fields: StructField[];
   documentation?: string;
+  kind?: 'struct' | 'union'; // Absent in older ASTs, meaning 'struct'
+  size?: number; // sizeof in bytes, as reported by clang (absent if incomplete)
+  usr?: string; // clang_getCursorUSR; identical across translation units
 }
 
 export interface Typedef {
   name: string;
   underlying: string;
+  underlyingType?: TypeInfo; // Structure of `underlying`
   documentation?: string;
   spelling?: string;
+  usr?: string; // clang_getCursorUSR; identical across translation units
 }
 
 export interface Function {
@@ -80,6 +94,7 @@ export interface Function {
   return: TypeInfo;
   params: MethodParam[];
   documentation?: string;
+  usr?: string; // clang_getCursorUSR; identical across translation units
 }
 
 export interface HeaderAST {
@@ -95,6 +110,8 @@ export interface HeaderAST {
   objc_interfaces: Interface[];
   objc_protocols: Protocol[];
   objc_categories: any[];
+  // Every file the translation unit read (ParseOptions.collectDependencies)
+  dependencies?: string[];
 }
 
 export interface ParseOptions {
@@ -113,5 +130,12 @@ export interface ParseOptions {
   detailedProcessing?: boolean;
   excludeDeclarationsFromPCH?: boolean;
   displayDiagnostics?: boolean;
+
+  // Collect declarations with the per-cursor JS walker instead of
+  // node-clang-raw's native extractHeaderAST (same output, much slower)
+  jsWalker?: boolean;
+
+  // Record the main file and everything it included in HeaderAST.dependencies
+  collectDependencies?: boolean;
 }
 
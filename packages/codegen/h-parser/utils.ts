@@ -65,18 +65,18 @@ export function cleanDocumentation(comment: string | null): string | undefined {
   return doc || undefined;
 }
 
+// Helper to get string from CXString
+function getStringFromCXString(cxString: any): string {
+  if (!cxString || !cxString._ptr) return '';
+  const str = clang.clang_getCString(cxString);
+  clang.clang_disposeString(cxString);
+  return str || '';
+}
+
 /**
  * Extract type information from a libclang type
  */
 export function getTypeInfo(type: any): TypeInfo {
-  // Helper to get string from CXString
-  function getStringFromCXString(cxString: any): string {
-    if (!cxString || !cxString._ptr) return '';
-    const str = clang.clang_getCString(cxString);
-    clang.clang_disposeString(cxString);
-    return str || '';
-  }
-
   const info: TypeInfo = {
     spelling: getStringFromCXString(clang.clang_getTypeSpelling(type)),
   };
@@ -87,7 +87,7 @@ export function getTypeInfo(type: any): TypeInfo {
     0: 'nonnull',
     1: 'nullable',
     2: 'unspecified',
-    3: 'nullable_result',
+    4: 'nullable_result',
   };
 
   if (nullability in nullabilityMap) {
@@ -97,9 +97,76 @@ export function getTypeInfo(type: any): TypeInfo {
     }
   }
 
+  describeTypeStructure(type, info);
   return info;
 }
 
+function typeKind(type: any): number {
+  return clang.getCXTypeFields(type).kind ?? clang.CXType_Invalid;
+}
+
+// clang_getPointeeType and clang_getArrayElementType do not look through
+// typedefs; the canonical type's answer loses the sugar but is always there
+function desugared(get: (type: any) => any, type: any, canonical: any): any {
+  const result = get(type);
+  return typeKind(result) !== clang.CXType_Invalid ? result : get(canonical);
+}
+
+/**
+ * Fills in the structure of a type (same as node-clang-raw's native
+ * WriteTypeStructure): kinds, constness and, depending on the canonical kind,
+ * the pointee, array element, function signature or declaring record/enum
+ */
+function describeTypeStructure(type: any, info: TypeInfo): void {
+  const canonical = clang.clang_getCanonicalType(type);
+  const kind = typeKind(type);
+  const canonicalKind = typeKind(canonical);
+  info.kind = kind;
+  if (canonicalKind !== kind) {
+    info.canonicalKind = canonicalKind;
+  }
+  if (clang.clang_isConstQualifiedType(type)) {
+    info.isConst = true;
+  }
+  switch (canonicalKind) {
+    case clang.CXType_Pointer:
+    case clang.CXType_BlockPointer: {
+      const pointee = desugared(clang.clang_getPointeeType, type, canonical);
+      const pointeeKind = typeKind(clang.clang_getCanonicalType(pointee));
+      info.isPointer = true;
+      if (
+        canonicalKind === clang.CXType_BlockPointer ||
+        pointeeKind === clang.CXType_FunctionProto ||
+        pointeeKind === clang.CXType_FunctionNoProto
+      ) {
+        info.isFunctionPointer = true;
+      }
+      info.pointeeType = getTypeInfo(pointee);
+      break;
+    }
+    case clang.CXType_ConstantArray:
+      info.elementType = getTypeInfo(desugared(clang.clang_getArrayElementType, type, canonical));
+      info.arraySize = Number(clang.clang_getArraySize(canonical));
+      break;
+    case clang.CXType_FunctionProto:
+    case clang.CXType_FunctionNoProto:
+      info.resultType = getTypeInfo(clang.clang_getResultType(type));
+      info.argTypes = [];
+      for (let i = 0; i < clang.clang_getNumArgTypes(type); i++) {
+        info.argTypes.push(getTypeInfo(clang.clang_getArgType(type, i)));
+      }
+      break;
+    case clang.CXType_Record:
+    case clang.CXType_Enum: {
+      const name = getStringFromCXString(clang.clang_getCursorSpelling(clang.clang_getTypeDeclaration(canonical)));
+      if (name) {
+        info.declaration = name;
+      }
+      break;
+    }
+  }
+}
+
 /**
  * Get cursor kind name as a string
  */
@@ -2,6 +2,7 @@
 #include <cmath>
 #include <cstring>
 #include <cstdlib>
+#include <thread>
 
 // Constants
 const double PI = 3.14159265358979323846;
@@ -155,27 +156,69 @@ double sum_array_values(DataArray* arr) {
     return sum;
 }
 
+double sum_values(const double* values, size_t count) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        sum += values[i];
+    }
+    return sum;
+}
+
+void scale_values(double* values, size_t count, double factor) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] *= factor;
+    }
+}
+
 // Opaque context implementation
+struct OpaqueCounter {
+    ContextHandle ctx;
+    int count;
+};
+
 struct OpaqueContext {
     int internal_value;
     void* internal_data;
+    struct OpaqueCounter counter;
 };
 
+static int live_context_count = 0;
+
 ContextHandle create_context(void) {
     ContextHandle ctx = (ContextHandle)malloc(sizeof(struct OpaqueContext));
     if (ctx) {
         ctx->internal_value = 42;
         ctx->internal_data = nullptr;
+        ctx->counter.ctx = ctx;
+        ctx->counter.count = 0;
+        live_context_count++;
     }
     return ctx;
 }
 
 void destroy_context(ContextHandle ctx) {
     if (ctx) {
+        live_context_count--;
         free(ctx);
     }
 }
 
+int live_contexts(void) {
+    return live_context_count;
+}
+
+CounterHandle context_counter(ContextHandle ctx) {
+    return ctx ? &ctx->counter : nullptr;
+}
+
+int counter_increment(CounterHandle counter) {
+    return ++counter->count;
+}
+
+ContextHandle counter_context(CounterHandle counter) {
+    return counter->ctx;
+}
+
 int context_do_something(ContextHandle ctx, int value) {
     if (!ctx) return -1;
     return ctx->internal_value + value;
@@ -222,4 +265,23 @@ Transform create_transform(MathFunc func, double param) {
     t.transform = func ? func : example_transform;
     t.parameter = param;
     return t;
-}
\ No newline at end of file
+}
+
+double apply_function(MathFunc func, double x) {
+    return func ? func(x) : x;
+}
+
+void notify_later(double value, ValueListener listener, void* user_data) {
+    std::thread([value, listener, user_data] { listener(value, user_data); }).detach();
+}
+
+// Returns the number of values visited
+int visit_values(const double* values, size_t count, ValueVisitor visitor, void* user_data) {
+    size_t i = 0;
+    while (i < count) {
+        if (visitor(values[i++], user_data) != 0) {
+            break;
+        }
+    }
+    return static_cast<int>(i);
+}
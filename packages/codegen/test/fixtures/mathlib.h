@@ -68,6 +68,8 @@ typedef struct {
 
 // Opaque pointer type (forward declaration)
 typedef struct OpaqueContext* ContextHandle;
+// Owned by a context, only valid while the context is alive
+typedef struct OpaqueCounter* CounterHandle;
 
 // Typedef to basic type
 typedef double Scalar;
@@ -84,6 +86,12 @@ typedef struct {
 // Function pointer typedef
 typedef double (*MathFunc)(double x);
 
+// Visitor with a user-data pointer; returns non-zero to stop
+typedef int (*ValueVisitor)(double value, void* user_data);
+
+// Listener called back later, possibly from another thread
+typedef void (*ValueListener)(double value, void* user_data);
+
 // Struct containing function pointer
 typedef struct {
     MathFunc transform;
@@ -104,10 +112,18 @@ DataArray create_data_array(const char* name);
 void add_value_to_array(DataArray* arr, double value);
 double sum_array_values(DataArray* arr);
 
+// Buffer functions (pointer + element count)
+double sum_values(const double* values, size_t count);
+void scale_values(double* values, size_t count, double factor);
+
 // Opaque handle functions
 ContextHandle create_context(void);
 void destroy_context(ContextHandle ctx);
 int context_do_something(ContextHandle ctx, int value);
+int live_contexts(void);
+CounterHandle context_counter(ContextHandle ctx);
+int counter_increment(CounterHandle counter);
+ContextHandle counter_context(CounterHandle counter);
 
 // Function using typedef'd types
 Scalar scalar_multiply(Scalar a, Scalar b);
@@ -120,6 +136,9 @@ const char* get_message_text(ComplexMessage* msg);
 // Function pointer operations
 double apply_transform(Transform t, double x);
 Transform create_transform(MathFunc func, double param);
+double apply_function(MathFunc func, double x);
+void notify_later(double value, ValueListener listener, void* user_data);  // from another thread
+int visit_values(const double* values, size_t count, ValueVisitor visitor, void* user_data);
 
 #ifdef __cplusplus
 }
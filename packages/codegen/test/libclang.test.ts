@@ -1,6 +1,13 @@
 import assert from 'node:assert/strict';
 import { execSync } from 'node:child_process';
-import { cpSync, existsSync, mkdtempSync, writeFileSync } from 'node:fs';
+import {
+  cpSync,
+  existsSync,
+  mkdtempSync,
+  readFileSync,
+  rmSync,
+  writeFileSync,
+} from 'node:fs';
 import { tmpdir } from 'node:os';
 import { join } from 'node:path';
 import { describe, it } from 'node:test';
@@ -179,4 +186,60 @@ int main() {
       }
     }
   });
+
+  it("matches node-clang-raw's checked-in bindings", async () => {
+    const llvm = '/opt/homebrew/Cellar/llvm/20.1.8';
+    const outputDir = mkdtempSync(join(tmpdir(), 'node-clang-raw-'));
+    try {
+      // Same options as regenerate-bindings.sh
+      const extensions = [
+        ['RegisterRecordLayout', './ext/record-layout.ts'],
+        ['RegisterIncludeGraph', './ext/include-graph.ts'],
+        ['RegisterReferences', './ext/references.ts'],
+        ['RegisterCursorMap', './ext/cursor-map.ts'],
+        ['RegisterCursorInfo', './ext/cursor.ts'],
+        ['RegisterHeaderAST', './ext/header-ast.ts'],
+      ];
+      const children = [
+        'CXCursor',
+        'CXType',
+        'CXSourceLocation',
+        'CXSourceRange',
+        'CXFile',
+        'CXString',
+        'CXDiagnostic',
+        'CXDiagnosticSet',
+        'CXModule',
+        'CXTargetInfo',
+      ];
+      await generateBindings([`${llvm}/include/clang-c/Index.h`], {
+        outputDir,
+        packageName: 'node-clang-raw',
+        packageVersion: '0.0.1',
+        libraryName: 'clang',
+        headerIncludePath: 'clang-c/Index.h',
+        includePaths: [`${llvm}/include`],
+        libraryPaths: [`${llvm}/lib`],
+        libraries: ['clang'],
+        nativeExtensions: extensions.map(([registrar]) => registrar!),
+        tsExtensions: extensions.map(([, module]) => module!),
+        ownership: [
+          { owner: 'CXIndex', child: 'CXTranslationUnit' },
+          ...children.map((child) => ({ owner: 'CXTranslationUnit', child })),
+        ],
+      });
+
+      // Hand edits to the generated files are lost on the next regeneration
+      const pkg = join(import.meta.dirname, '../../node-clang-raw');
+      for (const file of ['src/binding.cpp', 'index.ts']) {
+        assert.ok(
+          readFileSync(join(outputDir, file), 'utf-8') ===
+            readFileSync(join(pkg, file), 'utf-8'),
+          `${file} is not the generator's output; run regenerate-bindings.sh`,
+        );
+      }
+    } finally {
+      rmSync(outputDir, { recursive: true, force: true });
+    }
+  });
 });
@@ -1,10 +1,56 @@
 import assert from 'node:assert/strict';
 import { execSync } from 'node:child_process';
-import { cpSync, existsSync, mkdtempSync } from 'node:fs';
+import {
+  cpSync,
+  existsSync,
+  mkdtempSync,
+  readFileSync,
+  rmSync,
+  statSync,
+  writeFileSync,
+} from 'node:fs';
 import { tmpdir } from 'node:os';
 import { join } from 'node:path';
 import { describe, it } from 'node:test';
 import { generateBindings } from '../generator.ts';
+import { parseHeader } from '../h-parser/index.ts';
+import { treeShake } from '../tree-shake.ts';
+import { TypeMapper } from '../type-mapper.ts';
+import type { GeneratorOptions } from '../types.ts';
+
+const fixturesDir = join(import.meta.dirname, 'fixtures');
+
+/**
+ * Generates mathlib bindings with `options` over the defaults, builds them
+ * with the fixture's mathlib.cpp and passes the output directory to `use`.
+ * The temp directory is removed afterwards.
+ */
+async function buildMathlib(
+  options: Partial<GeneratorOptions>,
+  use: (outputDir: string) => Promise<void>,
+): Promise<void> {
+  const tempDir = mkdtempSync(join(tmpdir(), 'mathlib-build-'));
+  const outputDir = join(tempDir, 'mathlib-binding');
+  try {
+    await generateBindings([join(fixturesDir, 'mathlib.h')], {
+      outputDir,
+      packageName: 'mathlib-binding',
+      packageVersion: '0.0.1',
+      libraryName: 'mathlib',
+      includePaths: [fixturesDir],
+      ...options,
+    });
+    cpSync(
+      join(fixturesDir, 'mathlib.cpp'),
+      join(outputDir, 'src', 'mathlib.cpp'),
+    );
+    execSync('npm install', { cwd: outputDir, stdio: 'inherit' });
+    execSync('npm run build', { cwd: outputDir, stdio: 'inherit' });
+    await use(outputDir);
+  } finally {
+    rmSync(tempDir, { recursive: true, force: true });
+  }
+}
 
 describe('MathLib Bindings', () => {
   let tempDir: string;
@@ -27,7 +73,6 @@ describe('MathLib Bindings', () => {
 
     try {
       // Copy mathlib source files to temp dir
-      const fixturesDir = join(import.meta.dirname, 'fixtures');
       cpSync(join(fixturesDir, 'mathlib.h'), join(tempDir, 'mathlib.h'));
       cpSync(join(fixturesDir, 'mathlib.cpp'), join(tempDir, 'mathlib.cpp'));
 
@@ -39,6 +84,9 @@ describe('MathLib Bindings', () => {
         packageVersion: '0.0.1',
         libraryName: 'mathlib',
         headerIncludePath: 'mathlib.h',
+        manyFunctions: ['add', 'power', 'calculate'],
+        callbacks: [{ ctype: 'ValueListener', mode: 'threadsafe' }],
+        ownership: [{ owner: 'ContextHandle', child: 'CounterHandle' }],
       });
 
       // Copy the mathlib source to the generated binding directory
@@ -56,8 +104,8 @@ describe('MathLib Bindings', () => {
 
       // Add mathlib.h include directory
       cmakeContent = cmakeContent.replace(
-        'file(GLOB SOURCE_FILES "src/*.cpp" "src/*.cc")',
-        'file(GLOB SOURCE_FILES "src/*.cpp" "src/*.cc")\ninclude_directories(${CMAKE_CURRENT_SOURCE_DIR}/src)',
+        'file(GLOB SOURCE_FILES CONFIGURE_DEPENDS "src/*.cpp" "src/*.cc")',
+        'file(GLOB SOURCE_FILES CONFIGURE_DEPENDS "src/*.cpp" "src/*.cc")\ninclude_directories(${CMAKE_CURRENT_SOURCE_DIR}/src)',
       );
 
       await import('node:fs').then((fs) =>
@@ -122,6 +170,12 @@ describe('MathLib Bindings', () => {
       // Test enum
       assert.strictEqual(addon.OP_ADD, 0, 'enum OP_ADD should be 0');
       assert.strictEqual(addon.OP_MULTIPLY, 2, 'enum OP_MULTIPLY should be 2');
+      assert.strictEqual(
+        addon.enumName('MathOperation', 2),
+        'OP_MULTIPLY',
+        'enumName should map values back to constant names',
+      );
+      assert.strictEqual(addon.enumName('MathOperation', 42), undefined);
 
       // Test calculate with enum
       assert.strictEqual(
@@ -139,8 +193,14 @@ describe('MathLib Bindings', () => {
       const p1 = addon.createPoint2D({ x: 3.0, y: 4.0 });
       const p2 = addon.createPoint2D({ x: 0.0, y: 0.0 });
 
-      // Test create_point function
-      const _p3 = addon.create_point(1.0, 2.0);
+      // Test create_point function (small structs come back as plain objects)
+      const p3 = addon.create_point(1.0, 2.0);
+      assert.deepStrictEqual(p3, { x: 1.0, y: 2.0 }, 'create_point by value');
+      assert.strictEqual(
+        addon.distance({ x: 0, y: 0 }, { x: 3, y: 4 }),
+        5,
+        'distance accepts object literals',
+      );
 
       // Test distance function (uses struct parameters)
       const dist = addon.distance(p1, p2);
@@ -159,6 +219,123 @@ describe('MathLib Bindings', () => {
         'add_points y coordinate',
       );
 
+      // Nested by-value struct (Circle holds a Point2D)
+      const circle = addon.create_circle(p1, 2.0);
+      assert.deepStrictEqual(circle, {
+        center: { x: 3.0, y: 4.0 },
+        radius: 2.0,
+      });
+      assert.strictEqual(addon.getCircle_radius(circle), 2.0);
+      assert.strictEqual(addon.circle_contains_point(circle, p1), 1);
+
+      // Pointer + count parameters take TypedArrays; count defaults to length
+      const values = new Float64Array([1, 2, 3, 4]);
+      assert.strictEqual(addon.sum_values(values), 10);
+      assert.strictEqual(addon.sum_values(values, 2), 3);
+      addon.scale_values(values, undefined, 2);
+      assert.deepStrictEqual(Array.from(values), [2, 4, 6, 8]);
+      assert.throws(() => addon.sum_values(values, 5), RangeError);
+
+      // Numeric array fields come back as TypedArrays, char arrays as strings
+      const data = addon.create_data_array('samples');
+      addon.add_value_to_array(data, 1.5);
+      const fieldValues = addon.getDataArray_values(data);
+      assert.ok(fieldValues instanceof Float64Array);
+      assert.strictEqual(fieldValues.length, 10);
+      assert.strictEqual(fieldValues[0], 1.5);
+      assert.strictEqual(addon.getDataArray_name(data), 'samples');
+
+      // Vectorized companions evaluate whole columns in one call
+      assert.deepStrictEqual(
+        addon.add_many(new Int32Array([1, 2, 3]), new Int32Array([10, 20, 30])),
+        new Int32Array([11, 22, 33]),
+      );
+      const powers = new Float64Array(3);
+      assert.strictEqual(
+        addon.power_many(
+          new Float64Array([2, 3, 4]),
+          new Int32Array([3, 2, 1]),
+          powers,
+        ),
+        powers,
+      );
+      assert.deepStrictEqual(Array.from(powers), [8, 9, 4]);
+      assert.deepStrictEqual(
+        Array.from(
+          addon.calculate_many(
+            new Float64Array([10, 10]),
+            new Float64Array([5, 5]),
+            new Int32Array([addon.OP_ADD, addon.OP_SUBTRACT]),
+          ),
+        ),
+        [15, 5],
+      );
+      assert.throws(
+        () => addon.add_many(new Int32Array(2), new Int32Array(3)),
+        TypeError,
+      );
+      assert.strictEqual(addon.multiply_many, undefined);
+
+      // Arguments of the wrong type throw instead of reaching C
+      assert.throws(() => addon.add('2', 3), TypeError);
+      assert.throws(() => addon.create_data_array(42), TypeError);
+      assert.throws(() => addon.add_value_to_array(data, '1'), TypeError);
+
+      // JS functions are passed where C expects a function pointer
+      assert.strictEqual(addon.apply_function((x: number) => x * 2, 3), 6);
+      assert.strictEqual(addon.apply_function(null, 3), 3);
+      const visited: number[] = [];
+      const visitor = (v: number) => {
+        visited.push(v);
+        return v >= 2 ? 1 : 0;
+      };
+      assert.strictEqual(
+        addon.visit_values(new Float64Array([1, 2, 3]), undefined, visitor),
+        2,
+      );
+      assert.deepStrictEqual(visited, [1, 2]);
+      assert.throws(
+        () =>
+          addon.visit_values(new Float64Array([1, 2]), undefined, () => {
+            throw new Error('stop');
+          }),
+        /stop/,
+      );
+      assert.throws(() => addon.apply_function(42, 1), TypeError);
+
+      // Threadsafe callbacks are queued back onto the JS thread
+      const keepAlive = setInterval(() => {}, 1000);
+      const later = await new Promise<number>((resolve) =>
+        addon.notify_later(7, resolve),
+      );
+      assert.strictEqual(later, 7);
+      // A function passed again reuses the reference and tsfn it retained
+      let deliver: (value: number) => void = () => {};
+      const listener = (value: number) => deliver(value);
+      for (const value of [8, 9]) {
+        const received = await new Promise<number>((resolve) => {
+          deliver = resolve;
+          addon.notify_later(value, listener);
+        });
+        assert.strictEqual(received, value);
+      }
+      clearInterval(keepAlive);
+
+      // Handles returned by create_context are disposable, and children pin
+      // the context they came from
+      const liveBefore = addon.live_contexts();
+      const context = addon.create_context();
+      const counter = addon.context_counter(context);
+      assert.strictEqual(addon.counter_increment(counter), 1);
+      assert.strictEqual(addon.counter_context(counter), context);
+      assert.strictEqual(addon.live_contexts(), liveBefore + 1);
+      context[Symbol.dispose]();
+      assert.strictEqual(addon.live_contexts(), liveBefore);
+      const destroyed = addon.create_context();
+      addon.destroy_context(destroyed);
+      destroyed[Symbol.dispose](); // already destroyed: no-op
+      assert.strictEqual(addon.live_contexts(), liveBefore);
+
       console.log('  ✅ MathLib binding test succeeded!');
     } finally {
       // Clean up temp directory (unless we nulled it to preserve for debugging)
@@ -169,4 +346,305 @@ describe('MathLib Bindings', () => {
       }
     }
   });
+
+  it('should back selected structs with ArrayBuffer views', async () => {
+    const structViews = ['Circle', 'DataArray', 'NumberUnion', 'Transform'];
+    await buildMathlib({ structViews }, async (outputDir) => {
+      const addon = await import(join(outputDir, 'index.ts'));
+
+      // Circle is a view; its nested Point2D becomes a view too, so points
+      // are passed as Point2D views rather than plain objects
+      const point = (x: number, y: number) => {
+        const p = new addon.Point2D();
+        p.x = x;
+        p.y = y;
+        return p;
+      };
+      const circle = addon.create_circle(point(3.0, 4.0), 2.0);
+      assert.ok(circle instanceof addon.Circle);
+      assert.strictEqual(circle.byteLength, addon.Circle.byteLength);
+      assert.strictEqual(circle.center.x, 3.0);
+      assert.strictEqual(circle.radius, 2.0);
+      assert.strictEqual(addon.circle_area(circle), Math.PI * 4.0);
+
+      // Results can be written into a preallocated view
+      const out = new addon.Circle();
+      assert.strictEqual(addon.create_circle(point(1.0, 1.0), 5.0, out), out);
+      assert.strictEqual(out.radius, 5.0);
+      out.radius = 1.0;
+      assert.strictEqual(addon.circle_area(out), Math.PI);
+
+      // Union members alias the same bytes
+      const u = addon.create_int_union(42);
+      assert.strictEqual(u.i, 42);
+      assert.strictEqual(addon.get_int_from_union(u), 42);
+      assert.strictEqual(
+        addon.get_double_from_union(addon.create_double_union(1.5)),
+        1.5,
+      );
+
+      // Array fields of a view alias its buffer
+      const data = addon.create_data_array('view');
+      addon.add_value_to_array(data, 2.5);
+      assert.strictEqual(data.values[0], 2.5);
+      assert.strictEqual(addon.sum_array_values(data), 2.5);
+      const copy = addon.createDataArray(addon.getDataArrayFields(data));
+      assert.strictEqual(
+        new TextDecoder().decode(copy.name.subarray(0, 4)),
+        'view',
+      );
+      assert.strictEqual(copy.values[0], 2.5);
+    });
+  });
+
+  it('should build sharded output', async () => {
+    const options = {
+      manyFunctions: ['power'],
+      shards: 4,
+      // LTO across the shards and the shared inline helpers
+      buildProfile: 'speed' as const,
+    };
+    await buildMathlib(options, async (outputDir) => {
+      for (let k = 0; k < 4; k++) {
+        const shard = join(outputDir, 'src', `binding_shard_${k}.cpp`);
+        assert.ok(existsSync(shard));
+      }
+
+      // Exports from every shard and from binding.cpp's enum tables
+      const addon = await import(join(outputDir, 'index.ts'));
+      assert.strictEqual(addon.add(2, 3), 5);
+      assert.strictEqual(addon.OP_MULTIPLY, 2);
+      assert.strictEqual(addon.enumName('MathOperation', 2), 'OP_MULTIPLY');
+      assert.deepStrictEqual(addon.create_point(1.5, 0), { x: 1.5, y: 0 });
+      assert.strictEqual(
+        addon.distance(addon.createPoint2D({ x: 3, y: 4 }), { x: 0, y: 0 }),
+        5,
+      );
+      assert.deepStrictEqual(
+        [
+          ...addon.power_many(
+            new Float64Array([2, 3]),
+            new Int32Array([2, 2]),
+          ),
+        ],
+        [4, 9],
+      );
+
+      // Fewer shards leave no stale ones behind
+      await generateBindings([join(fixturesDir, 'mathlib.h')], {
+        outputDir,
+        packageName: 'mathlib-binding',
+        libraryName: 'mathlib',
+        includePaths: [fixturesDir],
+        shards: 2,
+      });
+      assert.ok(!existsSync(join(outputDir, 'src', 'binding_shard_2.cpp')));
+    });
+  });
+
+  it('should build with precompiled headers and a unity build', async () => {
+    const options = {
+      shards: 4,
+      precompileHeaders: true,
+      unityBatchSize: 2,
+      buildProfile: 'size' as const,
+    };
+    await buildMathlib(options, async (outputDir) => {
+      const cmake = readFileSync(join(outputDir, 'CMakeLists.txt'), 'utf-8');
+      assert.match(
+        cmake,
+        /target_precompile_headers\(\$\{PROJECT_NAME\} PRIVATE\n  <napi\.h>/,
+      );
+      assert.match(cmake, /UNITY_BUILD ON UNITY_BUILD_BATCH_SIZE 2/);
+
+      // Shards merged into unity sources still register every export; the
+      // hand-written mathlib.cpp is compiled on its own
+      const addon = await import(join(outputDir, 'index.ts'));
+      assert.strictEqual(addon.add(2, 3), 5);
+      assert.strictEqual(addon.OP_MULTIPLY, 2);
+      assert.deepStrictEqual(addon.create_point(1.5, 0), { x: 1.5, y: 0 });
+    });
+  });
+
+  it('should bind only what an allowlist reaches', async () => {
+    const allowlist = ['add', 'create_circle', 'OP_ADD'];
+    await buildMathlib({ allowlist }, async (outputDir) => {
+      const index = readFileSync(join(outputDir, 'index.ts'), 'utf-8');
+      const binding = readFileSync(
+        join(outputDir, 'src', 'binding.cpp'),
+        'utf-8',
+      );
+      // Circle and the Point2D it contains come with create_circle
+      assert.match(index, /export function create_circle\(/);
+      assert.match(binding, /Point2D/);
+      assert.match(index, /OP_ADD/);
+      assert.doesNotMatch(
+        index,
+        /export function (subtract|distance|create_context)\(/,
+      );
+      assert.doesNotMatch(binding, /NumberUnion|DataArray|ContextHandle/);
+
+      const addon = await import(join(outputDir, 'index.ts'));
+      assert.strictEqual(addon.add(2, 3), 5);
+      assert.strictEqual(addon.subtract, undefined);
+      assert.strictEqual(addon.OP_ADD, 0);
+    });
+
+    // A kept handle type keeps the function that disposes it
+    const handles = treeShake(
+      parseHeader(join(fixturesDir, 'mathlib.h'), { language: 'c' }),
+      ['create_context'],
+    );
+    assert.deepStrictEqual(
+      handles.functions!.map((f) => f.name).sort(),
+      ['create_context', 'destroy_context'],
+    );
+  });
+
+  it('parses several headers in parallel like it does serially', async () => {
+    const parallelTempDir = mkdtempSync(
+      join(tmpdir(), 'mathlib-parallel-test-'),
+    );
+    const mathlibHeader = join(import.meta.dirname, 'fixtures', 'mathlib.h');
+    // extra.h includes mathlib.h, so its AST repeats every mathlib declaration
+    const extraHeader = join(parallelTempDir, 'extra.h');
+    writeFileSync(
+      extraHeader,
+      `#include "${mathlibHeader}"\nint extra_twice(int x);\n`,
+    );
+
+    const outputs = [];
+    for (const parseJobs of [1, 2]) {
+      const outputDir = join(parallelTempDir, `jobs-${parseJobs}`);
+      await generateBindings([mathlibHeader, extraHeader], {
+        outputDir,
+        packageName: 'mathlib-binding',
+        libraryName: 'mathlib',
+        parseJobs,
+      });
+      outputs.push({
+        binding: readFileSync(join(outputDir, 'src', 'binding.cpp'), 'utf-8'),
+        index: readFileSync(join(outputDir, 'index.ts'), 'utf-8'),
+      });
+    }
+    const [serial, parallel] = outputs;
+    assert.strictEqual(parallel!.binding, serial!.binding);
+    assert.strictEqual(parallel!.index, serial!.index);
+    // Declarations shared by both headers are bound once
+    assert.strictEqual(
+      serial!.index.match(/export function add\(/g)?.length,
+      1,
+    );
+    assert.match(serial!.index, /export function extra_twice\(/);
+  });
+
+  it('parses the header the same natively and with the JS walker', () => {
+    const header = join(import.meta.dirname, 'fixtures', 'mathlib.h');
+    const options = { language: 'c++' as const, includeDocumentation: true };
+
+    const native = parseHeader(header, options);
+    const walked = parseHeader(header, { ...options, jsWalker: true });
+
+    assert.ok(native.structs.length > 0);
+    assert.ok((native.functions ?? []).length > 0);
+    assert.deepStrictEqual(native, walked);
+  });
+
+  it('maps types from the descriptors libclang reports', () => {
+    const ast = parseHeader(join(fixturesDir, 'mathlib.h'), {
+      language: 'c++',
+    });
+    const scalarMultiply = ast.functions!.find(
+      (f) => f.name === 'scalar_multiply',
+    )!;
+    const mathFunc = ast.typedefs.find((t) => t.name === 'MathFunc')!;
+    const transform = ast.structs.find((s) => s.name === 'Transform')!;
+
+    // CXType_Double
+    assert.strictEqual(scalarMultiply.return.canonicalKind, 22);
+    assert.strictEqual(mathFunc.underlyingType?.isFunctionPointer, true);
+    assert.strictEqual(
+      mathFunc.underlyingType?.pointeeType?.resultType?.spelling,
+      'double',
+    );
+    assert.strictEqual(transform.fields[0]!.typeInfo?.isFunctionPointer, true);
+
+    TypeMapper.setTypedefs([]);
+    TypeMapper.setTypeDescriptors(ast);
+    // No typedef table to follow: the canonical kinds alone decide
+    assert.strictEqual(TypeMapper.getTsType('Scalar'), 'number');
+    assert.strictEqual(TypeMapper.isEnumType('MathOperation'), true);
+    assert.strictEqual(TypeMapper.isFunctionPointerType('MathFunc'), true);
+    assert.strictEqual(TypeMapper.isStructType('Scalar'), false);
+    assert.strictEqual(TypeMapper.isStructType('Transform'), true);
+  });
+
+  it('keeps threadsafe callbacks to typedefs with user data', () => {
+    const ast = parseHeader(join(fixturesDir, 'mathlib.h'), {
+      language: 'c++',
+    });
+    TypeMapper.setTypedefs(ast.typedefs);
+    TypeMapper.setTypeDescriptors(ast);
+
+    // One trampoline per typedef: without user data, retained functions
+    // would overwrite each other
+    assert.throws(
+      () =>
+        TypeMapper.setCallbackTypes([
+          { ctype: 'MathFunc', mode: 'threadsafe' },
+        ]),
+      /MathFunc has no void \* user-data parameter/,
+    );
+    TypeMapper.setCallbackTypes([
+      { ctype: 'ValueListener', mode: 'threadsafe' },
+    ]);
+    assert.strictEqual(
+      TypeMapper.getCallbackType('ValueListener')?.userData,
+      1,
+    );
+  });
+
+  it('reuses cached ASTs and wrappers and leaves unchanged files alone', async () => {
+    const cacheTempDir = mkdtempSync(join(tmpdir(), 'mathlib-cache-test-'));
+    const headerPath = join(cacheTempDir, 'mathlib.h');
+    cpSync(join(import.meta.dirname, 'fixtures', 'mathlib.h'), headerPath);
+    const options = {
+      outputDir: join(cacheTempDir, 'mathlib-binding'),
+      packageName: 'mathlib-binding',
+      libraryName: 'mathlib',
+      headerIncludePath: 'mathlib.h',
+      cacheDir: join(cacheTempDir, 'cache'),
+    };
+    const bindingPath = join(options.outputDir, 'src', 'binding.cpp');
+
+    await generateBindings([headerPath], options);
+    const first = readFileSync(bindingPath, 'utf-8');
+    const firstMtime = statSync(bindingPath).mtimeMs;
+
+    await generateBindings([headerPath], options);
+    assert.strictEqual(statSync(bindingPath).mtimeMs, firstMtime);
+
+    // A new declaration is picked up and only its wrapper is new
+    const header = readFileSync(headerPath, 'utf-8');
+    writeFileSync(
+      headerPath,
+      `${header}\nint cache_probe(const char *name);\n`,
+    );
+    await generateBindings([headerPath], options);
+    const second = readFileSync(bindingPath, 'utf-8');
+    assert.notStrictEqual(second, first);
+    assert.match(second, /cache_probe/);
+
+    // The caches give the same output as a cold run
+    const cold = mkdtempSync(join(tmpdir(), 'mathlib-cold-test-'));
+    await generateBindings([headerPath], {
+      ...options,
+      outputDir: cold,
+      cacheDir: undefined,
+    });
+    assert.strictEqual(
+      readFileSync(join(cold, 'src', 'binding.cpp'), 'utf-8'),
+      second,
+    );
+  });
 });
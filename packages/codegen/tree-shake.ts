@@ -0,0 +1,188 @@
+import type { HeaderAST } from './h-parser/types.ts';
+import { TypeMapper } from './type-mapper.ts';
+
+// The parts of binding-gen's StrategyPlan that name C declarations
+export interface PlanRoots {
+  resources?: Array<{
+    ctype?: string;
+    create?: string;
+    destroy?: string;
+    methods?: Array<{ c: string }>;
+    views?: Array<{ ptr: string; length?: string }>;
+  }>;
+  enums?: Array<{ name: string }>;
+  callbacks?: Array<{ ctype: string }>;
+  errors?: Array<{ function: string }>;
+  ownership?: Array<{ owner: string; child: string }>;
+}
+
+/**
+ * Every function, type and enum a StrategyPlan refers to. View lengths may
+ * name a struct field rather than a function; names that are not declared in
+ * the header are reported by treeShake.
+ */
+export function planRoots(plan: PlanRoots): string[] {
+  const roots: string[] = [];
+  for (const resource of plan.resources ?? []) {
+    roots.push(
+      ...[resource.ctype, resource.create, resource.destroy].filter(
+        (name): name is string => !!name,
+      ),
+      ...(resource.methods ?? []).map((method) => method.c),
+      ...(resource.views ?? []).flatMap((view) =>
+        view.length ? [view.ptr, view.length] : [view.ptr],
+      ),
+    );
+  }
+  roots.push(
+    ...(plan.enums ?? []).map((e) => e.name),
+    ...(plan.callbacks ?? []).map((callback) => callback.ctype),
+    ...(plan.errors ?? []).map((rule) => rule.function),
+    ...(plan.ownership ?? []).flatMap((rule) => [rule.owner, rule.child]),
+  );
+  return [...new Set(roots)];
+}
+
+function declName(name: string): string {
+  return name.replace(/^(struct|union|enum)\s+/, '');
+}
+
+// Identifiers in a type spelling, e.g. 'enum CXChildVisitResult (*)(CXCursor,
+// CXClientData)' -> ['enum', 'CXChildVisitResult', 'CXCursor', 'CXClientData']
+function identifiers(spelling: string): string[] {
+  return spelling.match(/[A-Za-z_]\w*/g) ?? [];
+}
+
+/**
+ * The part of `ast` reachable from `roots`: the listed functions, the
+ * structs, enums and typedefs named in their signatures, and, transitively,
+ * the types of those typedefs and struct fields. Roots may also name types,
+ * or constants of an enum to keep it. The types named by `ownership` rules
+ * are kept, and so is the dispose function of every kept type, since the
+ * generated finalizers and `[Symbol.dispose]` call it. Interfaces, protocols
+ * and classes are left as they are.
+ */
+export function treeShake(
+  ast: HeaderAST,
+  roots: readonly string[],
+  ownership: ReadonlyArray<{ owner: string; child: string }> = [],
+): HeaderAST {
+  const functions = new Map(
+    (ast.functions ?? []).map((func) => [func.name, func]),
+  );
+  const structs = new Map(
+    ast.structs.map((struct) => [declName(struct.name), struct]),
+  );
+  const enums = new Map(
+    ast.enums.filter((e) => e.name).map((e) => [declName(e.name), e]),
+  );
+  const typedefs = new Map(
+    ast.typedefs.map((typedef) => [typedef.name, typedef]),
+  );
+  const enumOfConstant = new Map(
+    ast.enums.flatMap((e) => e.constants.map((c) => [c.name, e] as const)),
+  );
+  // Same candidates as TypeMapper.setDisposers, which keeps the first per type
+  const disposers = new Map<string, string>();
+  for (const func of ast.functions ?? []) {
+    const type = TypeMapper.getDisposedType(func);
+    if (type && !disposers.has(declName(type))) {
+      disposers.set(declName(type), func.name);
+    }
+  }
+
+  const kept = new Set<string>();
+  const keptEnums = new Set<HeaderAST['enums'][number]>();
+  const queue: string[] = [];
+  const declared = (name: string) =>
+    functions.has(name) ||
+    structs.has(name) ||
+    enums.has(name) ||
+    typedefs.has(name);
+  const visit = (name: string) => {
+    if (!kept.has(name) && declared(name)) {
+      kept.add(name);
+      queue.push(name);
+    }
+  };
+
+  const missing: string[] = [];
+  for (const root of roots) {
+    const owner = enumOfConstant.get(root);
+    if (owner) {
+      // Anonymous enums are only reachable through their constants
+      keptEnums.add(owner);
+    } else if (!declared(root)) {
+      missing.push(root);
+    }
+    visit(root);
+  }
+  for (const rule of ownership) {
+    visit(rule.owner.trim());
+    visit(rule.child.trim());
+  }
+
+  while (queue.length > 0) {
+    const name = queue.pop()!;
+    const uses: string[] = [];
+    const func = functions.get(name);
+    if (func) {
+      uses.push(
+        func.return.spelling,
+        ...func.params.map((param) => param.type.spelling),
+      );
+    }
+    const typedef = typedefs.get(name);
+    if (typedef) {
+      uses.push(typedef.underlying);
+    }
+    const struct = structs.get(name);
+    if (struct) {
+      uses.push(...struct.fields.map((field) => field.type));
+      // The generators name a struct's class after the typedef naming it
+      for (const alias of ast.typedefs) {
+        if (
+          alias.underlying === struct.name ||
+          alias.spelling === struct.name ||
+          alias.underlying === `${struct.kind ?? 'struct'} ${name}`
+        ) {
+          uses.push(alias.name);
+        }
+      }
+    }
+    for (const use of uses) {
+      identifiers(use).forEach(visit);
+    }
+    const disposer = disposers.get(name);
+    if (disposer) {
+      visit(disposer);
+    }
+  }
+
+  if (missing.length > 0) {
+    const names = missing.join(', ');
+    console.warn(`⚠️  Allowlisted names not declared in the header: ${names}`);
+  }
+
+  const shaken: HeaderAST = {
+    ...ast,
+    functions: (ast.functions ?? []).filter((func) => kept.has(func.name)),
+    structs: ast.structs.filter((struct) => kept.has(declName(struct.name))),
+    enums: ast.enums.filter(
+      (e) => keptEnums.has(e) || (e.name && kept.has(declName(e.name))),
+    ),
+    typedefs: ast.typedefs.filter((typedef) => kept.has(typedef.name)),
+  };
+  const counts = [
+    [shaken.functions!.length, ast.functions?.length ?? 0, 'functions'],
+    [shaken.structs.length, ast.structs.length, 'structs'],
+    [shaken.enums.length, ast.enums.length, 'enums'],
+    [shaken.typedefs.length, ast.typedefs.length, 'typedefs'],
+  ];
+  console.log(
+    `✂️  Tree-shaken to ${counts
+      .map(([after, before, what]) => `${after}/${before} ${what}`)
+      .join(', ')}`,
+  );
+  return shaken;
+}
@@ -1,4 +1,35 @@
-import type { TypeMapping } from './types.ts';
+import type {
+  Function as FunctionDecl,
+  HeaderAST,
+  Struct,
+  StructField,
+  TypeInfo,
+} from './h-parser/types.ts';
+import type { CallbackMode, CallbackSignature, TypeMapping } from './types.ts';
+
+// CXTypeKind values read from the parser's TypeInfo descriptors
+const CXType = {
+  Bool: 3,
+  Char_U: 4,
+  UChar: 5,
+  UShort: 8,
+  UInt: 9,
+  ULong: 10,
+  ULongLong: 11,
+  Char_S: 13,
+  SChar: 14,
+  Short: 16,
+  Int: 17,
+  Long: 18,
+  LongLong: 19,
+  Float: 21,
+  Double: 22,
+  LongDouble: 23,
+  Pointer: 101,
+  Record: 105,
+  Enum: 106,
+  Typedef: 107,
+} as const;
 
 export class TypeMapper {
   private static knownStructTypes: Set<string> = new Set();
@@ -7,16 +38,543 @@ export class TypeMapper {
   
   static setKnownStructTypes(structNames: string[]) {
     this.knownStructTypes = new Set(structNames);
+    this.clearMemo();
   }
   
   static setTypedefs(typedefs: Array<{ name: string; underlying: string }>) {
     this.typedefMap = new Map(typedefs.map(t => [t.name, t.underlying]));
+    this.clearMemo();
   }
   
   static setEnumTypes(enumNames: string[]) {
     this.enumTypes = new Set(enumNames);
+    this.clearMemo();
+  }
+
+  // Type spelling -> what libclang reported about it (kind, canonical kind,
+  // pointee, ...). Empty for ASTs from parsers that record spellings only,
+  // in which case the predicates below work from the spelling.
+  private static typeDescriptors: Map<string, TypeInfo> = new Map();
+
+  /**
+   * Registers the TypeInfo of every function signature, struct field and
+   * typedef in `ast`, including nested pointee, element and argument types.
+   * Typedef names get their underlying type's description, so a spelling
+   * that only appears inside other typedefs is still known.
+   */
+  static setTypeDescriptors(ast: HeaderAST) {
+    const descriptors = new Map<string, TypeInfo>();
+    const add = (info: TypeInfo | undefined) => {
+      if (!info || info.kind === undefined || descriptors.has(info.spelling)) return;
+      descriptors.set(info.spelling, info);
+      add(info.pointeeType);
+      add(info.elementType);
+      add(info.resultType);
+      info.argTypes?.forEach(add);
+    };
+    for (const func of ast.functions ?? []) {
+      add(func.return);
+      func.params.forEach((param) => add(param.type));
+    }
+    for (const struct of ast.structs) {
+      struct.fields.forEach((field) => add(field.typeInfo));
+    }
+    for (const typedef of ast.typedefs) {
+      const underlying = typedef.underlyingType;
+      add(underlying);
+      if (underlying?.kind !== undefined) {
+        add({
+          ...underlying,
+          spelling: typedef.name,
+          kind: CXType.Typedef,
+          canonicalKind: underlying.canonicalKind ?? underlying.kind,
+        });
+      }
+    }
+    this.typeDescriptors = descriptors;
+    this.clearMemo();
+  }
+
+  // Descriptor for `cType`, ignoring top-level const
+  private static describe(cType: string): TypeInfo | undefined {
+    if (this.typeDescriptors.size === 0) return undefined;
+    return (
+      this.typeDescriptors.get(cType) ??
+      this.typeDescriptors.get(cType.replace(/^const\s+/, '').replace(/\s+const$/, '').trim())
+    );
+  }
+
+  private static canonicalKind(info: TypeInfo): number | undefined {
+    return info.canonicalKind ?? info.kind;
+  }
+
+  // Results of getMapping, resolveTypedef, the is*Type predicates and the
+  // record lookups, per method and spelling. The generators ask about the
+  // same few spellings for every field, parameter and result. The setters
+  // for typedefs, records, enums and descriptors clear it.
+  private static memo: Map<string, Map<string, unknown>> = new Map();
+
+  private static memoized<T>(method: string, cType: string, compute: () => T): T {
+    let results = this.memo.get(method);
+    if (!results) {
+      results = new Map();
+      this.memo.set(method, results);
+    }
+    if (results.has(cType)) return results.get(cType) as T;
+    const result = compute();
+    results.set(cType, result);
+    return result;
+  }
+
+  private static clearMemo() {
+    this.memo = new Map();
+  }
+
+  // Struct/union name -> declaration, for records backed by an ArrayBuffer
+  private static viewStructTypes: Map<string, Struct> = new Map();
+
+  /**
+   * Registers the structs and unions exposed as ArrayBuffer-backed views
+   * (`structViews` generator option; `*` selects every record). Only records
+   * with a compiler-reported size qualify. Records nested by value in a view
+   * become views too, so they can be accessed in place.
+   */
+  static setViewStructTypes(structs: Struct[], selected: string[]) {
+    const sized = new Map(
+      structs.filter((s) => s.size !== undefined && s.size > 0).map((s) => [s.name, s]),
+    );
+    const pending = selected.includes('*')
+      ? [...sized.keys()]
+      : selected.filter((name) => sized.has(name));
+
+    this.viewStructTypes = new Map();
+    while (pending.length > 0) {
+      const name = pending.shift()!;
+      if (this.viewStructTypes.has(name)) continue;
+      const struct = sized.get(name)!;
+      this.viewStructTypes.set(name, struct);
+      for (const field of struct.fields) {
+        const nested = this.findRecordName(field.type, sized);
+        if (nested) pending.push(nested);
+      }
+    }
+    this.clearMemo();
+  }
+
+  static getViewStructTypes(): ReadonlyMap<string, Struct> {
+    return this.viewStructTypes;
+  }
+
+  /** Name of the view-backed record `cType` refers to (through typedefs), if any */
+  static getViewStructName(cType: string): string | undefined {
+    return this.memoized('getViewStructName', cType, () => this.findRecordName(cType, this.viewStructTypes));
+  }
+
+  static isViewStructType(cType: string): boolean {
+    return this.getViewStructName(cType) !== undefined;
+  }
+
+  /** For `T *` / `const T *` where T is view-backed, the name of T */
+  static getViewStructPointerName(cType: string): string | undefined {
+    const cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '').trim();
+    if (!/^[^*]+\*$/.test(cleanType)) return undefined;
+    return this.getViewStructName(cleanType.slice(0, -1).trim());
+  }
+
+  // Looks up `cType` in `records`, following typedefs and struct/union tags
+  private static findRecordName(cType: string, records: { has(name: string): boolean }): string | undefined {
+    let cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '').trim();
+    const seen = new Set<string>();
+    while (!seen.has(cleanType)) {
+      seen.add(cleanType);
+      if (records.has(cleanType)) return cleanType;
+      const tagName = cleanType.replace(/^(struct|union)\s+/, '');
+      if (records.has(tagName)) return tagName;
+      const underlying = this.typedefMap.get(cleanType);
+      if (!underlying) return undefined;
+      cleanType = underlying.replace(/^const\s+/, '').replace(/\s+const$/, '').trim();
+    }
+    return undefined;
+  }
+
+  /** Name of the known struct/union `cType` holds by value (through typedefs), if any */
+  static getRecordName(cType: string): string | undefined {
+    return this.memoized('getRecordName', cType, () => this.findRecordName(cType, this.knownStructTypes));
+  }
+
+  // Largest struct (in bytes) that is marshaled by value as a plain object
+  static readonly maxPodStructSize = 64;
+
+  // Struct name -> fields, in dependency order (nested structs come first)
+  private static podStructTypes: Map<string, StructField[]> = new Map();
+
+  /**
+   * Picks the structs that are passed by value as plain `{ field: value }`
+   * objects instead of heap copies behind a wrapped pointer: at most
+   * maxPodStructSize bytes, with only number, boolean, enum and nested POD
+   * struct fields. Unions and view-backed records are excluded. Needs the
+   * typedefs, enum types and view types to be set first.
+   */
+  static setPodStructTypes(structs: Struct[]) {
+    this.podStructTypes = new Map();
+    this.clearMemo();
+    const candidates = structs.filter(
+      (s) =>
+        s.kind !== 'union' &&
+        !this.viewStructTypes.has(s.name) &&
+        s.size !== undefined &&
+        s.size <= this.maxPodStructSize &&
+        s.fields.length > 0 &&
+        s.fields.every((f) => f.name && f.name.trim() !== ''),
+    );
+
+    // Repeat until stable so structs nesting other POD structs are found
+    // regardless of declaration order
+    let changed = true;
+    while (changed) {
+      changed = false;
+      for (const struct of candidates) {
+        if (this.podStructTypes.has(struct.name)) continue;
+        if (struct.fields.every((f) => this.isPodFieldType(f.type))) {
+          this.podStructTypes.set(struct.name, struct.fields);
+          this.clearMemo();
+          changed = true;
+        }
+      }
+    }
+  }
+
+  private static isPodFieldType(cType: string): boolean {
+    if (this.isArrayType(cType) || this.isPointerType(cType) || this.isFunctionPointerType(cType)) {
+      return false;
+    }
+    if (this.isEnumType(cType) || this.getPodStructName(cType)) return true;
+    const mapping = this.primitiveTypes.get(this.resolveTypedef(cType));
+    return mapping?.napiType === 'Napi::Number' || mapping?.napiType === 'Napi::Boolean';
+  }
+
+  /** Structs registered by setPodStructTypes, nested ones first */
+  static getPodStructTypes(): ReadonlyMap<string, StructField[]> {
+    return this.podStructTypes;
+  }
+
+  /** Name of the POD struct `cType` refers to (through typedefs), if any */
+  static getPodStructName(cType: string): string | undefined {
+    return this.memoized('getPodStructName', cType, () => this.findRecordName(cType, this.podStructTypes));
+  }
+
+  static isPodStructType(cType: string): boolean {
+    return this.getPodStructName(cType) !== undefined;
+  }
+
+  /** Follows typedefs (e.g. `Scalar` -> `double`) down to the underlying spelling */
+  static resolveTypedef(cType: string): string {
+    return this.memoized('resolveTypedef', cType, () => this.followTypedefs(cType));
+  }
+
+  private static followTypedefs(cType: string): string {
+    let cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '').trim();
+    const seen = new Set<string>();
+    while (this.typedefMap.has(cleanType) && !seen.has(cleanType)) {
+      seen.add(cleanType);
+      cleanType = this.typedefMap.get(cleanType)!.replace(/^const\s+/, '').replace(/\s+const$/, '').trim();
+    }
+    return cleanType;
   }
   
+  // TypedArray holding elements of each C type (typedefs resolved first);
+  // `char` is left out since char arrays and pointers are strings
+  private static readonly typedArrayTypes: Map<string, string> = new Map([
+    ['signed char', 'Int8Array'],
+    ['int8_t', 'Int8Array'],
+    ['unsigned char', 'Uint8Array'],
+    ['uint8_t', 'Uint8Array'],
+    ['short', 'Int16Array'],
+    ['int16_t', 'Int16Array'],
+    ['unsigned short', 'Uint16Array'],
+    ['uint16_t', 'Uint16Array'],
+    ['int', 'Int32Array'],
+    ['int32_t', 'Int32Array'],
+    ['unsigned int', 'Uint32Array'],
+    ['uint32_t', 'Uint32Array'],
+    ['long long', 'BigInt64Array'],
+    ['int64_t', 'BigInt64Array'],
+    ['unsigned long long', 'BigUint64Array'],
+    ['uint64_t', 'BigUint64Array'],
+    ['float', 'Float32Array'],
+    ['double', 'Float64Array'],
+  ]);
+
+  /** TypedArray class for elements of `cType`, if it has a fixed-width numeric one */
+  static getTypedArrayName(cType: string): string | undefined {
+    return this.typedArrayTypes.get(this.resolveTypedef(cType));
+  }
+
+  /** Element type of a `T *` / `const T *` parameter that can take a TypedArray */
+  static getTypedArrayPointerElement(cType: string): string | undefined {
+    const match = /^(?:const\s+)?(.+?)\s*\*$/.exec(cType.trim());
+    if (!match || !this.getTypedArrayName(match[1]!)) return undefined;
+    return match[1]!;
+  }
+
+  /**
+   * Heuristic `(T *data, size_t n)` parameter pairs: maps the index of each
+   * numeric pointer parameter followed by an integer length-like parameter to
+   * the index of that length
+   */
+  static getTypedArrayParams(params: Array<{ name: string; type: { spelling: string } }>): Map<number, number> {
+    const pairs = new Map<number, number>();
+    for (let i = 0; i + 1 < params.length; i++) {
+      const length = params[i + 1]!;
+      if (!this.getTypedArrayPointerElement(params[i]!.type.spelling)) continue;
+      if (!/^(n|num|count|len|length|size)$|(count|len|length|size)$/i.test(length.name || '')) continue;
+      const lengthType = this.resolveTypedef(length.type.spelling);
+      if (lengthType.includes('*') || this.primitiveTypes.get(lengthType)?.napiType !== 'Napi::Number') continue;
+      if (lengthType === 'float' || lengthType === 'double' || lengthType === 'bool') continue;
+      pairs.set(i, i + 1);
+      i++;
+    }
+    return pairs;
+  }
+
+  /**
+   * One column of an fn_many companion: numeric scalars are read and written
+   * as TypedArrays of their own type, enums as Int32Array
+   */
+  static getManyColumn(cType: string): { elementType: string; typedArray: string } | undefined {
+    if (this.isEnumType(cType)) return { elementType: 'int32_t', typedArray: 'Int32Array' };
+    const elementType = this.resolveTypedef(cType);
+    const typedArray = this.typedArrayTypes.get(elementType);
+    return typedArray ? { elementType, typedArray } : undefined;
+  }
+
+  /**
+   * Functions that get an fn_many companion: those named in `selected` ('*'
+   * for all) whose parameters and result are all numeric scalars or enums
+   */
+  static selectManyFunctions(functions: FunctionDecl[], selected: string[]): FunctionDecl[] {
+    if (selected.length === 0) return [];
+    const all = selected.includes('*');
+    return functions.filter(
+      (func) =>
+        (all || selected.includes(func.name)) &&
+        func.params.length > 0 &&
+        this.getManyColumn(func.return.spelling) !== undefined &&
+        func.params.every((param) => this.getManyColumn(param.type.spelling) !== undefined),
+    );
+  }
+
+  // Function-pointer typedef name -> trampoline signature
+  private static callbackTypes: Map<string, CallbackSignature> = new Map();
+
+  /**
+   * Registers the function-pointer typedefs that get a trampoline, so a JS
+   * function can be passed where C expects the pointer: those whose result
+   * is void, a number, a boolean or an enum, and whose arguments can be
+   * converted to JS. The last `void *` argument is the user data that
+   * carries the JS function. `callbacks` selects the mode per typedef;
+   * threadsafe mode needs the user data, since C may keep several pointers
+   * to the one trampoline and only the user data tells their functions apart.
+   * Needs the typedefs, enums and struct kinds to be set first.
+   */
+  static setCallbackTypes(callbacks: Array<{ ctype: string; mode?: CallbackMode }>) {
+    this.callbackTypes = new Map();
+    for (const [name, underlying] of this.typedefMap) {
+      const match = /^(.+?)\s*\(\*\)\s*\((.*)\)$/.exec(underlying);
+      if (!match || !/^[A-Za-z_]\w*$/.test(name)) continue;
+      const result = match[1]!.trim();
+      const params = match[2]!.trim() === 'void' || match[2]!.trim() === ''
+        ? []
+        : match[2]!.split(',').map((param) => param.trim());
+      if (params.some((param) => param.includes('('))) continue;
+      if (!this.isVoidType(result) && !this.isCallbackResultType(result)) continue;
+
+      // User data comes last by convention; earlier `void *` typedefs (CXFile) are handles
+      const userData = params.findLastIndex((param) => this.resolveTypedef(param) === 'void *');
+      const convertible = params.every(
+        (param, i) => i === userData || this.getCallbackArgKind(param) !== undefined,
+      );
+      if (!convertible) continue;
+      const mode = callbacks.find((callback) => callback.ctype === name)?.mode ?? 'sync';
+      if (mode === 'threadsafe' && userData < 0) {
+        throw new Error(`Threadsafe callback ${name} has no void * user-data parameter to carry its JS function`);
+      }
+      this.callbackTypes.set(name, {
+        name,
+        result,
+        params,
+        userData: userData >= 0 ? userData : undefined,
+        mode,
+      });
+    }
+  }
+
+  static getCallbackType(cType: string): CallbackSignature | undefined {
+    return this.callbackTypes.get(cType.replace(/^const\s+/, '').trim());
+  }
+
+  private static isCallbackResultType(cType: string): boolean {
+    const napiType = this.getMapping(this.resolveTypedef(cType)).napiType;
+    return (
+      this.isEnumType(cType) ||
+      napiType === 'Napi::Number' ||
+      napiType === 'Napi::Boolean' ||
+      napiType === 'Napi::BigInt'
+    );
+  }
+
+  /**
+   * How a trampoline hands a C argument to JS: as a number/boolean/bigint or
+   * plain object ('value'), an enum number, a string, a heap copy of a
+   * record or opaque handle ('owned'), or a borrowed wrapped pointer
+   */
+  static getCallbackArgKind(cType: string): 'value' | 'enum' | 'string' | 'owned' | 'pointer' | undefined {
+    if (this.isFunctionPointerType(cType) || this.getViewStructName(cType)) return undefined;
+    if (this.isEnumType(cType)) return 'enum';
+    if (this.isStringType(cType)) return 'string';
+    const clean = cType.replace(/^const\s+/, '').trim();
+    if (this.getPodStructName(clean) || this.isCallbackResultType(clean)) return 'value';
+    if (!clean.includes('*') && this.getRecordName(clean)) return 'owned';
+    if (this.isPointerType(clean)) return clean.includes('*') ? 'pointer' : 'owned';
+    return undefined;
+  }
+
+  /**
+   * Callback parameters of a function: index -> trampoline signature and the
+   * index of the function's user-data parameter that carries the JS function
+   * (the first later `void *` one). Callbacks that need user data the
+   * function does not take are left out.
+   */
+  static getCallbackParams(
+    params: FunctionDecl['params'],
+  ): Map<number, { signature: CallbackSignature; userData?: number }> {
+    const callbacks = new Map<number, { signature: CallbackSignature; userData?: number }>();
+    const claimed = new Set<number>();
+    params.forEach((param, i) => {
+      const signature = this.getCallbackType(param.type.spelling);
+      if (!signature) return;
+      if (signature.userData === undefined) {
+        callbacks.set(i, { signature });
+        return;
+      }
+      const userData = params.findIndex(
+        (other, j) => j > i && !claimed.has(j) && this.resolveTypedef(other.type.spelling) === 'void *',
+      );
+      if (userData < 0) return;
+      claimed.add(userData);
+      callbacks.set(i, { signature, userData });
+    });
+    return callbacks;
+  }
+
+  // Handle type -> the C function that frees it, and child handle type ->
+  // owner handle type (from the ownership rules)
+  private static disposers: Map<string, string> = new Map();
+  private static owners: Map<string, string> = new Map();
+
+  /**
+   * Registers the dispose function of each handle type: a `void f(T)` whose
+   * name says it frees its argument (clang_disposeString, destroy_context).
+   * T must be a wrapped handle, i.e. a record by value or a pointer that is
+   * not a string or plain `void *`. Needs the struct kinds to be set first.
+   */
+  static setDisposers(functions: FunctionDecl[]) {
+    this.disposers = new Map();
+    for (const func of functions) {
+      const type = this.getDisposedType(func);
+      if (!type || this.disposers.has(type) || !this.isHandleType(type)) continue;
+      this.disposers.set(type, func.name);
+    }
+  }
+
+  /** T for a `void f(T)` whose name says it frees its argument, the candidates setDisposers picks from */
+  static getDisposedType(func: FunctionDecl): string | undefined {
+    if (func.params.length !== 1 || !this.isVoidType(func.return.spelling)) return undefined;
+    if (!/(dispose|destroy|free|release)/i.test(func.name)) return undefined;
+    return func.params[0]!.type.spelling.replace(/^const\s+/, '').trim();
+  }
+
+  static getDisposers(): ReadonlyMap<string, string> {
+    return this.disposers;
+  }
+
+  static getDisposer(cType: string): string | undefined {
+    return this.disposers.get(cType.replace(/^const\s+/, '').trim());
+  }
+
+  // Whether the type is a handle wrapped as { _ptr, _type }: a record passed by
+  // value or a named pointer typedef (CXTranslationUnit, and `void *` ones like
+  // CXIndex). Spelled-out `T *` parameters are left alone, since struct
+  // wrappers and returned pointers store them differently.
+  private static isHandleType(cType: string): boolean {
+    if (cType.includes('*')) return false;
+    if (this.isStringType(cType) || this.isEnumType(cType) || this.isFunctionPointerType(cType)) return false;
+    if (this.isPodStructType(cType) || this.isViewStructType(cType)) return false;
+    if (this.getRecordName(cType)) return true;
+    return this.resolveTypedef(cType).endsWith('*');
+  }
+
+  /**
+   * Ownership rules (same shape as binding-gen's StrategyPlan.ownership): a
+   * `child` handle is only valid while its `owner` is, e.g. a CXCursor and
+   * its CXTranslationUnit. Children keep their owner reachable.
+   */
+  static setOwnership(rules: Array<{ owner: string; child: string }>) {
+    this.owners = new Map();
+    for (const { owner, child } of rules) {
+      this.owners.set(child.trim(), owner.trim());
+    }
+  }
+
+  static getOwner(cType: string): string | undefined {
+    return this.owners.get(cType.replace(/^const\s+/, '').trim());
+  }
+
+  /**
+   * Where a function's child-handle result takes its owner from: the first
+   * argument that is the owner itself, or another child of the same owner
+   * (whose pinned owner is copied).
+   */
+  static getPinSource(func: FunctionDecl): { index: number; isOwner: boolean } | undefined {
+    const owner = this.getOwner(func.return.spelling);
+    return owner ? this.findOwnerArg(func, owner) : undefined;
+  }
+
+  /**
+   * Where the child handles a callback receives (a CXCursor for a
+   * CXCursorVisitor) take their owner from, as for getPinSource: an argument
+   * of the function the callback is passed to
+   */
+  static getCallbackPinSource(
+    func: FunctionDecl,
+    signature: CallbackSignature,
+  ): { index: number; isOwner: boolean } | undefined {
+    const owner = signature.params
+      .filter((type) => this.getCallbackArgKind(type) === 'owned')
+      .map((type) => this.getOwner(type))
+      .find((owner) => owner !== undefined);
+    return owner ? this.findOwnerArg(func, owner) : undefined;
+  }
+
+  private static findOwnerArg(func: FunctionDecl, owner: string): { index: number; isOwner: boolean } | undefined {
+    for (let i = 0; i < func.params.length; i++) {
+      const type = func.params[i]!.type.spelling.replace(/^const\s+/, '').trim();
+      if (type === owner) return { index: i, isOwner: true };
+      if (this.getOwner(type) === owner) return { index: i, isOwner: false };
+    }
+    return undefined;
+  }
+
+  /**
+   * For functions mapping a child back to its owner (clang_Cursor_getTranslationUnit):
+   * the index of the child argument whose pinned owner is returned as is
+   */
+  static getOwnerSource(func: FunctionDecl): number | undefined {
+    const result = func.return.spelling.replace(/^const\s+/, '').trim();
+    const index = func.params.findIndex((param) => this.getOwner(param.type.spelling) === result);
+    return index >= 0 ? index : undefined;
+  }
+
   private static readonly primitiveTypes: Map<string, TypeMapping> = new Map([
     [
       'void',
@@ -175,7 +733,31 @@ export class TypeMapper {
     ],
   ]);
 
+  // Builtin type each builtin CXTypeKind maps like
+  private static readonly builtinKinds: Map<number, string> = new Map([
+    [CXType.Bool, 'bool'],
+    [CXType.Char_U, 'char'],
+    [CXType.Char_S, 'char'],
+    [CXType.SChar, 'char'],
+    [CXType.UChar, 'unsigned char'],
+    [CXType.Short, 'short'],
+    [CXType.UShort, 'unsigned short'],
+    [CXType.Int, 'int'],
+    [CXType.UInt, 'unsigned int'],
+    [CXType.Long, 'long'],
+    [CXType.ULong, 'unsigned long'],
+    [CXType.LongLong, 'long long'],
+    [CXType.ULongLong, 'unsigned long long'],
+    [CXType.Float, 'float'],
+    [CXType.Double, 'double'],
+    [CXType.LongDouble, 'double'],
+  ]);
+
   static getMapping(cType: string): TypeMapping {
+    return TypeMapper.memoized('getMapping', cType, () => TypeMapper.mapType(cType));
+  }
+
+  private static mapType(cType: string): TypeMapping {
     // Remove const qualifier
     const cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '');
 
@@ -184,6 +766,48 @@ export class TypeMapper {
       return TypeMapper.primitiveTypes.get(cleanType)!;
     }
 
+    // View-backed records are DataView subclasses
+    const viewName = TypeMapper.getViewStructName(cleanType);
+    if (viewName) {
+      return {
+        cType: cType,
+        napiType: 'Napi::DataView',
+        tsType: viewName,
+        needsConversion: true,
+      };
+    }
+
+    // Small POD structs travel by value as plain objects
+    const podName = TypeMapper.getPodStructName(cleanType);
+    if (podName) {
+      return {
+        cType: cType,
+        napiType: 'Napi::Object',
+        tsType: podName,
+        needsConversion: true,
+        conversionFrom: `${TypeMapper.sanitizeIdentifier(podName)}_toValue(env, $VAR)`,
+      };
+    }
+
+    // Typedefs of numbers, including ones declared outside the header
+    // (time_t, uint32_t, ...), map like the builtin type they stand for;
+    // typedefs of enums are numbers too
+    const descriptor = TypeMapper.describe(cleanType);
+    if (descriptor && !descriptor.isPointer) {
+      const builtin = TypeMapper.builtinKinds.get(TypeMapper.canonicalKind(descriptor)!);
+      if (builtin) {
+        return TypeMapper.primitiveTypes.get(builtin)!;
+      }
+      if (TypeMapper.canonicalKind(descriptor) === CXType.Enum) {
+        return {
+          cType: cType,
+          napiType: 'Napi::Number',
+          tsType: 'number',
+          needsConversion: true,
+        };
+      }
+    }
+
     // Handle char* and const char* as strings
     if (
       cleanType === 'char *' ||
@@ -225,12 +849,17 @@ export class TypeMapper {
       };
     }
 
-    // Handle arrays (simplified - may need more work)
+    // Fixed-size arrays: char arrays are strings, numeric ones TypedArrays
     if (cleanType.includes('[') && cleanType.includes(']')) {
+      const elementType = TypeMapper.getArrayElementType(cleanType).trim();
+      if (TypeMapper.resolveTypedef(elementType) === 'char') {
+        return { cType: cType, napiType: 'Napi::String', tsType: 'string', needsConversion: true };
+      }
+      const typedArray = TypeMapper.getTypedArrayName(elementType);
       return {
         cType: cType,
-        napiType: 'Napi::Array',
-        tsType: 'unknown[]',
+        napiType: typedArray ? 'Napi::TypedArray' : 'Napi::Array',
+        tsType: typedArray ?? 'unknown[]',
         needsConversion: true,
       };
     }
@@ -274,12 +903,14 @@ export class TypeMapper {
       return mapping.conversionTo.replace(/\$VAR/g, napiVar);
     }
 
-    // Default conversions
+    // Default conversions; a typedef mapped like a builtin type converts
+    // like it
+    const numberType = mapping.cType;
     if (mapping.napiType === 'Napi::Number') {
-      if (cType.includes('float') || cType.includes('double')) {
+      if (numberType.includes('float') || numberType.includes('double')) {
         return `${napiVar}.As<Napi::Number>().DoubleValue()`;
       }
-      if (cType.includes('unsigned')) {
+      if (numberType.includes('unsigned')) {
         return `${napiVar}.As<Napi::Number>().Uint32Value()`;
       }
       return `${napiVar}.As<Napi::Number>().Int32Value()`;
@@ -290,7 +921,7 @@ export class TypeMapper {
     }
 
     if (mapping.napiType === 'Napi::BigInt') {
-      if (cType.includes('unsigned')) {
+      if (numberType.includes('unsigned')) {
         return `${napiVar}.As<Napi::BigInt>().Uint64Value(nullptr)`;
       }
       return `${napiVar}.As<Napi::BigInt>().Int64Value(nullptr)`;
@@ -299,6 +930,25 @@ export class TypeMapper {
     return napiVar;
   }
 
+  /**
+   * Raw conversion of a wrapper argument: a bool expression that reads
+   * `napiVar` into `outVar` with napi_get_value_* (via the generated fromNapi
+   * helpers) and throws a TypeError when the value has the wrong type.
+   * Undefined for types that need the node-addon-api path.
+   */
+  static getNapiToCChecked(napiVar: string, cType: string, outVar: string): string | undefined {
+    const mapping = TypeMapper.getMapping(cType);
+    if (
+      mapping.napiType === 'Napi::Number' ||
+      mapping.napiType === 'Napi::Boolean' ||
+      mapping.napiType === 'Napi::BigInt' ||
+      TypeMapper.isEnumType(cType)
+    ) {
+      return `fromNapi(env, ${napiVar}, &${outVar})`;
+    }
+    return undefined;
+  }
+
   static getCToNapi(
     cVar: string,
     cType: string,
@@ -333,7 +983,24 @@ export class TypeMapper {
     return TypeMapper.getMapping(cType).tsType;
   }
 
+  /** Like getTsType, but pointers to view-backed records take the view itself */
+  static getTsParamType(cType: string): string {
+    return TypeMapper.getViewStructPointerName(cType) ?? TypeMapper.getTsType(cType);
+  }
+
   static isPointerType(cType: string): boolean {
+    return this.memoized('isPointerType', cType, () => {
+      // Pointers to plain char are strings; blocks are not pointers here
+      const descriptor = this.describe(cType);
+      if (!descriptor) return this.isPointerSpelling(cType);
+      const pointee = descriptor.pointeeType && this.canonicalKind(descriptor.pointeeType);
+      return (
+        this.canonicalKind(descriptor) === CXType.Pointer && pointee !== CXType.Char_S && pointee !== CXType.Char_U
+      );
+    });
+  }
+
+  private static isPointerSpelling(cType: string): boolean {
     const cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '');
     
     // Check if it's a typedef that resolves to a pointer
@@ -355,6 +1022,13 @@ export class TypeMapper {
   }
 
   static isEnumType(cType: string): boolean {
+    return this.memoized('isEnumType', cType, () => {
+      const descriptor = this.describe(cType);
+      return descriptor ? this.canonicalKind(descriptor) === CXType.Enum : this.isEnumSpelling(cType);
+    });
+  }
+
+  private static isEnumSpelling(cType: string): boolean {
     const cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '').trim();
 
     // Pointers are never enums
@@ -381,6 +1055,13 @@ export class TypeMapper {
   }
 
   static isFunctionPointerType(cType: string): boolean {
+    return this.memoized('isFunctionPointerType', cType, () => {
+      const descriptor = this.describe(cType);
+      return descriptor ? descriptor.isFunctionPointer === true : this.isFunctionPointerSpelling(cType);
+    });
+  }
+
+  private static isFunctionPointerSpelling(cType: string): boolean {
     // Check if the type itself is a function pointer
     if (cType.includes('(*') && cType.includes(')')) {
       return true;
@@ -404,6 +1085,18 @@ export class TypeMapper {
   }
 
   static isStructType(cType: string): boolean {
+    return this.memoized('isStructType', cType, () => {
+      // Records are structs; numbers and enums (which getMapping maps by
+      // their canonical kind) are not. Anything else is judged by spelling.
+      const descriptor = this.describe(cType);
+      const kind = descriptor && this.canonicalKind(descriptor);
+      if (kind === CXType.Record) return true;
+      if (kind !== undefined && (this.builtinKinds.has(kind) || kind === CXType.Enum)) return false;
+      return this.isStructSpelling(cType);
+    });
+  }
+
+  private static isStructSpelling(cType: string): boolean {
     // A struct type is one that is not a primitive, not a pointer, and not void
     const cleanType = cType.replace(/^const\s+/, '').replace(/\s+const$/, '');
 
@@ -452,7 +1145,7 @@ export class TypeMapper {
   
   static getArrayElementType(cType: string): string {
     if (!this.isArrayType(cType)) return cType;
-    return cType.substring(0, cType.indexOf('['));
+    return cType.substring(0, cType.indexOf('[')).trim();
   }
 
   static sanitizeIdentifier(name: string): string {
@@ -14,9 +14,68 @@ export interface GeneratorOptions {
   defines?: string[];
   headerIncludePath?: string;
   headerIncludePaths?: string[];
+  // Hand-written `void Name(Napi::Env, Napi::Object)` registrars living in
+  // src/*.cpp; the generated Init calls each one after the generated exports.
+  nativeExtensions?: string[];
+  // Hand-written TS modules re-exported from the generated index.ts
+  tsExtensions?: string[];
+  // Structs/unions exposed as ArrayBuffer-backed DataView classes instead of
+  // wrapped pointers ('*' for every struct with a known size)
+  structViews?: string[];
+  // Scalar numeric functions that also get a vectorized <fn>_many export over
+  // TypedArray columns ('*' for every eligible function)
+  manyFunctions?: string[];
+  // Function-pointer typedefs and how JS functions passed for them are called
+  // (same shape as binding-gen's CallbackPlan). Typedefs left out are 'sync'.
+  callbacks?: Array<{ ctype: string; mode?: CallbackMode }>;
+  // Handle types that are only valid while another handle is, e.g.
+  // { owner: 'CXTranslationUnit', child: 'CXCursor' } (same shape as
+  // binding-gen's StrategyPlan.ownership). Child handles pin their owner.
+  ownership?: Array<{ owner: string; child: string }>;
+  // Directory for the parsed-header and function-wrapper caches; with it,
+  // unchanged headers are not reparsed and unchanged wrappers not regenerated
+  cacheDir?: string;
+  // Split src/binding.cpp into this many translation units that compile in
+  // parallel (see CppGenerator.generateShards); 1 keeps a single file
+  shards?: number;
+  // Precompile napi.h and the library headers (target_precompile_headers)
+  precompileHeaders?: boolean;
+  // Compile the generated sources as CMake unity builds of this many files
+  // each (0 or unset: off)
+  unityBatchSize?: number;
+  // Compiler and linker policy for release builds (see BuildProfile)
+  buildProfile?: BuildProfile;
+  // Only bind these functions (and types, or enum constants) and the types
+  // reachable from them (see treeShake); unset binds the whole header
+  allowlist?: string[];
+  // Parse multiple headers on this many worker threads (see
+  // parseHeadersInParallel); 1 or unset parses them one after another
+  parseJobs?: number;
+}
+
+// 'speed': -O3, link-time optimization and hidden visibility, so the small
+// marshaling helpers inline across translation units.
+// 'size': -Os, unreferenced sections garbage-collected and identical code
+// folded where the linker supports it.
+export type BuildProfile = 'speed' | 'size';
+
+// 'sync': the C function only calls back before it returns, on the JS thread.
+// 'threadsafe': the JS function is retained, so C may call it later or from
+// other threads; those calls are queued to the JS thread.
+export type CallbackMode = 'sync' | 'threadsafe';
+
+export interface CallbackSignature {
+  name: string; // typedef name
+  result: string;
+  params: string[];
+  userData?: number; // index of the void * parameter carrying the context
+  mode: CallbackMode;
 }
 
 export interface GeneratedFiles {
+  // Sharded output adds src/binding.h, src/binding_shards.h and
+  // src/binding_shard_<k>.cpp
+  [path: string]: string;
   'src/binding.cpp': string;
   'CMakeLists.txt': string;
   'package.json': string;
@@ -0,0 +1,127 @@
+// Call-overhead benchmark for the generated clang_* exports: times 50 of the
+// most-called cursor, kind, type and string getters over every cursor of a
+// parsed translation unit. These go through wrap<&fn>, so the numbers are
+// dominated by argument and result conversion rather than libclang.
+//
+//   node bench/getters.bench.ts [rounds]
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { performance } from 'node:perf_hooks';
+import * as clang from '../index.ts';
+
+const rounds = Number(process.argv[2] ?? 200);
+
+type CursorHandle = { _type: 'CXCursor' };
+type TypeHandle = { _type: 'CXType' };
+
+const source = Array.from(
+  { length: 50 },
+  (_, i) => `
+struct S${i} { int a; unsigned b : 3; const char *name; double values[4]; };
+enum E${i} { E${i}_A = ${i}, E${i}_B };
+typedef struct S${i} *S${i}Ref;
+static inline int f${i}(S${i}Ref s, int x, ...) { return s->a + x; }
+`,
+).join('');
+
+const dir = mkdtempSync(join(tmpdir(), 'getters-bench-'));
+const file = join(dir, 'input.c');
+writeFileSync(file, source);
+
+const index = clang.clang_createIndex(0, 0);
+const tu = clang.clang_parseTranslationUnit(index, file, null as any, 0, null as any, 0, 0);
+
+const cursors: CursorHandle[] = [];
+const pending = [new clang.Cursor(clang.clang_getTranslationUnitCursor(tu))];
+while (pending.length > 0) {
+  const cursor = pending.pop()!;
+  cursors.push(cursor.handle);
+  pending.push(...cursor.children);
+}
+const kinds = cursors.map((c) => clang.clang_getCursorKind(c));
+const types: TypeHandle[] = cursors.map((c) => clang.clang_getCursorType(c));
+const strings = cursors.map((c) => clang.clang_getCursorSpelling(c));
+
+const cursorGetters: [string, (c: CursorHandle) => unknown][] = [
+  ['clang_getCursorKind', clang.clang_getCursorKind],
+  ['clang_getCursorType', clang.clang_getCursorType],
+  ['clang_getCursorSpelling', clang.clang_getCursorSpelling],
+  ['clang_getCursorDisplayName', clang.clang_getCursorDisplayName],
+  ['clang_getCursorUSR', clang.clang_getCursorUSR],
+  ['clang_getCursorLocation', clang.clang_getCursorLocation],
+  ['clang_getCursorExtent', clang.clang_getCursorExtent],
+  ['clang_getCursorSemanticParent', clang.clang_getCursorSemanticParent],
+  ['clang_getCursorLexicalParent', clang.clang_getCursorLexicalParent],
+  ['clang_getCursorReferenced', clang.clang_getCursorReferenced],
+  ['clang_getCursorDefinition', clang.clang_getCursorDefinition],
+  ['clang_getCanonicalCursor', clang.clang_getCanonicalCursor],
+  ['clang_isCursorDefinition', clang.clang_isCursorDefinition],
+  ['clang_Cursor_isNull', clang.clang_Cursor_isNull],
+  ['clang_hashCursor', clang.clang_hashCursor],
+  ['clang_getCursorLinkage', clang.clang_getCursorLinkage],
+  ['clang_getCursorVisibility', clang.clang_getCursorVisibility],
+  ['clang_getCursorAvailability', clang.clang_getCursorAvailability],
+  ['clang_getCursorLanguage', clang.clang_getCursorLanguage],
+  ['clang_getCursorResultType', clang.clang_getCursorResultType],
+  ['clang_Cursor_getNumArguments', clang.clang_Cursor_getNumArguments],
+  ['clang_getCXXAccessSpecifier', clang.clang_getCXXAccessSpecifier],
+  ['clang_getTypedefDeclUnderlyingType', clang.clang_getTypedefDeclUnderlyingType],
+  ['clang_getEnumDeclIntegerType', clang.clang_getEnumDeclIntegerType],
+  ['clang_getEnumConstantDeclValue', clang.clang_getEnumConstantDeclValue],
+  ['clang_getFieldDeclBitWidth', clang.clang_getFieldDeclBitWidth],
+  ['clang_Cursor_isBitField', clang.clang_Cursor_isBitField],
+  ['clang_CXXMethod_isStatic', clang.clang_CXXMethod_isStatic],
+  ['clang_CXXMethod_isVirtual', clang.clang_CXXMethod_isVirtual],
+  ['clang_CXXMethod_isConst', clang.clang_CXXMethod_isConst],
+  ['clang_Cursor_isVariadic', clang.clang_Cursor_isVariadic],
+  ['clang_Cursor_getStorageClass', clang.clang_Cursor_getStorageClass],
+  ['clang_Cursor_isAnonymous', clang.clang_Cursor_isAnonymous],
+];
+const kindGetters: [string, (k: number) => unknown][] = [
+  ['clang_isDeclaration', clang.clang_isDeclaration],
+  ['clang_isReference', clang.clang_isReference],
+  ['clang_isExpression', clang.clang_isExpression],
+  ['clang_isStatement', clang.clang_isStatement],
+  ['clang_isAttribute', clang.clang_isAttribute],
+  ['clang_isInvalid', clang.clang_isInvalid],
+  ['clang_isPreprocessing', clang.clang_isPreprocessing],
+  ['clang_isUnexposed', clang.clang_isUnexposed],
+];
+const typeGetters: [string, (t: TypeHandle) => unknown][] = [
+  ['clang_getTypeSpelling', clang.clang_getTypeSpelling],
+  ['clang_getCanonicalType', clang.clang_getCanonicalType],
+  ['clang_getPointeeType', clang.clang_getPointeeType],
+  ['clang_getTypeDeclaration', clang.clang_getTypeDeclaration],
+  ['clang_isConstQualifiedType', clang.clang_isConstQualifiedType],
+  ['clang_Type_getSizeOf', clang.clang_Type_getSizeOf],
+  ['clang_Type_getAlignOf', clang.clang_Type_getAlignOf],
+  ['clang_getResultType', clang.clang_getResultType],
+];
+const stringGetters: [string, (s: { _type: 'CXString' }) => unknown][] = [
+  ['clang_getCString', clang.clang_getCString],
+];
+
+function bench<T>(name: string, fn: (arg: T) => unknown, args: readonly T[]): number {
+  // Warm up so the timed loop runs optimized code
+  for (const arg of args) fn(arg);
+  const start = performance.now();
+  for (let r = 0; r < rounds; r++) {
+    for (const arg of args) fn(arg);
+  }
+  const nsPerCall = ((performance.now() - start) * 1e6) / (rounds * args.length);
+  console.log(`${name.padEnd(36)} ${nsPerCall.toFixed(1).padStart(8)} ns/call`);
+  return nsPerCall;
+}
+
+console.log(`cursors: ${cursors.length}, rounds: ${rounds}`);
+let total = 0;
+for (const [name, fn] of cursorGetters) total += bench(name, fn, cursors);
+for (const [name, fn] of kindGetters) total += bench(name, fn, kinds);
+for (const [name, fn] of typeGetters) total += bench(name, fn, types);
+for (const [name, fn] of stringGetters) total += bench(name, fn, strings);
+const count = cursorGetters.length + kindGetters.length + typeGetters.length + stringGetters.length;
+console.log(`mean over ${count} getters: ${(total / count).toFixed(1)} ns/call`);
+
+clang.clang_disposeTranslationUnit(tu);
+clang.clang_disposeIndex(index);
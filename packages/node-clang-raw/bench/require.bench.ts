@@ -0,0 +1,48 @@
+// Cold-start benchmark: time to load the native addon and index.ts in a fresh
+// process. Each sample spawns a new node so module caches never help.
+//
+//   node bench/require.bench.ts [samples]
+import { execFileSync } from 'node:child_process';
+import { join } from 'node:path';
+
+const root = join(import.meta.dirname, '..');
+const samples = Number(process.argv[2] ?? 20);
+
+const probe = `
+const { performance } = require('node:perf_hooks');
+const t0 = performance.now();
+const addon = require('node-gyp-build')(${JSON.stringify(root)});
+const t1 = performance.now();
+import(${JSON.stringify(join(root, 'index.ts'))}).then((clang) => {
+  const t2 = performance.now();
+  // First touch of lazily created enum exports
+  void addon.CXCursorKind;
+  void clang.CXCursor_StructDecl;
+  const t3 = performance.now();
+  process.stdout.write(JSON.stringify([t1 - t0, t2 - t1, t3 - t2]));
+});
+`;
+
+function median(values: number[]): number {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)] ?? 0;
+}
+
+const addonLoad: number[] = [];
+const indexLoad: number[] = [];
+const firstEnum: number[] = [];
+for (let i = 0; i < samples; i++) {
+  const output = execFileSync(process.execPath, ['-e', probe], {
+    cwd: root,
+    encoding: 'utf8',
+  });
+  const [a, b, c] = JSON.parse(output) as [number, number, number];
+  addonLoad.push(a);
+  indexLoad.push(b);
+  firstEnum.push(c);
+}
+
+console.log(`samples: ${samples}`);
+console.log(`addon load (dlopen + Init): ${median(addonLoad).toFixed(2)} ms`);
+console.log(`index.ts import:            ${median(indexLoad).toFixed(2)} ms`);
+console.log(`first enum access:          ${median(firstEnum).toFixed(2)} ms`);
@@ -0,0 +1,5 @@
+import { join } from 'node:path';
+import nodeGypBuild from 'node-gyp-build';
+
+// Load the native addon (shared by the hand-written extension modules)
+export const addon = nodeGypBuild(join(import.meta.dirname, '..')) as any;
@@ -0,0 +1,40 @@
+import { addon } from './addon.ts';
+
+type Cursor = { _type: 'CXCursor' };
+
+/**
+ * Map keyed by cursor identity (`clang_hashCursor` / `clang_equalCursors`),
+ * so two handles for the same cursor hit the same entry. Cursors are copied
+ * into the map, and each entry keeps the translation unit of the handle it was
+ * stored from alive until it is deleted; `keys()` handles pin it in turn.
+ */
+export interface CursorMap<V> {
+  readonly size: number;
+  set(cursor: Cursor, value: V): this;
+  get(cursor: Cursor): V | undefined;
+  has(cursor: Cursor): boolean;
+  delete(cursor: Cursor): boolean;
+  clear(): void;
+  keys(): Cursor[];
+  /** Store `values[i]` for `cursors[i]`; both arrays must be the same length */
+  setMany(cursors: Cursor[], values: V[]): this;
+  getMany(cursors: Cursor[]): Array<V | undefined>;
+  /** 1 where the cursor has an entry, 0 otherwise */
+  hasMany(cursors: Cursor[]): Uint8Array;
+}
+
+/** Set of cursors with the same identity rules as {@link CursorMap}. */
+export interface CursorSet {
+  readonly size: number;
+  add(cursor: Cursor): this;
+  has(cursor: Cursor): boolean;
+  delete(cursor: Cursor): boolean;
+  clear(): void;
+  /** Insert all cursors; 1 where the cursor was not already present */
+  addMany(cursors: Cursor[]): Uint8Array;
+  /** 1 where the cursor is present, 0 otherwise */
+  hasMany(cursors: Cursor[]): Uint8Array;
+}
+
+export const CursorMap: new <V = unknown>() => CursorMap<V> = addon.CursorMap;
+export const CursorSet: new () => CursorSet = addon.CursorSet;
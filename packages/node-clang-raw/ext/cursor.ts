@@ -0,0 +1,125 @@
+import { addon } from './addon.ts';
+
+type CursorHandle = { _type: 'CXCursor' };
+type TypeHandle = { _type: 'CXType' };
+
+export interface SourcePosition {
+  /** Absolute path, or `null` for locations outside any file */
+  file: string | null;
+  line: number;
+  column: number;
+  offset: number;
+}
+
+export interface SourceExtent {
+  start: SourcePosition;
+  end: SourcePosition;
+}
+
+// Keep in sync with CursorSlot in src/cursor_info.cpp
+const CursorSlot = {
+  Kind: 0,
+  Spelling: 1,
+  Type: 2,
+  Location: 3,
+  Extent: 4,
+  SemanticParent: 5,
+  Usr: 6,
+  Children: 7,
+} as const;
+
+// Distinguishes "not computed yet" from cached null/undefined results
+const UNSET: unique symbol = Symbol('unset');
+
+/**
+ * High-level view of a CXCursor. Each property is computed natively on first
+ * access (one call, plain JS result) and cached on the instance, so analyzers
+ * that read the same property repeatedly pay for the libclang call once.
+ *
+ * The raw handle stays available as `handle` for the generated `clang_*`
+ * functions. The translation unit must outlive the Cursor.
+ */
+export class Cursor {
+  readonly handle: CursorHandle;
+
+  #kind: number | typeof UNSET = UNSET;
+  #spelling: string | typeof UNSET = UNSET;
+  #type: TypeHandle | typeof UNSET = UNSET;
+  #location: SourcePosition | typeof UNSET = UNSET;
+  #extent: SourceExtent | typeof UNSET = UNSET;
+  #semanticParent: Cursor | null | typeof UNSET = UNSET;
+  #usr: string | typeof UNSET = UNSET;
+  #children: readonly Cursor[] | typeof UNSET = UNSET;
+
+  constructor(handle: CursorHandle) {
+    this.handle = handle;
+  }
+
+  /** CXCursorKind */
+  get kind(): number {
+    if (this.#kind === UNSET) {
+      this.#kind = addon.cursorProperty(this.handle, CursorSlot.Kind);
+    }
+    return this.#kind;
+  }
+
+  get spelling(): string {
+    if (this.#spelling === UNSET) {
+      this.#spelling = addon.cursorProperty(this.handle, CursorSlot.Spelling);
+    }
+    return this.#spelling;
+  }
+
+  /** CXType handle, usable with the generated `clang_*Type*` functions */
+  get type(): TypeHandle {
+    if (this.#type === UNSET) {
+      this.#type = addon.cursorProperty(this.handle, CursorSlot.Type);
+    }
+    return this.#type;
+  }
+
+  get location(): SourcePosition {
+    if (this.#location === UNSET) {
+      this.#location = addon.cursorProperty(this.handle, CursorSlot.Location);
+    }
+    return this.#location;
+  }
+
+  get extent(): SourceExtent {
+    if (this.#extent === UNSET) {
+      this.#extent = addon.cursorProperty(this.handle, CursorSlot.Extent);
+    }
+    return this.#extent;
+  }
+
+  /** `null` for the translation unit cursor */
+  get semanticParent(): Cursor | null {
+    if (this.#semanticParent === UNSET) {
+      const parent = addon.cursorProperty(
+        this.handle,
+        CursorSlot.SemanticParent,
+      );
+      this.#semanticParent = parent === null ? null : new Cursor(parent);
+    }
+    return this.#semanticParent;
+  }
+
+  get usr(): string {
+    if (this.#usr === UNSET) {
+      this.#usr = addon.cursorProperty(this.handle, CursorSlot.Usr);
+    }
+    return this.#usr;
+  }
+
+  /** Direct children, collected in one native visit on first access */
+  get children(): readonly Cursor[] {
+    if (this.#children === UNSET) {
+      const handles: CursorHandle[] = addon.cursorProperty(
+        this.handle,
+        CursorSlot.Children,
+      );
+      this.#children = Object.freeze(handles.map((h) => new Cursor(h)));
+    }
+    return this.#children;
+  }
+}
@@ -0,0 +1,33 @@
+import { addon } from './addon.ts';
+
+export interface HeaderASTOptions {
+  /** Attach cleaned-up doc comments as `documentation` (default true) */
+  includeDocumentation?: boolean;
+}
+
+/**
+ * Declaration arrays of codegen's `HeaderAST` (see codegen/h-parser/types.ts
+ * for the element shapes), in visit order.
+ */
+export interface HeaderDeclarations {
+  interfaces: any[];
+  protocols: any[];
+  enums: any[];
+  structs: any[];
+  typedefs: any[];
+  functions: any[];
+  classes: any[];
+}
+
+/**
+ * Collect every enum, struct/union, typedef, function, ObjC interface and
+ * protocol and C++ class in a TU in one native pass. The result matches what
+ * h-parser's per-cursor JS walker builds, and crosses into JS as a single
+ * JSON string.
+ */
+export function extractHeaderAST(
+  tu: { _type: 'CXTranslationUnit' },
+  options?: HeaderASTOptions,
+): HeaderDeclarations {
+  return JSON.parse(addon.extractHeaderAST(tu, options));
+}
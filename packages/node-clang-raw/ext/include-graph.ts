@@ -0,0 +1,66 @@
+import { addon } from './addon.ts';
+
+/**
+ * Include graph of one or more translation units.
+ *
+ * Edge `i` says `files[includer[i]]` includes `files[included[i]]` with the
+ * `#include` directive at byte `offset[i]` of the includer; `depth[i]` is the
+ * include-stack depth (1 = included by a main file), the smallest one seen
+ * when several TUs are merged. `roots[t]` is the main file of TU `t`.
+ */
+export interface IncludeGraph {
+  files: string[];
+  includer: Uint32Array;
+  included: Uint32Array;
+  offset: Uint32Array;
+  depth: Uint32Array;
+  roots: Uint32Array;
+}
+
+type TranslationUnit = { _type: 'CXTranslationUnit' };
+
+/**
+ * Build the include graph of a TU, or the merged graph of a batch of TUs,
+ * natively via clang_getInclusions. Files are keyed by path across TUs.
+ */
+export function getIncludeGraph(
+  tu: TranslationUnit | TranslationUnit[],
+): IncludeGraph {
+  return addon.getIncludeGraph(tu);
+}
+
+/**
+ * Indices (into `graph.roots`) of the translation units that transitively
+ * include `fileId`, i.e. the TUs to reparse when that file changes. Merged
+ * graphs may over-approximate, never under-approximate.
+ */
+export function findAffectedRoots(graph: IncludeGraph, fileId: number): number[] {
+  const includers = new Map<number, number[]>();
+  for (let i = 0; i < graph.included.length; i++) {
+    const to = graph.included[i]!;
+    const from = graph.includer[i]!;
+    const list = includers.get(to);
+    if (list) {
+      list.push(from);
+    } else {
+      includers.set(to, [from]);
+    }
+  }
+
+  const seen = new Set<number>([fileId]);
+  const stack = [fileId];
+  while (stack.length > 0) {
+    for (const from of includers.get(stack.pop()!) ?? []) {
+      if (!seen.has(from)) {
+        seen.add(from);
+        stack.push(from);
+      }
+    }
+  }
+
+  const affected: number[] = [];
+  graph.roots.forEach((root, index) => {
+    if (seen.has(root)) affected.push(index);
+  });
+  return affected;
+}
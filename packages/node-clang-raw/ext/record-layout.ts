@@ -0,0 +1,48 @@
+import { addon } from './addon.ts';
+
+export interface RecordLayoutOptions {
+  /** Skip records declared in system headers */
+  skipSystemHeaders?: boolean;
+  /** Only report records declared in the main file of the TU */
+  mainFileOnly?: boolean;
+}
+
+/**
+ * Layout of every record definition in a translation unit, in columnar form.
+ *
+ * Record `i` owns fields `firstField[i] .. firstField[i] + fieldCount[i] - 1`.
+ * Sizes and alignments are in bytes and offsets in bits; negative values are
+ * CXTypeLayoutError codes (incomplete, dependent, ...). `bitWidth` is -1 for
+ * fields that are not bit-fields.
+ */
+export interface RecordLayoutTable {
+  records: {
+    name: string[];
+    kind: Uint32Array; // CXCursorKind
+    size: Float64Array;
+    align: Float64Array;
+    firstField: Uint32Array;
+    fieldCount: Uint32Array;
+  };
+  fields: {
+    name: string[];
+    type: Uint32Array; // index into `types`
+    offset: Float64Array;
+    bitWidth: Int32Array;
+    size: Float64Array;
+    align: Float64Array;
+  };
+  types: string[];
+}
+
+/**
+ * Collect the layout of all struct/union/class definitions in a TU in one
+ * native pass (clang_Type_visitFields, clang_Cursor_getOffsetOfField,
+ * clang_getFieldDeclBitWidth, clang_Type_getSizeOf/AlignOf).
+ */
+export function getRecordLayouts(
+  tu: { _type: 'CXTranslationUnit' },
+  options?: RecordLayoutOptions,
+): RecordLayoutTable {
+  return addon.getRecordLayouts(tu, options);
+}
@@ -0,0 +1,46 @@
+import { addon } from './addon.ts';
+
+type Cursor = { _type: 'CXCursor' };
+type TranslationUnit = { _type: 'CXTranslationUnit' };
+type File = { _type: 'CXFile' };
+
+/**
+ * Every reference to the entity behind `cursor` in `file`, as byte offset
+ * pairs `[start0, end0, start1, end1, ...]`.
+ */
+export function findReferencesInFile(cursor: Cursor, file: File): Uint32Array {
+  return addon.findReferencesInFile(cursor, file);
+}
+
+/**
+ * Every `#include`/`#import` directive in `file`, as byte offset pairs
+ * `[start0, end0, start1, end1, ...]`.
+ */
+export function findIncludesInFile(
+  tu: TranslationUnit,
+  file: File,
+): Uint32Array {
+  return addon.findIncludesInFile(tu, file);
+}
+
+export interface ReferenceSearchTarget {
+  tu: TranslationUnit;
+  /** File to search, defaults to the main file of `tu` */
+  file?: string;
+}
+
+/**
+ * Search references to the declaration behind `cursor` in several translation
+ * units in parallel; targets that share a TU are searched one after another.
+ * The declaration is re-resolved in each TU from its file and offset.
+ * Resolves with one offset-pair array per target, or `null` when the target
+ * file is not part of that TU.
+ *
+ * The TUs must not be used from JS until the promise settles.
+ */
+export function findReferencesInTUs(
+  cursor: Cursor,
+  targets: ReferenceSearchTarget[],
+): Promise<Array<Uint32Array | null>> {
+  return addon.findReferencesInTUs(cursor, targets);
+}
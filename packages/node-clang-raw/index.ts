@@ -91,7 +91,7 @@ export interface CXFileUniqueID {
 }
 
 export interface CXFileUniqueIDInit {
-  data?: unknown[];
+  data?: ArrayLike<bigint>;
 }
 
 export interface CXIdxAttrInfo {
@@ -101,7 +101,7 @@ export interface CXIdxAttrInfo {
 
 export interface CXIdxAttrInfoInit {
   cursor?: { _type: 'CXCursor' };
-  kind?: { _type: 'CXIdxAttrKind' };
+  kind?: number;
   loc?: { _type: 'CXIdxLoc' };
 }
 
@@ -165,11 +165,11 @@ export interface CXIdxEntityInfo {
 export interface CXIdxEntityInfoInit {
   attributes?: { _ptr: unknown };
   cursor?: { _type: 'CXCursor' };
-  kind?: { _type: 'CXIdxEntityKind' };
-  lang?: { _type: 'CXIdxEntityLanguage' };
+  kind?: number;
+  lang?: number;
   name?: string;
   numAttributes?: number;
-  templateKind?: { _type: 'CXIdxEntityCXXTemplateKind' };
+  templateKind?: number;
   USR?: string;
 }
 
@@ -184,11 +184,11 @@ export interface CXIdxEntityRefInfo {
 export interface CXIdxEntityRefInfoInit {
   container?: { _ptr: unknown };
   cursor?: { _type: 'CXCursor' };
-  kind?: { _type: 'CXIdxEntityRefKind' };
+  kind?: number;
   loc?: { _type: 'CXIdxLoc' };
   parentEntity?: { _ptr: unknown };
   referencedEntity?: { _ptr: unknown };
-  role?: { _type: 'CXSymbolRole' };
+  role?: number;
 }
 
 export interface CXIdxIBOutletCollectionAttrInfo {
@@ -268,7 +268,7 @@ export interface CXIdxObjCContainerDeclInfo {
 
 export interface CXIdxObjCContainerDeclInfoInit {
   declInfo?: { _ptr: unknown };
-  kind?: { _type: 'CXIdxObjCContainerKind' };
+  kind?: number;
 }
 
 export interface CXIdxObjCInterfaceDeclInfo {
@@ -369,10 +369,10 @@ export interface CXPlatformAvailability {
 }
 
 export interface CXPlatformAvailabilityInit {
-  Deprecated?: { _type: 'CXVersion' };
-  Introduced?: { _type: 'CXVersion' };
+  Deprecated?: CXVersion;
+  Introduced?: CXVersion;
   Message?: { _type: 'CXString' };
-  Obsoleted?: { _type: 'CXVersion' };
+  Obsoleted?: CXVersion;
   Platform?: { _type: 'CXString' };
   Unavailable?: number;
 }
@@ -469,7 +469,7 @@ export interface CXToken {
 }
 
 export interface CXTokenInit {
-  int_data?: unknown[];
+  int_data?: ArrayLike<number>;
   ptr_data?: unknown;
 }
 
@@ -496,8 +496,8 @@ export interface CXTUResourceUsageInit {
 }
 
 export interface CXTUResourceUsageEntry {
-  _ptr: unknown;
-  _type: 'CXTUResourceUsageEntry';
+  kind: number;
+  amount: number;
 }
 
 export interface CXTUResourceUsageEntryInit {
@@ -540,8 +540,9 @@ export interface CXUnsavedFileInit {
  * Describes a version number of the form major.minor.subminor.
  */
 export interface CXVersion {
-  _ptr: unknown;
-  _type: 'CXVersion';
+  Major: number;
+  Minor: number;
+  Subminor: number;
 }
 
 export interface CXVersionInit {
@@ -5294,8 +5295,23 @@ export const CXVisitorResult = {
 export const CXVisit_Break: number = CXVisitorResult.CXVisit_Break;
 export const CXVisit_Continue: number = CXVisitorResult.CXVisit_Continue;
 
+/**
+ * Name of the first constant declared with `value` in the enum named
+ * `enumId`, or undefined if none matches.
+ */
+export function enumName(enumId: string, value: number | bigint): string | undefined {
+  return addon.enumName(enumId, value);
+}
+
 
 // Function exports
+declare const nativeFunctionPointer: unique symbol;
+/**
+ * A C function pointer from another addon, as an N-API External. Passed where
+ * a callback is expected, C calls it directly instead of going through JS.
+ */
+export type NativeFunctionPointer = { readonly [nativeFunctionPointer]: true };
+
 /**
  * Annotate the given set of tokens by providing cursors for each token
 that can be mapped to a specific entity within the abstract syntax tree.
@@ -5448,7 +5464,7 @@ function will return the empty string.
  * @param Results - CXCodeCompleteResults *
  * @returns CXString
  */
-export function clang_codeCompleteGetContainerUSR(Results: { _ptr: unknown }): { _type: 'CXString' } {
+export function clang_codeCompleteGetContainerUSR(Results: { _ptr: unknown }): { _type: 'CXString' } & Disposable {
   return addon.clang_codeCompleteGetContainerUSR(Results);
 }
 
@@ -5479,7 +5495,7 @@ via a call to \c clang_disposeDiagnostic().
  * @param Index - unsigned int
  * @returns CXDiagnostic
  */
-export function clang_codeCompleteGetDiagnostic(Results: { _ptr: unknown }, Index: number): { _type: 'CXDiagnostic' } {
+export function clang_codeCompleteGetDiagnostic(Results: { _ptr: unknown }, Index: number): { _type: 'CXDiagnostic' } & Disposable {
   return addon.clang_codeCompleteGetDiagnostic(Results, Index);
 }
 
@@ -5506,7 +5522,7 @@ for an Objective-C message send.
  * @param Results - CXCodeCompleteResults *
  * @returns CXString
  */
-export function clang_codeCompleteGetObjCSelector(Results: { _ptr: unknown }): { _type: 'CXString' } {
+export function clang_codeCompleteGetObjCSelector(Results: { _ptr: unknown }): { _type: 'CXString' } & Disposable {
   return addon.clang_codeCompleteGetObjCSelector(Results);
 }
 
@@ -5516,7 +5532,7 @@ export function clang_codeCompleteGetObjCSelector(Results: { _ptr: unknown }): {
  * @param category_name - const char *
  * @returns CXString
  */
-export function clang_constructUSR_ObjCCategory(class_name: string, category_name: string): { _type: 'CXString' } {
+export function clang_constructUSR_ObjCCategory(class_name: string, category_name: string): { _type: 'CXString' } & Disposable {
   return addon.clang_constructUSR_ObjCCategory(class_name, category_name);
 }
 
@@ -5525,7 +5541,7 @@ export function clang_constructUSR_ObjCCategory(class_name: string, category_nam
  * @param class_name - const char *
  * @returns CXString
  */
-export function clang_constructUSR_ObjCClass(class_name: string): { _type: 'CXString' } {
+export function clang_constructUSR_ObjCClass(class_name: string): { _type: 'CXString' } & Disposable {
   return addon.clang_constructUSR_ObjCClass(class_name);
 }
 
@@ -5536,7 +5552,7 @@ the USR for its containing class.
  * @param classUSR - CXString
  * @returns CXString
  */
-export function clang_constructUSR_ObjCIvar(name: string, classUSR: { _type: 'CXString' }): { _type: 'CXString' } {
+export function clang_constructUSR_ObjCIvar(name: string, classUSR: { _type: 'CXString' }): { _type: 'CXString' } & Disposable {
   return addon.clang_constructUSR_ObjCIvar(name, classUSR);
 }
 
@@ -5548,7 +5564,7 @@ the USR for its containing class.
  * @param classUSR - CXString
  * @returns CXString
  */
-export function clang_constructUSR_ObjCMethod(name: string, isInstanceMethod: number, classUSR: { _type: 'CXString' }): { _type: 'CXString' } {
+export function clang_constructUSR_ObjCMethod(name: string, isInstanceMethod: number, classUSR: { _type: 'CXString' }): { _type: 'CXString' } & Disposable {
   return addon.clang_constructUSR_ObjCMethod(name, isInstanceMethod, classUSR);
 }
 
@@ -5559,7 +5575,7 @@ for its containing class.
  * @param classUSR - CXString
  * @returns CXString
  */
-export function clang_constructUSR_ObjCProperty(property: string, classUSR: { _type: 'CXString' }): { _type: 'CXString' } {
+export function clang_constructUSR_ObjCProperty(property: string, classUSR: { _type: 'CXString' }): { _type: 'CXString' } & Disposable {
   return addon.clang_constructUSR_ObjCProperty(property, classUSR);
 }
 
@@ -5568,7 +5584,7 @@ export function clang_constructUSR_ObjCProperty(property: string, classUSR: { _t
  * @param protocol_name - const char *
  * @returns CXString
  */
-export function clang_constructUSR_ObjCProtocol(protocol_name: string): { _type: 'CXString' } {
+export function clang_constructUSR_ObjCProtocol(protocol_name: string): { _type: 'CXString' } & Disposable {
   return addon.clang_constructUSR_ObjCProtocol(protocol_name);
 }
 
@@ -5576,7 +5592,7 @@ export function clang_constructUSR_ObjCProtocol(protocol_name: string): { _type:
  * Creates an empty CXCursorSet.
  * @returns CXCursorSet
  */
-export function clang_createCXCursorSet(): { _type: 'CXCursorSet' } {
+export function clang_createCXCursorSet(): { _type: 'CXCursorSet' } & Disposable {
   return addon.clang_createCXCursorSet();
 }
 
@@ -5623,7 +5639,7 @@ This process of creating the 'pch', loading it separately, and using it (via
  * @param displayDiagnostics - int
  * @returns CXIndex
  */
-export function clang_createIndex(excludeDeclarationsFromPCH: number, displayDiagnostics: number): { _type: 'CXIndex' } {
+export function clang_createIndex(excludeDeclarationsFromPCH: number, displayDiagnostics: number): { _type: 'CXIndex' } & Disposable {
   return addon.clang_createIndex(excludeDeclarationsFromPCH, displayDiagnostics);
 }
 
@@ -5672,7 +5688,7 @@ return Idx;
  * @param options - const CXIndexOptions *
  * @returns CXIndex
  */
-export function clang_createIndexWithOptions(options: { _ptr: unknown }): { _type: 'CXIndex' } {
+export function clang_createIndexWithOptions(options: { _ptr: unknown }): { _type: 'CXIndex' } & Disposable {
   return addon.clang_createIndexWithOptions(options);
 }
 
@@ -5685,7 +5701,7 @@ error codes.
  * @param ast_filename - const char *
  * @returns CXTranslationUnit
  */
-export function clang_createTranslationUnit(CIdx: { _type: 'CXIndex' }, ast_filename: string): { _type: 'CXTranslationUnit' } {
+export function clang_createTranslationUnit(CIdx: { _type: 'CXIndex' }, ast_filename: string): { _type: 'CXTranslationUnit' } & Disposable {
   return addon.clang_createTranslationUnit(CIdx, ast_filename);
 }
 
@@ -5752,7 +5768,7 @@ guarantee their validity until the call to this function returns.
  * @param unsaved_files - struct CXUnsavedFile *
  * @returns CXTranslationUnit
  */
-export function clang_createTranslationUnitFromSourceFile(CIdx: { _type: 'CXIndex' }, source_filename: string, num_clang_command_line_args: number, clang_command_line_args: { _ptr: unknown }, num_unsaved_files: number, unsaved_files: { _ptr: unknown }): { _type: 'CXTranslationUnit' } {
+export function clang_createTranslationUnitFromSourceFile(CIdx: { _type: 'CXIndex' }, source_filename: string, num_clang_command_line_args: number, clang_command_line_args: { _ptr: unknown }, num_unsaved_files: number, unsaved_files: { _ptr: unknown }): { _type: 'CXTranslationUnit' } & Disposable {
   return addon.clang_createTranslationUnitFromSourceFile(CIdx, source_filename, num_clang_command_line_args, clang_command_line_args, num_unsaved_files, unsaved_files);
 }
 
@@ -5764,7 +5780,7 @@ If it's an expression, tries to evaluate the expression.
  * @param C - CXCursor
  * @returns CXEvalResult
  */
-export function clang_Cursor_Evaluate(C: { _type: 'CXCursor' }): { _type: 'CXEvalResult' } {
+export function clang_Cursor_Evaluate(C: { _type: 'CXCursor' }): { _type: 'CXEvalResult' } & Disposable {
   return addon.clang_Cursor_Evaluate(C);
 }
 
@@ -5796,7 +5812,7 @@ export function clang_Cursor_getBinaryOpcode(C: { _type: 'CXCursor' }): number {
  * @param Op - enum CX_BinaryOperatorKind
  * @returns CXString
  */
-export function clang_Cursor_getBinaryOpcodeStr(Op: number): { _type: 'CXString' } {
+export function clang_Cursor_getBinaryOpcodeStr(Op: number): { _type: 'CXString' } & Disposable {
   return addon.clang_Cursor_getBinaryOpcodeStr(Op);
 }
 
@@ -5807,7 +5823,7 @@ first paragraph.
  * @param C - CXCursor
  * @returns CXString
  */
-export function clang_Cursor_getBriefCommentText(C: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_Cursor_getBriefCommentText(C: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Cursor_getBriefCommentText(C);
 }
 
@@ -5837,7 +5853,7 @@ export function clang_Cursor_getCXXManglings(arg0: { _type: 'CXCursor' }): { _pt
  * @param arg - CXCursor
  * @returns CXString
  */
-export function clang_Cursor_getMangling(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_Cursor_getMangling(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Cursor_getMangling(arg0);
 }
 
@@ -5927,7 +5943,7 @@ name of the method that implements the getter.
  * @param C - CXCursor
  * @returns CXString
  */
-export function clang_Cursor_getObjCPropertyGetterName(C: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_Cursor_getObjCPropertyGetterName(C: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Cursor_getObjCPropertyGetterName(C);
 }
 
@@ -5937,7 +5953,7 @@ name of the method that implements the setter, if any.
  * @param C - CXCursor
  * @returns CXString
  */
-export function clang_Cursor_getObjCPropertySetterName(C: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_Cursor_getObjCPropertySetterName(C: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Cursor_getObjCPropertySetterName(C);
 }
 
@@ -5983,7 +5999,7 @@ comment text, including comment markers.
  * @param C - CXCursor
  * @returns CXString
  */
-export function clang_Cursor_getRawCommentText(C: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_Cursor_getRawCommentText(C: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Cursor_getRawCommentText(C);
 }
 
@@ -6918,7 +6934,7 @@ export function clang_EvalResult_getAsUnsigned(E: { _type: 'CXEvalResult' }): bi
  * @param E - CXEvalResult
  * @returns CXEvalResultKind
  */
-export function clang_EvalResult_getKind(E: { _type: 'CXEvalResult' }): { _type: 'CXEvalResultKind' } {
+export function clang_EvalResult_getKind(E: { _type: 'CXEvalResult' }): number {
   return addon.clang_EvalResult_getKind(E);
 }
 
@@ -6954,7 +6970,7 @@ An empty string may be returned. Use \c clang_getFileName() in that case.
  * @param file - CXFile
  * @returns CXString
  */
-export function clang_File_tryGetRealPathName(file: { _type: 'CXFile' }): { _type: 'CXString' } {
+export function clang_File_tryGetRealPathName(file: { _type: 'CXFile' }): { _type: 'CXString' } & Disposable {
   return addon.clang_File_tryGetRealPathName(file);
 }
 
@@ -6974,11 +6990,11 @@ each directive found.
  * @param visitor - CXCursorAndRangeVisitor
  * @returns CXResult
  */
-export function clang_findIncludesInFile(TU: { _type: 'CXTranslationUnit' }, file: { _type: 'CXFile' }, visitor: { _type: 'CXCursorAndRangeVisitor' }): { _type: 'CXResult' } {
+export function clang_findIncludesInFile(TU: { _type: 'CXTranslationUnit' }, file: { _type: 'CXFile' }, visitor: { _type: 'CXCursorAndRangeVisitor' }): number {
   return addon.clang_findIncludesInFile(TU, file, visitor);
 }
 
-export function clang_findIncludesInFileWithBlock(arg0: { _type: 'CXTranslationUnit' }, arg1: { _type: 'CXFile' }, arg2: { _type: 'CXCursorAndRangeVisitorBlock' }): { _type: 'CXResult' } {
+export function clang_findIncludesInFileWithBlock(arg0: { _type: 'CXTranslationUnit' }, arg1: { _type: 'CXFile' }, arg2: { _type: 'CXCursorAndRangeVisitorBlock' }): number {
   return addon.clang_findIncludesInFileWithBlock(arg0, arg1, arg2);
 }
 
@@ -7000,11 +7016,11 @@ a macro (and not a macro argument) the CXSourceRange will be invalid.
  * @param visitor - CXCursorAndRangeVisitor
  * @returns CXResult
  */
-export function clang_findReferencesInFile(cursor: { _type: 'CXCursor' }, file: { _type: 'CXFile' }, visitor: { _type: 'CXCursorAndRangeVisitor' }): { _type: 'CXResult' } {
+export function clang_findReferencesInFile(cursor: { _type: 'CXCursor' }, file: { _type: 'CXFile' }, visitor: { _type: 'CXCursorAndRangeVisitor' }): number {
   return addon.clang_findReferencesInFile(cursor, file, visitor);
 }
 
-export function clang_findReferencesInFileWithBlock(arg0: { _type: 'CXCursor' }, arg1: { _type: 'CXFile' }, arg2: { _type: 'CXCursorAndRangeVisitorBlock' }): { _type: 'CXResult' } {
+export function clang_findReferencesInFileWithBlock(arg0: { _type: 'CXCursor' }, arg1: { _type: 'CXFile' }, arg2: { _type: 'CXCursorAndRangeVisitorBlock' }): number {
   return addon.clang_findReferencesInFileWithBlock(arg0, arg1, arg2);
 }
 
@@ -7026,7 +7042,7 @@ created by combining \c CXDiagnosticDisplayOptions values.
  * @param Options - unsigned int
  * @returns CXString
  */
-export function clang_formatDiagnostic(Diagnostic: { _type: 'CXDiagnostic' }, Options: number): { _type: 'CXString' } {
+export function clang_formatDiagnostic(Diagnostic: { _type: 'CXDiagnostic' }, Options: number): { _type: 'CXString' } & Disposable {
   return addon.clang_formatDiagnostic(Diagnostic, Options);
 }
 
@@ -7103,7 +7119,7 @@ export function clang_getArraySize(T: { _type: 'CXType' }): bigint {
  * @param kind - enum CXBinaryOperatorKind
  * @returns CXString
  */
-export function clang_getBinaryOperatorKindSpelling(kind: number): { _type: 'CXString' } {
+export function clang_getBinaryOperatorKindSpelling(kind: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getBinaryOperatorKindSpelling(kind);
 }
 
@@ -7168,7 +7184,7 @@ clang_disposeDiagnosticSet.
  * @param D - CXDiagnostic
  * @returns CXDiagnosticSet
  */
-export function clang_getChildDiagnostics(D: { _type: 'CXDiagnostic' }): { _type: 'CXDiagnosticSet' } {
+export function clang_getChildDiagnostics(D: { _type: 'CXDiagnostic' }): { _type: 'CXDiagnosticSet' } & Disposable {
   return addon.clang_getChildDiagnostics(D);
 }
 
@@ -7177,7 +7193,7 @@ export function clang_getChildDiagnostics(D: { _type: 'CXDiagnostic' }): { _type
 intended to be parsed (the format is not guaranteed to be stable).
  * @returns CXString
  */
-export function clang_getClangVersion(): { _type: 'CXString' } {
+export function clang_getClangVersion(): { _type: 'CXString' } & Disposable {
   return addon.clang_getClangVersion();
 }
 
@@ -7195,7 +7211,7 @@ completion string.
  * @param annotation_number - unsigned int
  * @returns CXString
  */
-export function clang_getCompletionAnnotation(completion_string: { _type: 'CXCompletionString' }, annotation_number: number): { _type: 'CXString' } {
+export function clang_getCompletionAnnotation(completion_string: { _type: 'CXCompletionString' }, annotation_number: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getCompletionAnnotation(completion_string, annotation_number);
 }
 
@@ -7219,7 +7235,7 @@ that corresponds to the given completion string.
  * @param completion_string - CXCompletionString
  * @returns CXString
  */
-export function clang_getCompletionBriefComment(completion_string: { _type: 'CXCompletionString' }): { _type: 'CXString' } {
+export function clang_getCompletionBriefComment(completion_string: { _type: 'CXCompletionString' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCompletionBriefComment(completion_string);
 }
 
@@ -7270,7 +7286,7 @@ completion string.
  * @param chunk_number - unsigned int
  * @returns CXString
  */
-export function clang_getCompletionChunkText(completion_string: { _type: 'CXCompletionString' }, chunk_number: number): { _type: 'CXString' } {
+export function clang_getCompletionChunkText(completion_string: { _type: 'CXCompletionString' }, chunk_number: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getCompletionChunkText(completion_string, chunk_number);
 }
 
@@ -7322,7 +7338,7 @@ before the completion at completion_index can be applied
  * @param replacement_range - CXSourceRange *
  * @returns CXString
  */
-export function clang_getCompletionFixIt(results: { _ptr: unknown }, completion_index: number, fixit_index: number, replacement_range: { _ptr: unknown }): { _type: 'CXString' } {
+export function clang_getCompletionFixIt(results: { _ptr: unknown }, completion_index: number, fixit_index: number, replacement_range: { _ptr: unknown }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCompletionFixIt(results, completion_index, fixit_index, replacement_range);
 }
 
@@ -7380,7 +7396,7 @@ the completion string represents a method in the NSObject class.
  * @param kind - enum CXCursorKind *
  * @returns CXString
  */
-export function clang_getCompletionParent(completion_string: { _type: 'CXCompletionString' }, kind: { _ptr: unknown }): { _type: 'CXString' } {
+export function clang_getCompletionParent(completion_string: { _type: 'CXCompletionString' }, kind: { _ptr: unknown }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCompletionParent(completion_string, kind);
 }
 
@@ -7520,7 +7536,7 @@ class template specialization.
  * @param arg - CXCursor
  * @returns CXString
  */
-export function clang_getCursorDisplayName(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_getCursorDisplayName(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCursorDisplayName(arg0);
 }
 
@@ -7573,7 +7589,7 @@ be relied upon.
  * @param Kind - enum CXCursorKind
  * @returns CXString
  */
-export function clang_getCursorKindSpelling(Kind: number): { _type: 'CXString' } {
+export function clang_getCursorKindSpelling(Kind: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getCursorKindSpelling(Kind);
 }
 
@@ -7713,7 +7729,7 @@ other cursors.
  * @param Policy - CXPrintingPolicy
  * @returns CXString
  */
-export function clang_getCursorPrettyPrinted(Cursor: { _type: 'CXCursor' }, Policy: { _type: 'CXPrintingPolicy' }): { _type: 'CXString' } {
+export function clang_getCursorPrettyPrinted(Cursor: { _type: 'CXCursor' }, Policy: { _type: 'CXPrintingPolicy' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCursorPrettyPrinted(Cursor, Policy);
 }
 
@@ -7725,7 +7741,7 @@ clang_PrintingPolicy_dispose.
  * @param arg - CXCursor
  * @returns CXPrintingPolicy
  */
-export function clang_getCursorPrintingPolicy(arg0: { _type: 'CXCursor' }): { _type: 'CXPrintingPolicy' } {
+export function clang_getCursorPrintingPolicy(arg0: { _type: 'CXCursor' }): { _type: 'CXPrintingPolicy' } & Disposable {
   return addon.clang_getCursorPrintingPolicy(arg0);
 }
 
@@ -7827,7 +7843,7 @@ export function clang_getCursorSemanticParent(cursor: { _type: 'CXCursor' }): {
  * @param arg - CXCursor
  * @returns CXString
  */
-export function clang_getCursorSpelling(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_getCursorSpelling(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCursorSpelling(arg0);
 }
 
@@ -7872,7 +7888,7 @@ one translation refer to an entity defined in another translation unit.
  * @param arg - CXCursor
  * @returns CXString
  */
-export function clang_getCursorUSR(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_getCursorUSR(arg0: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getCursorUSR(arg0);
 }
 
@@ -7899,7 +7915,7 @@ should be released with clang_disposeCXTUResourceUsage().
  * @param TU - CXTranslationUnit
  * @returns CXTUResourceUsage
  */
-export function clang_getCXTUResourceUsage(TU: { _type: 'CXTranslationUnit' }): { _type: 'CXTUResourceUsage' } {
+export function clang_getCXTUResourceUsage(TU: { _type: 'CXTranslationUnit' }): { _type: 'CXTUResourceUsage' } & Disposable {
   return addon.clang_getCXTUResourceUsage(TU);
 }
 
@@ -7921,7 +7937,7 @@ export function clang_getCXXAccessSpecifier(arg0: { _type: 'CXCursor' }): number
  * @param C - CXCursor
  * @returns CXString
  */
-export function clang_getDeclObjCTypeEncoding(C: { _type: 'CXCursor' }): { _type: 'CXString' } {
+export function clang_getDeclObjCTypeEncoding(C: { _type: 'CXCursor' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getDeclObjCTypeEncoding(C);
 }
 
@@ -7941,7 +7957,7 @@ via a call to \c clang_disposeDiagnostic().
  * @param Index - unsigned int
  * @returns CXDiagnostic
  */
-export function clang_getDiagnostic(Unit: { _type: 'CXTranslationUnit' }, Index: number): { _type: 'CXDiagnostic' } {
+export function clang_getDiagnostic(Unit: { _type: 'CXTranslationUnit' }, Index: number): { _type: 'CXDiagnostic' } & Disposable {
   return addon.clang_getDiagnostic(Unit, Index);
 }
 
@@ -7973,7 +7989,7 @@ instead.
  * @param Category - unsigned int
  * @returns CXString
  */
-export function clang_getDiagnosticCategoryName(Category: number): { _type: 'CXString' } {
+export function clang_getDiagnosticCategoryName(Category: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getDiagnosticCategoryName(Category);
 }
 
@@ -7984,7 +8000,7 @@ export function clang_getDiagnosticCategoryName(Category: number): { _type: 'CXS
  * @param arg - CXDiagnostic
  * @returns CXString
  */
-export function clang_getDiagnosticCategoryText(arg0: { _type: 'CXDiagnostic' }): { _type: 'CXString' } {
+export function clang_getDiagnosticCategoryText(arg0: { _type: 'CXDiagnostic' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getDiagnosticCategoryText(arg0);
 }
 
@@ -8017,7 +8033,7 @@ code indicated by the \c ReplacementRange.
  * @param ReplacementRange - CXSourceRange *
  * @returns CXString
  */
-export function clang_getDiagnosticFixIt(Diagnostic: { _type: 'CXDiagnostic' }, FixIt: number, ReplacementRange: { _ptr: unknown }): { _type: 'CXString' } {
+export function clang_getDiagnosticFixIt(Diagnostic: { _type: 'CXDiagnostic' }, FixIt: number, ReplacementRange: { _ptr: unknown }): { _type: 'CXString' } & Disposable {
   return addon.clang_getDiagnosticFixIt(Diagnostic, FixIt, ReplacementRange);
 }
 
@@ -8033,7 +8049,7 @@ via a call to \c clang_disposeDiagnostic().
  * @param Index - unsigned int
  * @returns CXDiagnostic
  */
-export function clang_getDiagnosticInSet(Diags: { _type: 'CXDiagnosticSet' }, Index: number): { _type: 'CXDiagnostic' } {
+export function clang_getDiagnosticInSet(Diags: { _type: 'CXDiagnosticSet' }, Index: number): { _type: 'CXDiagnostic' } & Disposable {
   return addon.clang_getDiagnosticInSet(Diags, Index);
 }
 
@@ -8084,7 +8100,7 @@ warning, such as "-Wconversion" or "-pedantic".
  * @param Disable - CXString *
  * @returns CXString
  */
-export function clang_getDiagnosticOption(Diag: { _type: 'CXDiagnostic' }, Disable: { _ptr: unknown }): { _type: 'CXString' } {
+export function clang_getDiagnosticOption(Diag: { _type: 'CXDiagnostic' }, Disable: { _ptr: unknown }): { _type: 'CXString' } & Disposable {
   return addon.clang_getDiagnosticOption(Diag, Disable);
 }
 
@@ -8116,7 +8132,7 @@ translation unit.
  * @param Unit - CXTranslationUnit
  * @returns CXDiagnosticSet
  */
-export function clang_getDiagnosticSetFromTU(Unit: { _type: 'CXTranslationUnit' }): { _type: 'CXDiagnosticSet' } {
+export function clang_getDiagnosticSetFromTU(Unit: { _type: 'CXTranslationUnit' }): { _type: 'CXDiagnosticSet' } & Disposable {
   return addon.clang_getDiagnosticSetFromTU(Unit);
 }
 
@@ -8134,7 +8150,7 @@ export function clang_getDiagnosticSeverity(arg0: { _type: 'CXDiagnostic' }): nu
  * @param arg - CXDiagnostic
  * @returns CXString
  */
-export function clang_getDiagnosticSpelling(arg0: { _type: 'CXDiagnostic' }): { _type: 'CXString' } {
+export function clang_getDiagnosticSpelling(arg0: { _type: 'CXDiagnostic' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getDiagnosticSpelling(arg0);
 }
 
@@ -8329,7 +8345,7 @@ export function clang_getFileLocation(location: { _type: 'CXSourceLocation' }, f
  * @param SFile - CXFile
  * @returns CXString
  */
-export function clang_getFileName(SFile: { _type: 'CXFile' }): { _type: 'CXString' } {
+export function clang_getFileName(SFile: { _type: 'CXFile' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getFileName(SFile);
 }
 
@@ -8397,7 +8413,7 @@ is inspecting the inclusions in the PCH file itself).
  * @param visitor - CXInclusionVisitor
  * @param client_data - CXClientData
  */
-export function clang_getInclusions(tu: { _type: 'CXTranslationUnit' }, visitor: { _type: 'CXInclusionVisitor' }, client_data: { _type: 'CXClientData' }): void {
+export function clang_getInclusions(tu: { _type: 'CXTranslationUnit' }, visitor: ((arg0: { _type: 'CXFile' }, arg1: { _ptr: unknown }, arg2: number) => void) | NativeFunctionPointer | null, client_data?: { _type: 'CXClientData' } | null): void {
   addon.clang_getInclusions(tu, visitor, client_data);
 }
 
@@ -8743,7 +8759,7 @@ via a call to \c clang_remap_dispose(). Can return NULL if an error occurred.
  * @param path - const char *
  * @returns CXRemapping
  */
-export function clang_getRemappings(path: string): { _type: 'CXRemapping' } {
+export function clang_getRemappings(path: string): { _type: 'CXRemapping' } & Disposable {
   return addon.clang_getRemappings(path);
 }
 
@@ -8760,7 +8776,7 @@ via a call to \c clang_remap_dispose(). Can return NULL if an error occurred.
  * @param numFiles - unsigned int
  * @returns CXRemapping
  */
-export function clang_getRemappingsFromFileList(filePaths: { _ptr: unknown }, numFiles: number): { _type: 'CXRemapping' } {
+export function clang_getRemappingsFromFileList(filePaths: { _ptr: unknown }, numFiles: number): { _type: 'CXRemapping' } & Disposable {
   return addon.clang_getRemappingsFromFileList(filePaths, numFiles);
 }
 
@@ -8909,7 +8925,7 @@ export function clang_getTokenExtent(arg0: { _type: 'CXTranslationUnit' }, arg1:
  * @param arg - CXToken
  * @returns CXTokenKind
  */
-export function clang_getTokenKind(arg0: { _type: 'CXToken' }): { _type: 'CXTokenKind' } {
+export function clang_getTokenKind(arg0: { _type: 'CXToken' }): number {
   return addon.clang_getTokenKind(arg0);
 }
 
@@ -8932,7 +8948,7 @@ the text of an identifier or keyword.
  * @param arg - CXToken
  * @returns CXString
  */
-export function clang_getTokenSpelling(arg0: { _type: 'CXTranslationUnit' }, arg1: { _type: 'CXToken' }): { _type: 'CXString' } {
+export function clang_getTokenSpelling(arg0: { _type: 'CXTranslationUnit' }, arg1: { _type: 'CXToken' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getTokenSpelling(arg0, arg1);
 }
 
@@ -8953,7 +8969,7 @@ export function clang_getTranslationUnitCursor(arg0: { _type: 'CXTranslationUnit
  * @param CTUnit - CXTranslationUnit
  * @returns CXString
  */
-export function clang_getTranslationUnitSpelling(CTUnit: { _type: 'CXTranslationUnit' }): { _type: 'CXString' } {
+export function clang_getTranslationUnitSpelling(CTUnit: { _type: 'CXTranslationUnit' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getTranslationUnitSpelling(CTUnit);
 }
 
@@ -8964,7 +8980,7 @@ The CXTargetInfo object cannot outlive the CXTranslationUnit object.
  * @param CTUnit - CXTranslationUnit
  * @returns CXTargetInfo
  */
-export function clang_getTranslationUnitTargetInfo(CTUnit: { _type: 'CXTranslationUnit' }): { _type: 'CXTargetInfo' } {
+export function clang_getTranslationUnitTargetInfo(CTUnit: { _type: 'CXTranslationUnit' }): { _type: 'CXTargetInfo' } & Disposable {
   return addon.clang_getTranslationUnitTargetInfo(CTUnit);
 }
 
@@ -9004,7 +9020,7 @@ export function clang_getTypedefDeclUnderlyingType(C: { _type: 'CXCursor' }): {
  * @param CT - CXType
  * @returns CXString
  */
-export function clang_getTypedefName(CT: { _type: 'CXType' }): { _type: 'CXString' } {
+export function clang_getTypedefName(CT: { _type: 'CXType' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getTypedefName(CT);
 }
 
@@ -9013,7 +9029,7 @@ export function clang_getTypedefName(CT: { _type: 'CXType' }): { _type: 'CXStrin
  * @param K - enum CXTypeKind
  * @returns CXString
  */
-export function clang_getTypeKindSpelling(K: number): { _type: 'CXString' } {
+export function clang_getTypeKindSpelling(K: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getTypeKindSpelling(K);
 }
 
@@ -9025,7 +9041,7 @@ If the type is invalid, an empty string is returned.
  * @param cxPolicy - CXPrintingPolicy
  * @returns CXString
  */
-export function clang_getTypePrettyPrinted(CT: { _type: 'CXType' }, cxPolicy: { _type: 'CXPrintingPolicy' }): { _type: 'CXString' } {
+export function clang_getTypePrettyPrinted(CT: { _type: 'CXType' }, cxPolicy: { _type: 'CXPrintingPolicy' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getTypePrettyPrinted(CT, cxPolicy);
 }
 
@@ -9037,7 +9053,7 @@ If the type is invalid, an empty string is returned.
  * @param CT - CXType
  * @returns CXString
  */
-export function clang_getTypeSpelling(CT: { _type: 'CXType' }): { _type: 'CXString' } {
+export function clang_getTypeSpelling(CT: { _type: 'CXType' }): { _type: 'CXString' } & Disposable {
   return addon.clang_getTypeSpelling(CT);
 }
 
@@ -9046,7 +9062,7 @@ export function clang_getTypeSpelling(CT: { _type: 'CXType' }): { _type: 'CXStri
  * @param kind - enum CXUnaryOperatorKind
  * @returns CXString
  */
-export function clang_getUnaryOperatorKindSpelling(kind: number): { _type: 'CXString' } {
+export function clang_getUnaryOperatorKindSpelling(kind: number): { _type: 'CXString' } & Disposable {
   return addon.clang_getUnaryOperatorKindSpelling(kind);
 }
 
@@ -9147,7 +9163,7 @@ export function clang_index_getObjCProtocolRefListInfo(arg0: { _ptr: unknown }):
   return addon.clang_index_getObjCProtocolRefListInfo(arg0);
 }
 
-export function clang_index_isEntityObjCContainerKind(arg0: { _type: 'CXIdxEntityKind' }): number {
+export function clang_index_isEntityObjCContainerKind(arg0: number): number {
   return addon.clang_index_isEntityObjCContainerKind(arg0);
 }
 
@@ -9178,7 +9194,7 @@ translation units.
  * @param CIdx - CXIndex
  * @returns CXIndexAction
  */
-export function clang_IndexAction_create(CIdx: { _type: 'CXIndex' }): { _type: 'CXIndexAction' } {
+export function clang_IndexAction_create(CIdx: { _type: 'CXIndex' }): { _type: 'CXIndexAction' } & Disposable {
   return addon.clang_IndexAction_create(CIdx);
 }
 
@@ -9532,7 +9548,7 @@ diagnostics should be released using clang_disposeDiagnosticSet().
  * @param errorString - CXString *
  * @returns CXDiagnosticSet
  */
-export function clang_loadDiagnostics(file: string, error: { _ptr: unknown }, errorString: { _ptr: unknown }): { _type: 'CXDiagnosticSet' } {
+export function clang_loadDiagnostics(file: string, error: { _ptr: unknown }, errorString: { _ptr: unknown }): { _type: 'CXDiagnosticSet' } & Disposable {
   return addon.clang_loadDiagnostics(file, error, errorString);
 }
 
@@ -9573,7 +9589,7 @@ export function clang_Module_getASTFile(Module: { _type: 'CXModule' }): { _type:
  * @param Module - CXModule
  * @returns CXString
  */
-export function clang_Module_getFullName(Module: { _type: 'CXModule' }): { _type: 'CXString' } {
+export function clang_Module_getFullName(Module: { _type: 'CXModule' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Module_getFullName(Module);
 }
 
@@ -9585,7 +9601,7 @@ will return "vector".
  * @param Module - CXModule
  * @returns CXString
  */
-export function clang_Module_getName(Module: { _type: 'CXModule' }): { _type: 'CXString' } {
+export function clang_Module_getName(Module: { _type: 'CXModule' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Module_getName(Module);
 }
 
@@ -9647,7 +9663,7 @@ Must be disposed with \c clang_ModuleMapDescriptor_dispose().
  * @param options - unsigned int
  * @returns CXModuleMapDescriptor
  */
-export function clang_ModuleMapDescriptor_create(options: number): { _type: 'CXModuleMapDescriptor' } {
+export function clang_ModuleMapDescriptor_create(options: number): { _type: 'CXModuleMapDescriptor' } & Disposable {
   return addon.clang_ModuleMapDescriptor_create(options);
 }
 
@@ -9713,7 +9729,7 @@ error codes.
  * @param options - unsigned int
  * @returns CXTranslationUnit
  */
-export function clang_parseTranslationUnit(CIdx: { _type: 'CXIndex' }, source_filename: string, command_line_args: { _ptr: unknown }, num_command_line_args: number, unsaved_files: { _ptr: unknown }, num_unsaved_files: number, options: number): { _type: 'CXTranslationUnit' } {
+export function clang_parseTranslationUnit(CIdx: { _type: 'CXIndex' }, source_filename: string, command_line_args: { _ptr: unknown }, num_command_line_args: number, unsaved_files: { _ptr: unknown }, num_unsaved_files: number, options: number): { _type: 'CXTranslationUnit' } & Disposable {
   return addon.clang_parseTranslationUnit(CIdx, source_filename, command_line_args, num_command_line_args, unsaved_files, num_unsaved_files, options);
 }
 
@@ -9993,7 +10009,7 @@ Returns the empty string in case of any error.
  * @param Info - CXTargetInfo
  * @returns CXString
  */
-export function clang_TargetInfo_getTriple(Info: { _type: 'CXTargetInfo' }): { _type: 'CXString' } {
+export function clang_TargetInfo_getTriple(Info: { _type: 'CXTargetInfo' }): { _type: 'CXString' } & Disposable {
   return addon.clang_TargetInfo_getTriple(Info);
 }
 
@@ -10141,7 +10157,7 @@ export function clang_Type_getNumTemplateArguments(T: { _type: 'CXType' }): numb
  * @param type - CXType
  * @returns CXString
  */
-export function clang_Type_getObjCEncoding(type: { _type: 'CXType' }): { _type: 'CXString' } {
+export function clang_Type_getObjCEncoding(type: { _type: 'CXType' }): { _type: 'CXString' } & Disposable {
   return addon.clang_Type_getObjCEncoding(type);
 }
 
@@ -10279,7 +10295,7 @@ prematurely by the visitor returning \c CXFieldVisit_Break.
  * @param client_data - CXClientData
  * @returns unsigned int
  */
-export function clang_Type_visitFields(T: { _type: 'CXType' }, visitor: { _type: 'CXFieldVisitor' }, client_data: { _type: 'CXClientData' }): number {
+export function clang_Type_visitFields(T: { _type: 'CXType' }, visitor: ((arg0: { _type: 'CXCursor' }) => number | void) | NativeFunctionPointer | null, client_data?: { _type: 'CXClientData' } | null): number {
   return addon.clang_Type_visitFields(T, visitor, client_data);
 }
 
@@ -10304,7 +10320,7 @@ Must be disposed with \c clang_VirtualFileOverlay_dispose().
  * @param options - unsigned int
  * @returns CXVirtualFileOverlay
  */
-export function clang_VirtualFileOverlay_create(options: number): { _type: 'CXVirtualFileOverlay' } {
+export function clang_VirtualFileOverlay_create(options: number): { _type: 'CXVirtualFileOverlay' } & Disposable {
   return addon.clang_VirtualFileOverlay_create(options);
 }
 
@@ -10373,7 +10389,7 @@ prematurely by the visitor returning \c CXChildVisit_Break.
  * @param client_data - CXClientData
  * @returns unsigned int
  */
-export function clang_visitChildren(parent: { _type: 'CXCursor' }, visitor: { _type: 'CXCursorVisitor' }, client_data: { _type: 'CXClientData' }): number {
+export function clang_visitChildren(parent: { _type: 'CXCursor' }, visitor: ((arg0: { _type: 'CXCursor' }, arg1: { _type: 'CXCursor' }) => number | void) | NativeFunctionPointer | null, client_data?: { _type: 'CXClientData' } | null): number {
   return addon.clang_visitChildren(parent, visitor, client_data);
 }
 
@@ -10411,7 +10427,7 @@ prematurely by the visitor returning \c CXFieldVisit_Break.
  * @param client_data - CXClientData
  * @returns unsigned int
  */
-export function clang_visitCXXBaseClasses(T: { _type: 'CXType' }, visitor: { _type: 'CXFieldVisitor' }, client_data: { _type: 'CXClientData' }): number {
+export function clang_visitCXXBaseClasses(T: { _type: 'CXType' }, visitor: ((arg0: { _type: 'CXCursor' }) => number | void) | NativeFunctionPointer | null, client_data?: { _type: 'CXClientData' } | null): number {
   return addon.clang_visitCXXBaseClasses(T, visitor, client_data);
 }
 
@@ -10433,14 +10449,14 @@ export function createCXCodeCompleteResults(init?: CXCodeCompleteResultsInit): C
  * Get NumResults field from CXCodeCompleteResults
  */
 export function getCXCodeCompleteResults_NumResults(struct: CXCodeCompleteResults): number {
-  return addon.get_CXCodeCompleteResults_field(struct, 'NumResults');
+  return addon.get_CXCodeCompleteResults_field(struct, 0);
 }
 
 /**
  * Get Results field from CXCodeCompleteResults
  */
 export function getCXCodeCompleteResults_Results(struct: CXCodeCompleteResults): { _ptr: unknown } {
-  return addon.get_CXCodeCompleteResults_field(struct, 'Results');
+  return addon.get_CXCodeCompleteResults_field(struct, 1);
 }
 
 /**
@@ -10448,8 +10464,8 @@ export function getCXCodeCompleteResults_Results(struct: CXCodeCompleteResults):
  */
 export function getCXCodeCompleteResultsFields(struct: CXCodeCompleteResults): CXCodeCompleteResultsInit {
   return {
-    Results: addon.get_CXCodeCompleteResults_field(struct, 'Results'),
-    NumResults: addon.get_CXCodeCompleteResults_field(struct, 'NumResults'),
+    Results: addon.get_CXCodeCompleteResults_field(struct, 1),
+    NumResults: addon.get_CXCodeCompleteResults_field(struct, 0),
   };
 }
 
@@ -10465,14 +10481,14 @@ export function createCXCompletionResult(init?: CXCompletionResultInit): CXCompl
  * Get CompletionString field from CXCompletionResult
  */
 export function getCXCompletionResult_CompletionString(struct: CXCompletionResult): { _type: 'CXCompletionString' } {
-  return addon.get_CXCompletionResult_field(struct, 'CompletionString');
+  return addon.get_CXCompletionResult_field(struct, 0);
 }
 
 /**
  * Get CursorKind field from CXCompletionResult
  */
 export function getCXCompletionResult_CursorKind(struct: CXCompletionResult): number {
-  return addon.get_CXCompletionResult_field(struct, 'CursorKind');
+  return addon.get_CXCompletionResult_field(struct, 1);
 }
 
 /**
@@ -10480,8 +10496,8 @@ export function getCXCompletionResult_CursorKind(struct: CXCompletionResult): nu
  */
 export function getCXCompletionResultFields(struct: CXCompletionResult): CXCompletionResultInit {
   return {
-    CursorKind: addon.get_CXCompletionResult_field(struct, 'CursorKind'),
-    CompletionString: addon.get_CXCompletionResult_field(struct, 'CompletionString'),
+    CursorKind: addon.get_CXCompletionResult_field(struct, 1),
+    CompletionString: addon.get_CXCompletionResult_field(struct, 0),
   };
 }
 
@@ -10512,21 +10528,21 @@ export function createCXCursor(init?: CXCursorInit): CXCursor {
  * Get data field from CXCursor
  */
 export function getCXCursor_data(struct: CXCursor): unknown[] {
-  return addon.get_CXCursor_field(struct, 'data');
+  return addon.get_CXCursor_field(struct, 0);
 }
 
 /**
  * Get kind field from CXCursor
  */
 export function getCXCursor_kind(struct: CXCursor): number {
-  return addon.get_CXCursor_field(struct, 'kind');
+  return addon.get_CXCursor_field(struct, 1);
 }
 
 /**
  * Get xdata field from CXCursor
  */
 export function getCXCursor_xdata(struct: CXCursor): number {
-  return addon.get_CXCursor_field(struct, 'xdata');
+  return addon.get_CXCursor_field(struct, 2);
 }
 
 /**
@@ -10534,9 +10550,9 @@ export function getCXCursor_xdata(struct: CXCursor): number {
  */
 export function getCXCursorFields(struct: CXCursor): CXCursorInit {
   return {
-    kind: addon.get_CXCursor_field(struct, 'kind'),
-    xdata: addon.get_CXCursor_field(struct, 'xdata'),
-    data: addon.get_CXCursor_field(struct, 'data'),
+    kind: addon.get_CXCursor_field(struct, 1),
+    xdata: addon.get_CXCursor_field(struct, 2),
+    data: addon.get_CXCursor_field(struct, 0),
   };
 }
 
@@ -10548,14 +10564,14 @@ export function createCXCursorAndRangeVisitor(init?: CXCursorAndRangeVisitorInit
  * Get context field from CXCursorAndRangeVisitor
  */
 export function getCXCursorAndRangeVisitor_context(struct: CXCursorAndRangeVisitor): unknown {
-  return addon.get_CXCursorAndRangeVisitor_field(struct, 'context');
+  return addon.get_CXCursorAndRangeVisitor_field(struct, 0);
 }
 
 /**
  * Get visit field from CXCursorAndRangeVisitor
  */
 export function getCXCursorAndRangeVisitor_visit(struct: CXCursorAndRangeVisitor): number {
-  return addon.get_CXCursorAndRangeVisitor_field(struct, 'visit');
+  return addon.get_CXCursorAndRangeVisitor_field(struct, 1);
 }
 
 /**
@@ -10563,8 +10579,8 @@ export function getCXCursorAndRangeVisitor_visit(struct: CXCursorAndRangeVisitor
  */
 export function getCXCursorAndRangeVisitorFields(struct: CXCursorAndRangeVisitor): CXCursorAndRangeVisitorInit {
   return {
-    context: addon.get_CXCursorAndRangeVisitor_field(struct, 'context'),
-    visit: addon.get_CXCursorAndRangeVisitor_field(struct, 'visit'),
+    context: addon.get_CXCursorAndRangeVisitor_field(struct, 0),
+    visit: addon.get_CXCursorAndRangeVisitor_field(struct, 1),
   };
 }
 
@@ -10592,8 +10608,8 @@ export function createCXFileUniqueID(init?: CXFileUniqueIDInit): CXFileUniqueID
 /**
  * Get data field from CXFileUniqueID
  */
-export function getCXFileUniqueID_data(struct: CXFileUniqueID): unknown[] {
-  return addon.get_CXFileUniqueID_field(struct, 'data');
+export function getCXFileUniqueID_data(struct: CXFileUniqueID): BigUint64Array {
+  return addon.get_CXFileUniqueID_field(struct, 0);
 }
 
 /**
@@ -10601,7 +10617,7 @@ export function getCXFileUniqueID_data(struct: CXFileUniqueID): unknown[] {
  */
 export function getCXFileUniqueIDFields(struct: CXFileUniqueID): CXFileUniqueIDInit {
   return {
-    data: addon.get_CXFileUniqueID_field(struct, 'data'),
+    data: addon.get_CXFileUniqueID_field(struct, 0),
   };
 }
 
@@ -10613,21 +10629,21 @@ export function createCXIdxAttrInfo(init?: CXIdxAttrInfoInit): CXIdxAttrInfo {
  * Get cursor field from CXIdxAttrInfo
  */
 export function getCXIdxAttrInfo_cursor(struct: CXIdxAttrInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxAttrInfo_field(struct, 'cursor');
+  return addon.get_CXIdxAttrInfo_field(struct, 0);
 }
 
 /**
  * Get kind field from CXIdxAttrInfo
  */
-export function getCXIdxAttrInfo_kind(struct: CXIdxAttrInfo): { _type: 'CXIdxAttrKind' } {
-  return addon.get_CXIdxAttrInfo_field(struct, 'kind');
+export function getCXIdxAttrInfo_kind(struct: CXIdxAttrInfo): number {
+  return addon.get_CXIdxAttrInfo_field(struct, 1);
 }
 
 /**
  * Get loc field from CXIdxAttrInfo
  */
 export function getCXIdxAttrInfo_loc(struct: CXIdxAttrInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxAttrInfo_field(struct, 'loc');
+  return addon.get_CXIdxAttrInfo_field(struct, 2);
 }
 
 /**
@@ -10635,9 +10651,9 @@ export function getCXIdxAttrInfo_loc(struct: CXIdxAttrInfo): { _type: 'CXIdxLoc'
  */
 export function getCXIdxAttrInfoFields(struct: CXIdxAttrInfo): CXIdxAttrInfoInit {
   return {
-    kind: addon.get_CXIdxAttrInfo_field(struct, 'kind'),
-    cursor: addon.get_CXIdxAttrInfo_field(struct, 'cursor'),
-    loc: addon.get_CXIdxAttrInfo_field(struct, 'loc'),
+    kind: addon.get_CXIdxAttrInfo_field(struct, 1),
+    cursor: addon.get_CXIdxAttrInfo_field(struct, 0),
+    loc: addon.get_CXIdxAttrInfo_field(struct, 2),
   };
 }
 
@@ -10649,21 +10665,21 @@ export function createCXIdxBaseClassInfo(init?: CXIdxBaseClassInfoInit): CXIdxBa
  * Get base field from CXIdxBaseClassInfo
  */
 export function getCXIdxBaseClassInfo_base(struct: CXIdxBaseClassInfo): { _ptr: unknown } {
-  return addon.get_CXIdxBaseClassInfo_field(struct, 'base');
+  return addon.get_CXIdxBaseClassInfo_field(struct, 0);
 }
 
 /**
  * Get cursor field from CXIdxBaseClassInfo
  */
 export function getCXIdxBaseClassInfo_cursor(struct: CXIdxBaseClassInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxBaseClassInfo_field(struct, 'cursor');
+  return addon.get_CXIdxBaseClassInfo_field(struct, 1);
 }
 
 /**
  * Get loc field from CXIdxBaseClassInfo
  */
 export function getCXIdxBaseClassInfo_loc(struct: CXIdxBaseClassInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxBaseClassInfo_field(struct, 'loc');
+  return addon.get_CXIdxBaseClassInfo_field(struct, 2);
 }
 
 /**
@@ -10671,9 +10687,9 @@ export function getCXIdxBaseClassInfo_loc(struct: CXIdxBaseClassInfo): { _type:
  */
 export function getCXIdxBaseClassInfoFields(struct: CXIdxBaseClassInfo): CXIdxBaseClassInfoInit {
   return {
-    base: addon.get_CXIdxBaseClassInfo_field(struct, 'base'),
-    cursor: addon.get_CXIdxBaseClassInfo_field(struct, 'cursor'),
-    loc: addon.get_CXIdxBaseClassInfo_field(struct, 'loc'),
+    base: addon.get_CXIdxBaseClassInfo_field(struct, 0),
+    cursor: addon.get_CXIdxBaseClassInfo_field(struct, 1),
+    loc: addon.get_CXIdxBaseClassInfo_field(struct, 2),
   };
 }
 
@@ -10685,7 +10701,7 @@ export function createCXIdxContainerInfo(init?: CXIdxContainerInfoInit): CXIdxCo
  * Get cursor field from CXIdxContainerInfo
  */
 export function getCXIdxContainerInfo_cursor(struct: CXIdxContainerInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxContainerInfo_field(struct, 'cursor');
+  return addon.get_CXIdxContainerInfo_field(struct, 0);
 }
 
 /**
@@ -10693,7 +10709,7 @@ export function getCXIdxContainerInfo_cursor(struct: CXIdxContainerInfo): { _typ
  */
 export function getCXIdxContainerInfoFields(struct: CXIdxContainerInfo): CXIdxContainerInfoInit {
   return {
-    cursor: addon.get_CXIdxContainerInfo_field(struct, 'cursor'),
+    cursor: addon.get_CXIdxContainerInfo_field(struct, 0),
   };
 }
 
@@ -10705,21 +10721,21 @@ export function createCXIdxCXXClassDeclInfo(init?: CXIdxCXXClassDeclInfoInit): C
  * Get bases field from CXIdxCXXClassDeclInfo
  */
 export function getCXIdxCXXClassDeclInfo_bases(struct: CXIdxCXXClassDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxCXXClassDeclInfo_field(struct, 'bases');
+  return addon.get_CXIdxCXXClassDeclInfo_field(struct, 0);
 }
 
 /**
  * Get declInfo field from CXIdxCXXClassDeclInfo
  */
 export function getCXIdxCXXClassDeclInfo_declInfo(struct: CXIdxCXXClassDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxCXXClassDeclInfo_field(struct, 'declInfo');
+  return addon.get_CXIdxCXXClassDeclInfo_field(struct, 1);
 }
 
 /**
  * Get numBases field from CXIdxCXXClassDeclInfo
  */
 export function getCXIdxCXXClassDeclInfo_numBases(struct: CXIdxCXXClassDeclInfo): number {
-  return addon.get_CXIdxCXXClassDeclInfo_field(struct, 'numBases');
+  return addon.get_CXIdxCXXClassDeclInfo_field(struct, 2);
 }
 
 /**
@@ -10727,9 +10743,9 @@ export function getCXIdxCXXClassDeclInfo_numBases(struct: CXIdxCXXClassDeclInfo)
  */
 export function getCXIdxCXXClassDeclInfoFields(struct: CXIdxCXXClassDeclInfo): CXIdxCXXClassDeclInfoInit {
   return {
-    declInfo: addon.get_CXIdxCXXClassDeclInfo_field(struct, 'declInfo'),
-    bases: addon.get_CXIdxCXXClassDeclInfo_field(struct, 'bases'),
-    numBases: addon.get_CXIdxCXXClassDeclInfo_field(struct, 'numBases'),
+    declInfo: addon.get_CXIdxCXXClassDeclInfo_field(struct, 1),
+    bases: addon.get_CXIdxCXXClassDeclInfo_field(struct, 0),
+    numBases: addon.get_CXIdxCXXClassDeclInfo_field(struct, 2),
   };
 }
 
@@ -10741,91 +10757,91 @@ export function createCXIdxDeclInfo(init?: CXIdxDeclInfoInit): CXIdxDeclInfo {
  * Get attributes field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_attributes(struct: CXIdxDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'attributes');
+  return addon.get_CXIdxDeclInfo_field(struct, 0);
 }
 
 /**
  * Get cursor field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_cursor(struct: CXIdxDeclInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'cursor');
+  return addon.get_CXIdxDeclInfo_field(struct, 1);
 }
 
 /**
  * Get declAsContainer field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_declAsContainer(struct: CXIdxDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'declAsContainer');
+  return addon.get_CXIdxDeclInfo_field(struct, 2);
 }
 
 /**
  * Get entityInfo field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_entityInfo(struct: CXIdxDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'entityInfo');
+  return addon.get_CXIdxDeclInfo_field(struct, 3);
 }
 
 /**
  * Get flags field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_flags(struct: CXIdxDeclInfo): number {
-  return addon.get_CXIdxDeclInfo_field(struct, 'flags');
+  return addon.get_CXIdxDeclInfo_field(struct, 4);
 }
 
 /**
  * Get isContainer field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_isContainer(struct: CXIdxDeclInfo): number {
-  return addon.get_CXIdxDeclInfo_field(struct, 'isContainer');
+  return addon.get_CXIdxDeclInfo_field(struct, 5);
 }
 
 /**
  * Get isDefinition field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_isDefinition(struct: CXIdxDeclInfo): number {
-  return addon.get_CXIdxDeclInfo_field(struct, 'isDefinition');
+  return addon.get_CXIdxDeclInfo_field(struct, 6);
 }
 
 /**
  * Get isImplicit field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_isImplicit(struct: CXIdxDeclInfo): number {
-  return addon.get_CXIdxDeclInfo_field(struct, 'isImplicit');
+  return addon.get_CXIdxDeclInfo_field(struct, 7);
 }
 
 /**
  * Get isRedeclaration field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_isRedeclaration(struct: CXIdxDeclInfo): number {
-  return addon.get_CXIdxDeclInfo_field(struct, 'isRedeclaration');
+  return addon.get_CXIdxDeclInfo_field(struct, 8);
 }
 
 /**
  * Get lexicalContainer field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_lexicalContainer(struct: CXIdxDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'lexicalContainer');
+  return addon.get_CXIdxDeclInfo_field(struct, 9);
 }
 
 /**
  * Get loc field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_loc(struct: CXIdxDeclInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'loc');
+  return addon.get_CXIdxDeclInfo_field(struct, 10);
 }
 
 /**
  * Get numAttributes field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_numAttributes(struct: CXIdxDeclInfo): number {
-  return addon.get_CXIdxDeclInfo_field(struct, 'numAttributes');
+  return addon.get_CXIdxDeclInfo_field(struct, 11);
 }
 
 /**
  * Get semanticContainer field from CXIdxDeclInfo
  */
 export function getCXIdxDeclInfo_semanticContainer(struct: CXIdxDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxDeclInfo_field(struct, 'semanticContainer');
+  return addon.get_CXIdxDeclInfo_field(struct, 12);
 }
 
 /**
@@ -10833,19 +10849,19 @@ export function getCXIdxDeclInfo_semanticContainer(struct: CXIdxDeclInfo): { _pt
  */
 export function getCXIdxDeclInfoFields(struct: CXIdxDeclInfo): CXIdxDeclInfoInit {
   return {
-    entityInfo: addon.get_CXIdxDeclInfo_field(struct, 'entityInfo'),
-    cursor: addon.get_CXIdxDeclInfo_field(struct, 'cursor'),
-    loc: addon.get_CXIdxDeclInfo_field(struct, 'loc'),
-    semanticContainer: addon.get_CXIdxDeclInfo_field(struct, 'semanticContainer'),
-    lexicalContainer: addon.get_CXIdxDeclInfo_field(struct, 'lexicalContainer'),
-    isRedeclaration: addon.get_CXIdxDeclInfo_field(struct, 'isRedeclaration'),
-    isDefinition: addon.get_CXIdxDeclInfo_field(struct, 'isDefinition'),
-    isContainer: addon.get_CXIdxDeclInfo_field(struct, 'isContainer'),
-    declAsContainer: addon.get_CXIdxDeclInfo_field(struct, 'declAsContainer'),
-    isImplicit: addon.get_CXIdxDeclInfo_field(struct, 'isImplicit'),
-    attributes: addon.get_CXIdxDeclInfo_field(struct, 'attributes'),
-    numAttributes: addon.get_CXIdxDeclInfo_field(struct, 'numAttributes'),
-    flags: addon.get_CXIdxDeclInfo_field(struct, 'flags'),
+    entityInfo: addon.get_CXIdxDeclInfo_field(struct, 3),
+    cursor: addon.get_CXIdxDeclInfo_field(struct, 1),
+    loc: addon.get_CXIdxDeclInfo_field(struct, 10),
+    semanticContainer: addon.get_CXIdxDeclInfo_field(struct, 12),
+    lexicalContainer: addon.get_CXIdxDeclInfo_field(struct, 9),
+    isRedeclaration: addon.get_CXIdxDeclInfo_field(struct, 8),
+    isDefinition: addon.get_CXIdxDeclInfo_field(struct, 6),
+    isContainer: addon.get_CXIdxDeclInfo_field(struct, 5),
+    declAsContainer: addon.get_CXIdxDeclInfo_field(struct, 2),
+    isImplicit: addon.get_CXIdxDeclInfo_field(struct, 7),
+    attributes: addon.get_CXIdxDeclInfo_field(struct, 0),
+    numAttributes: addon.get_CXIdxDeclInfo_field(struct, 11),
+    flags: addon.get_CXIdxDeclInfo_field(struct, 4),
   };
 }
 
@@ -10857,56 +10873,56 @@ export function createCXIdxEntityInfo(init?: CXIdxEntityInfoInit): CXIdxEntityIn
  * Get attributes field from CXIdxEntityInfo
  */
 export function getCXIdxEntityInfo_attributes(struct: CXIdxEntityInfo): { _ptr: unknown } {
-  return addon.get_CXIdxEntityInfo_field(struct, 'attributes');
+  return addon.get_CXIdxEntityInfo_field(struct, 0);
 }
 
 /**
  * Get cursor field from CXIdxEntityInfo
  */
 export function getCXIdxEntityInfo_cursor(struct: CXIdxEntityInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxEntityInfo_field(struct, 'cursor');
+  return addon.get_CXIdxEntityInfo_field(struct, 1);
 }
 
 /**
  * Get kind field from CXIdxEntityInfo
  */
-export function getCXIdxEntityInfo_kind(struct: CXIdxEntityInfo): { _type: 'CXIdxEntityKind' } {
-  return addon.get_CXIdxEntityInfo_field(struct, 'kind');
+export function getCXIdxEntityInfo_kind(struct: CXIdxEntityInfo): number {
+  return addon.get_CXIdxEntityInfo_field(struct, 2);
 }
 
 /**
  * Get lang field from CXIdxEntityInfo
  */
-export function getCXIdxEntityInfo_lang(struct: CXIdxEntityInfo): { _type: 'CXIdxEntityLanguage' } {
-  return addon.get_CXIdxEntityInfo_field(struct, 'lang');
+export function getCXIdxEntityInfo_lang(struct: CXIdxEntityInfo): number {
+  return addon.get_CXIdxEntityInfo_field(struct, 3);
 }
 
 /**
  * Get name field from CXIdxEntityInfo
  */
 export function getCXIdxEntityInfo_name(struct: CXIdxEntityInfo): string {
-  return addon.get_CXIdxEntityInfo_field(struct, 'name');
+  return addon.get_CXIdxEntityInfo_field(struct, 4);
 }
 
 /**
  * Get numAttributes field from CXIdxEntityInfo
  */
 export function getCXIdxEntityInfo_numAttributes(struct: CXIdxEntityInfo): number {
-  return addon.get_CXIdxEntityInfo_field(struct, 'numAttributes');
+  return addon.get_CXIdxEntityInfo_field(struct, 5);
 }
 
 /**
  * Get templateKind field from CXIdxEntityInfo
  */
-export function getCXIdxEntityInfo_templateKind(struct: CXIdxEntityInfo): { _type: 'CXIdxEntityCXXTemplateKind' } {
-  return addon.get_CXIdxEntityInfo_field(struct, 'templateKind');
+export function getCXIdxEntityInfo_templateKind(struct: CXIdxEntityInfo): number {
+  return addon.get_CXIdxEntityInfo_field(struct, 6);
 }
 
 /**
  * Get USR field from CXIdxEntityInfo
  */
 export function getCXIdxEntityInfo_USR(struct: CXIdxEntityInfo): string {
-  return addon.get_CXIdxEntityInfo_field(struct, 'USR');
+  return addon.get_CXIdxEntityInfo_field(struct, 7);
 }
 
 /**
@@ -10914,14 +10930,14 @@ export function getCXIdxEntityInfo_USR(struct: CXIdxEntityInfo): string {
  */
 export function getCXIdxEntityInfoFields(struct: CXIdxEntityInfo): CXIdxEntityInfoInit {
   return {
-    kind: addon.get_CXIdxEntityInfo_field(struct, 'kind'),
-    templateKind: addon.get_CXIdxEntityInfo_field(struct, 'templateKind'),
-    lang: addon.get_CXIdxEntityInfo_field(struct, 'lang'),
-    name: addon.get_CXIdxEntityInfo_field(struct, 'name'),
-    USR: addon.get_CXIdxEntityInfo_field(struct, 'USR'),
-    cursor: addon.get_CXIdxEntityInfo_field(struct, 'cursor'),
-    attributes: addon.get_CXIdxEntityInfo_field(struct, 'attributes'),
-    numAttributes: addon.get_CXIdxEntityInfo_field(struct, 'numAttributes'),
+    kind: addon.get_CXIdxEntityInfo_field(struct, 2),
+    templateKind: addon.get_CXIdxEntityInfo_field(struct, 6),
+    lang: addon.get_CXIdxEntityInfo_field(struct, 3),
+    name: addon.get_CXIdxEntityInfo_field(struct, 4),
+    USR: addon.get_CXIdxEntityInfo_field(struct, 7),
+    cursor: addon.get_CXIdxEntityInfo_field(struct, 1),
+    attributes: addon.get_CXIdxEntityInfo_field(struct, 0),
+    numAttributes: addon.get_CXIdxEntityInfo_field(struct, 5),
   };
 }
 
@@ -10937,49 +10953,49 @@ export function createCXIdxEntityRefInfo(init?: CXIdxEntityRefInfoInit): CXIdxEn
  * Get container field from CXIdxEntityRefInfo
  */
 export function getCXIdxEntityRefInfo_container(struct: CXIdxEntityRefInfo): { _ptr: unknown } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'container');
+  return addon.get_CXIdxEntityRefInfo_field(struct, 0);
 }
 
 /**
  * Get cursor field from CXIdxEntityRefInfo
  */
 export function getCXIdxEntityRefInfo_cursor(struct: CXIdxEntityRefInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'cursor');
+  return addon.get_CXIdxEntityRefInfo_field(struct, 1);
 }
 
 /**
  * Get kind field from CXIdxEntityRefInfo
  */
-export function getCXIdxEntityRefInfo_kind(struct: CXIdxEntityRefInfo): { _type: 'CXIdxEntityRefKind' } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'kind');
+export function getCXIdxEntityRefInfo_kind(struct: CXIdxEntityRefInfo): number {
+  return addon.get_CXIdxEntityRefInfo_field(struct, 2);
 }
 
 /**
  * Get loc field from CXIdxEntityRefInfo
  */
 export function getCXIdxEntityRefInfo_loc(struct: CXIdxEntityRefInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'loc');
+  return addon.get_CXIdxEntityRefInfo_field(struct, 3);
 }
 
 /**
  * Get parentEntity field from CXIdxEntityRefInfo
  */
 export function getCXIdxEntityRefInfo_parentEntity(struct: CXIdxEntityRefInfo): { _ptr: unknown } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'parentEntity');
+  return addon.get_CXIdxEntityRefInfo_field(struct, 4);
 }
 
 /**
  * Get referencedEntity field from CXIdxEntityRefInfo
  */
 export function getCXIdxEntityRefInfo_referencedEntity(struct: CXIdxEntityRefInfo): { _ptr: unknown } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'referencedEntity');
+  return addon.get_CXIdxEntityRefInfo_field(struct, 5);
 }
 
 /**
  * Get role field from CXIdxEntityRefInfo
  */
-export function getCXIdxEntityRefInfo_role(struct: CXIdxEntityRefInfo): { _type: 'CXSymbolRole' } {
-  return addon.get_CXIdxEntityRefInfo_field(struct, 'role');
+export function getCXIdxEntityRefInfo_role(struct: CXIdxEntityRefInfo): number {
+  return addon.get_CXIdxEntityRefInfo_field(struct, 6);
 }
 
 /**
@@ -10987,13 +11003,13 @@ export function getCXIdxEntityRefInfo_role(struct: CXIdxEntityRefInfo): { _type:
  */
 export function getCXIdxEntityRefInfoFields(struct: CXIdxEntityRefInfo): CXIdxEntityRefInfoInit {
   return {
-    kind: addon.get_CXIdxEntityRefInfo_field(struct, 'kind'),
-    cursor: addon.get_CXIdxEntityRefInfo_field(struct, 'cursor'),
-    loc: addon.get_CXIdxEntityRefInfo_field(struct, 'loc'),
-    referencedEntity: addon.get_CXIdxEntityRefInfo_field(struct, 'referencedEntity'),
-    parentEntity: addon.get_CXIdxEntityRefInfo_field(struct, 'parentEntity'),
-    container: addon.get_CXIdxEntityRefInfo_field(struct, 'container'),
-    role: addon.get_CXIdxEntityRefInfo_field(struct, 'role'),
+    kind: addon.get_CXIdxEntityRefInfo_field(struct, 2),
+    cursor: addon.get_CXIdxEntityRefInfo_field(struct, 1),
+    loc: addon.get_CXIdxEntityRefInfo_field(struct, 3),
+    referencedEntity: addon.get_CXIdxEntityRefInfo_field(struct, 5),
+    parentEntity: addon.get_CXIdxEntityRefInfo_field(struct, 4),
+    container: addon.get_CXIdxEntityRefInfo_field(struct, 0),
+    role: addon.get_CXIdxEntityRefInfo_field(struct, 6),
   };
 }
 
@@ -11005,28 +11021,28 @@ export function createCXIdxIBOutletCollectionAttrInfo(init?: CXIdxIBOutletCollec
  * Get attrInfo field from CXIdxIBOutletCollectionAttrInfo
  */
 export function getCXIdxIBOutletCollectionAttrInfo_attrInfo(struct: CXIdxIBOutletCollectionAttrInfo): { _ptr: unknown } {
-  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'attrInfo');
+  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 0);
 }
 
 /**
  * Get classCursor field from CXIdxIBOutletCollectionAttrInfo
  */
 export function getCXIdxIBOutletCollectionAttrInfo_classCursor(struct: CXIdxIBOutletCollectionAttrInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'classCursor');
+  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 1);
 }
 
 /**
  * Get classLoc field from CXIdxIBOutletCollectionAttrInfo
  */
 export function getCXIdxIBOutletCollectionAttrInfo_classLoc(struct: CXIdxIBOutletCollectionAttrInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'classLoc');
+  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 2);
 }
 
 /**
  * Get objcClass field from CXIdxIBOutletCollectionAttrInfo
  */
 export function getCXIdxIBOutletCollectionAttrInfo_objcClass(struct: CXIdxIBOutletCollectionAttrInfo): { _ptr: unknown } {
-  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'objcClass');
+  return addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 3);
 }
 
 /**
@@ -11034,10 +11050,10 @@ export function getCXIdxIBOutletCollectionAttrInfo_objcClass(struct: CXIdxIBOutl
  */
 export function getCXIdxIBOutletCollectionAttrInfoFields(struct: CXIdxIBOutletCollectionAttrInfo): CXIdxIBOutletCollectionAttrInfoInit {
   return {
-    attrInfo: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'attrInfo'),
-    objcClass: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'objcClass'),
-    classCursor: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'classCursor'),
-    classLoc: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 'classLoc'),
+    attrInfo: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 0),
+    objcClass: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 3),
+    classCursor: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 1),
+    classLoc: addon.get_CXIdxIBOutletCollectionAttrInfo_field(struct, 2),
   };
 }
 
@@ -11053,28 +11069,28 @@ export function createCXIdxImportedASTFileInfo(init?: CXIdxImportedASTFileInfoIn
  * Get file field from CXIdxImportedASTFileInfo
  */
 export function getCXIdxImportedASTFileInfo_file(struct: CXIdxImportedASTFileInfo): { _type: 'CXFile' } {
-  return addon.get_CXIdxImportedASTFileInfo_field(struct, 'file');
+  return addon.get_CXIdxImportedASTFileInfo_field(struct, 0);
 }
 
 /**
  * Get isImplicit field from CXIdxImportedASTFileInfo
  */
 export function getCXIdxImportedASTFileInfo_isImplicit(struct: CXIdxImportedASTFileInfo): number {
-  return addon.get_CXIdxImportedASTFileInfo_field(struct, 'isImplicit');
+  return addon.get_CXIdxImportedASTFileInfo_field(struct, 1);
 }
 
 /**
  * Get loc field from CXIdxImportedASTFileInfo
  */
 export function getCXIdxImportedASTFileInfo_loc(struct: CXIdxImportedASTFileInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxImportedASTFileInfo_field(struct, 'loc');
+  return addon.get_CXIdxImportedASTFileInfo_field(struct, 2);
 }
 
 /**
  * Get module field from CXIdxImportedASTFileInfo
  */
 export function getCXIdxImportedASTFileInfo_module(struct: CXIdxImportedASTFileInfo): { _type: 'CXModule' } {
-  return addon.get_CXIdxImportedASTFileInfo_field(struct, 'module');
+  return addon.get_CXIdxImportedASTFileInfo_field(struct, 3);
 }
 
 /**
@@ -11082,10 +11098,10 @@ export function getCXIdxImportedASTFileInfo_module(struct: CXIdxImportedASTFileI
  */
 export function getCXIdxImportedASTFileInfoFields(struct: CXIdxImportedASTFileInfo): CXIdxImportedASTFileInfoInit {
   return {
-    file: addon.get_CXIdxImportedASTFileInfo_field(struct, 'file'),
-    module: addon.get_CXIdxImportedASTFileInfo_field(struct, 'module'),
-    loc: addon.get_CXIdxImportedASTFileInfo_field(struct, 'loc'),
-    isImplicit: addon.get_CXIdxImportedASTFileInfo_field(struct, 'isImplicit'),
+    file: addon.get_CXIdxImportedASTFileInfo_field(struct, 0),
+    module: addon.get_CXIdxImportedASTFileInfo_field(struct, 3),
+    loc: addon.get_CXIdxImportedASTFileInfo_field(struct, 2),
+    isImplicit: addon.get_CXIdxImportedASTFileInfo_field(struct, 1),
   };
 }
 
@@ -11101,42 +11117,42 @@ export function createCXIdxIncludedFileInfo(init?: CXIdxIncludedFileInfoInit): C
  * Get file field from CXIdxIncludedFileInfo
  */
 export function getCXIdxIncludedFileInfo_file(struct: CXIdxIncludedFileInfo): { _type: 'CXFile' } {
-  return addon.get_CXIdxIncludedFileInfo_field(struct, 'file');
+  return addon.get_CXIdxIncludedFileInfo_field(struct, 0);
 }
 
 /**
  * Get filename field from CXIdxIncludedFileInfo
  */
 export function getCXIdxIncludedFileInfo_filename(struct: CXIdxIncludedFileInfo): string {
-  return addon.get_CXIdxIncludedFileInfo_field(struct, 'filename');
+  return addon.get_CXIdxIncludedFileInfo_field(struct, 1);
 }
 
 /**
  * Get hashLoc field from CXIdxIncludedFileInfo
  */
 export function getCXIdxIncludedFileInfo_hashLoc(struct: CXIdxIncludedFileInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxIncludedFileInfo_field(struct, 'hashLoc');
+  return addon.get_CXIdxIncludedFileInfo_field(struct, 2);
 }
 
 /**
  * Get isAngled field from CXIdxIncludedFileInfo
  */
 export function getCXIdxIncludedFileInfo_isAngled(struct: CXIdxIncludedFileInfo): number {
-  return addon.get_CXIdxIncludedFileInfo_field(struct, 'isAngled');
+  return addon.get_CXIdxIncludedFileInfo_field(struct, 3);
 }
 
 /**
  * Get isImport field from CXIdxIncludedFileInfo
  */
 export function getCXIdxIncludedFileInfo_isImport(struct: CXIdxIncludedFileInfo): number {
-  return addon.get_CXIdxIncludedFileInfo_field(struct, 'isImport');
+  return addon.get_CXIdxIncludedFileInfo_field(struct, 4);
 }
 
 /**
  * Get isModuleImport field from CXIdxIncludedFileInfo
  */
 export function getCXIdxIncludedFileInfo_isModuleImport(struct: CXIdxIncludedFileInfo): number {
-  return addon.get_CXIdxIncludedFileInfo_field(struct, 'isModuleImport');
+  return addon.get_CXIdxIncludedFileInfo_field(struct, 5);
 }
 
 /**
@@ -11144,12 +11160,12 @@ export function getCXIdxIncludedFileInfo_isModuleImport(struct: CXIdxIncludedFil
  */
 export function getCXIdxIncludedFileInfoFields(struct: CXIdxIncludedFileInfo): CXIdxIncludedFileInfoInit {
   return {
-    hashLoc: addon.get_CXIdxIncludedFileInfo_field(struct, 'hashLoc'),
-    filename: addon.get_CXIdxIncludedFileInfo_field(struct, 'filename'),
-    file: addon.get_CXIdxIncludedFileInfo_field(struct, 'file'),
-    isImport: addon.get_CXIdxIncludedFileInfo_field(struct, 'isImport'),
-    isAngled: addon.get_CXIdxIncludedFileInfo_field(struct, 'isAngled'),
-    isModuleImport: addon.get_CXIdxIncludedFileInfo_field(struct, 'isModuleImport'),
+    hashLoc: addon.get_CXIdxIncludedFileInfo_field(struct, 2),
+    filename: addon.get_CXIdxIncludedFileInfo_field(struct, 1),
+    file: addon.get_CXIdxIncludedFileInfo_field(struct, 0),
+    isImport: addon.get_CXIdxIncludedFileInfo_field(struct, 4),
+    isAngled: addon.get_CXIdxIncludedFileInfo_field(struct, 3),
+    isModuleImport: addon.get_CXIdxIncludedFileInfo_field(struct, 5),
   };
 }
 
@@ -11165,14 +11181,14 @@ export function createCXIdxLoc(init?: CXIdxLocInit): CXIdxLoc {
  * Get int_data field from CXIdxLoc
  */
 export function getCXIdxLoc_int_data(struct: CXIdxLoc): number {
-  return addon.get_CXIdxLoc_field(struct, 'int_data');
+  return addon.get_CXIdxLoc_field(struct, 0);
 }
 
 /**
  * Get ptr_data field from CXIdxLoc
  */
 export function getCXIdxLoc_ptr_data(struct: CXIdxLoc): unknown[] {
-  return addon.get_CXIdxLoc_field(struct, 'ptr_data');
+  return addon.get_CXIdxLoc_field(struct, 1);
 }
 
 /**
@@ -11180,8 +11196,8 @@ export function getCXIdxLoc_ptr_data(struct: CXIdxLoc): unknown[] {
  */
 export function getCXIdxLocFields(struct: CXIdxLoc): CXIdxLocInit {
   return {
-    ptr_data: addon.get_CXIdxLoc_field(struct, 'ptr_data'),
-    int_data: addon.get_CXIdxLoc_field(struct, 'int_data'),
+    ptr_data: addon.get_CXIdxLoc_field(struct, 1),
+    int_data: addon.get_CXIdxLoc_field(struct, 0),
   };
 }
 
@@ -11193,35 +11209,35 @@ export function createCXIdxObjCCategoryDeclInfo(init?: CXIdxObjCCategoryDeclInfo
  * Get classCursor field from CXIdxObjCCategoryDeclInfo
  */
 export function getCXIdxObjCCategoryDeclInfo_classCursor(struct: CXIdxObjCCategoryDeclInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'classCursor');
+  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 0);
 }
 
 /**
  * Get classLoc field from CXIdxObjCCategoryDeclInfo
  */
 export function getCXIdxObjCCategoryDeclInfo_classLoc(struct: CXIdxObjCCategoryDeclInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'classLoc');
+  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 1);
 }
 
 /**
  * Get containerInfo field from CXIdxObjCCategoryDeclInfo
  */
 export function getCXIdxObjCCategoryDeclInfo_containerInfo(struct: CXIdxObjCCategoryDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'containerInfo');
+  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 2);
 }
 
 /**
  * Get objcClass field from CXIdxObjCCategoryDeclInfo
  */
 export function getCXIdxObjCCategoryDeclInfo_objcClass(struct: CXIdxObjCCategoryDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'objcClass');
+  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 3);
 }
 
 /**
  * Get protocols field from CXIdxObjCCategoryDeclInfo
  */
 export function getCXIdxObjCCategoryDeclInfo_protocols(struct: CXIdxObjCCategoryDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'protocols');
+  return addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 4);
 }
 
 /**
@@ -11229,11 +11245,11 @@ export function getCXIdxObjCCategoryDeclInfo_protocols(struct: CXIdxObjCCategory
  */
 export function getCXIdxObjCCategoryDeclInfoFields(struct: CXIdxObjCCategoryDeclInfo): CXIdxObjCCategoryDeclInfoInit {
   return {
-    containerInfo: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'containerInfo'),
-    objcClass: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'objcClass'),
-    classCursor: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'classCursor'),
-    classLoc: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'classLoc'),
-    protocols: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 'protocols'),
+    containerInfo: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 2),
+    objcClass: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 3),
+    classCursor: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 0),
+    classLoc: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 1),
+    protocols: addon.get_CXIdxObjCCategoryDeclInfo_field(struct, 4),
   };
 }
 
@@ -11245,14 +11261,14 @@ export function createCXIdxObjCContainerDeclInfo(init?: CXIdxObjCContainerDeclIn
  * Get declInfo field from CXIdxObjCContainerDeclInfo
  */
 export function getCXIdxObjCContainerDeclInfo_declInfo(struct: CXIdxObjCContainerDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCContainerDeclInfo_field(struct, 'declInfo');
+  return addon.get_CXIdxObjCContainerDeclInfo_field(struct, 0);
 }
 
 /**
  * Get kind field from CXIdxObjCContainerDeclInfo
  */
-export function getCXIdxObjCContainerDeclInfo_kind(struct: CXIdxObjCContainerDeclInfo): { _type: 'CXIdxObjCContainerKind' } {
-  return addon.get_CXIdxObjCContainerDeclInfo_field(struct, 'kind');
+export function getCXIdxObjCContainerDeclInfo_kind(struct: CXIdxObjCContainerDeclInfo): number {
+  return addon.get_CXIdxObjCContainerDeclInfo_field(struct, 1);
 }
 
 /**
@@ -11260,8 +11276,8 @@ export function getCXIdxObjCContainerDeclInfo_kind(struct: CXIdxObjCContainerDec
  */
 export function getCXIdxObjCContainerDeclInfoFields(struct: CXIdxObjCContainerDeclInfo): CXIdxObjCContainerDeclInfoInit {
   return {
-    declInfo: addon.get_CXIdxObjCContainerDeclInfo_field(struct, 'declInfo'),
-    kind: addon.get_CXIdxObjCContainerDeclInfo_field(struct, 'kind'),
+    declInfo: addon.get_CXIdxObjCContainerDeclInfo_field(struct, 0),
+    kind: addon.get_CXIdxObjCContainerDeclInfo_field(struct, 1),
   };
 }
 
@@ -11273,21 +11289,21 @@ export function createCXIdxObjCInterfaceDeclInfo(init?: CXIdxObjCInterfaceDeclIn
  * Get containerInfo field from CXIdxObjCInterfaceDeclInfo
  */
 export function getCXIdxObjCInterfaceDeclInfo_containerInfo(struct: CXIdxObjCInterfaceDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 'containerInfo');
+  return addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 0);
 }
 
 /**
  * Get protocols field from CXIdxObjCInterfaceDeclInfo
  */
 export function getCXIdxObjCInterfaceDeclInfo_protocols(struct: CXIdxObjCInterfaceDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 'protocols');
+  return addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 1);
 }
 
 /**
  * Get superInfo field from CXIdxObjCInterfaceDeclInfo
  */
 export function getCXIdxObjCInterfaceDeclInfo_superInfo(struct: CXIdxObjCInterfaceDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 'superInfo');
+  return addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 2);
 }
 
 /**
@@ -11295,9 +11311,9 @@ export function getCXIdxObjCInterfaceDeclInfo_superInfo(struct: CXIdxObjCInterfa
  */
 export function getCXIdxObjCInterfaceDeclInfoFields(struct: CXIdxObjCInterfaceDeclInfo): CXIdxObjCInterfaceDeclInfoInit {
   return {
-    containerInfo: addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 'containerInfo'),
-    superInfo: addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 'superInfo'),
-    protocols: addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 'protocols'),
+    containerInfo: addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 0),
+    superInfo: addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 2),
+    protocols: addon.get_CXIdxObjCInterfaceDeclInfo_field(struct, 1),
   };
 }
 
@@ -11309,21 +11325,21 @@ export function createCXIdxObjCPropertyDeclInfo(init?: CXIdxObjCPropertyDeclInfo
  * Get declInfo field from CXIdxObjCPropertyDeclInfo
  */
 export function getCXIdxObjCPropertyDeclInfo_declInfo(struct: CXIdxObjCPropertyDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 'declInfo');
+  return addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 0);
 }
 
 /**
  * Get getter field from CXIdxObjCPropertyDeclInfo
  */
 export function getCXIdxObjCPropertyDeclInfo_getter(struct: CXIdxObjCPropertyDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 'getter');
+  return addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 1);
 }
 
 /**
  * Get setter field from CXIdxObjCPropertyDeclInfo
  */
 export function getCXIdxObjCPropertyDeclInfo_setter(struct: CXIdxObjCPropertyDeclInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 'setter');
+  return addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 2);
 }
 
 /**
@@ -11331,9 +11347,9 @@ export function getCXIdxObjCPropertyDeclInfo_setter(struct: CXIdxObjCPropertyDec
  */
 export function getCXIdxObjCPropertyDeclInfoFields(struct: CXIdxObjCPropertyDeclInfo): CXIdxObjCPropertyDeclInfoInit {
   return {
-    declInfo: addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 'declInfo'),
-    getter: addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 'getter'),
-    setter: addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 'setter'),
+    declInfo: addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 0),
+    getter: addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 1),
+    setter: addon.get_CXIdxObjCPropertyDeclInfo_field(struct, 2),
   };
 }
 
@@ -11345,21 +11361,21 @@ export function createCXIdxObjCProtocolRefInfo(init?: CXIdxObjCProtocolRefInfoIn
  * Get cursor field from CXIdxObjCProtocolRefInfo
  */
 export function getCXIdxObjCProtocolRefInfo_cursor(struct: CXIdxObjCProtocolRefInfo): { _type: 'CXCursor' } {
-  return addon.get_CXIdxObjCProtocolRefInfo_field(struct, 'cursor');
+  return addon.get_CXIdxObjCProtocolRefInfo_field(struct, 0);
 }
 
 /**
  * Get loc field from CXIdxObjCProtocolRefInfo
  */
 export function getCXIdxObjCProtocolRefInfo_loc(struct: CXIdxObjCProtocolRefInfo): { _type: 'CXIdxLoc' } {
-  return addon.get_CXIdxObjCProtocolRefInfo_field(struct, 'loc');
+  return addon.get_CXIdxObjCProtocolRefInfo_field(struct, 1);
 }
 
 /**
  * Get protocol field from CXIdxObjCProtocolRefInfo
  */
 export function getCXIdxObjCProtocolRefInfo_protocol(struct: CXIdxObjCProtocolRefInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCProtocolRefInfo_field(struct, 'protocol');
+  return addon.get_CXIdxObjCProtocolRefInfo_field(struct, 2);
 }
 
 /**
@@ -11367,9 +11383,9 @@ export function getCXIdxObjCProtocolRefInfo_protocol(struct: CXIdxObjCProtocolRe
  */
 export function getCXIdxObjCProtocolRefInfoFields(struct: CXIdxObjCProtocolRefInfo): CXIdxObjCProtocolRefInfoInit {
   return {
-    protocol: addon.get_CXIdxObjCProtocolRefInfo_field(struct, 'protocol'),
-    cursor: addon.get_CXIdxObjCProtocolRefInfo_field(struct, 'cursor'),
-    loc: addon.get_CXIdxObjCProtocolRefInfo_field(struct, 'loc'),
+    protocol: addon.get_CXIdxObjCProtocolRefInfo_field(struct, 2),
+    cursor: addon.get_CXIdxObjCProtocolRefInfo_field(struct, 0),
+    loc: addon.get_CXIdxObjCProtocolRefInfo_field(struct, 1),
   };
 }
 
@@ -11381,14 +11397,14 @@ export function createCXIdxObjCProtocolRefListInfo(init?: CXIdxObjCProtocolRefLi
  * Get numProtocols field from CXIdxObjCProtocolRefListInfo
  */
 export function getCXIdxObjCProtocolRefListInfo_numProtocols(struct: CXIdxObjCProtocolRefListInfo): number {
-  return addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 'numProtocols');
+  return addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 0);
 }
 
 /**
  * Get protocols field from CXIdxObjCProtocolRefListInfo
  */
 export function getCXIdxObjCProtocolRefListInfo_protocols(struct: CXIdxObjCProtocolRefListInfo): { _ptr: unknown } {
-  return addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 'protocols');
+  return addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 1);
 }
 
 /**
@@ -11396,8 +11412,8 @@ export function getCXIdxObjCProtocolRefListInfo_protocols(struct: CXIdxObjCProto
  */
 export function getCXIdxObjCProtocolRefListInfoFields(struct: CXIdxObjCProtocolRefListInfo): CXIdxObjCProtocolRefListInfoInit {
   return {
-    protocols: addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 'protocols'),
-    numProtocols: addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 'numProtocols'),
+    protocols: addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 1),
+    numProtocols: addon.get_CXIdxObjCProtocolRefListInfo_field(struct, 0),
   };
 }
 
@@ -11431,56 +11447,56 @@ export function createCXIndexOptions(init?: CXIndexOptionsInit): CXIndexOptions
  * Get DisplayDiagnostics field from CXIndexOptions
  */
 export function getCXIndexOptions_DisplayDiagnostics(struct: CXIndexOptions): number {
-  return addon.get_CXIndexOptions_field(struct, 'DisplayDiagnostics');
+  return addon.get_CXIndexOptions_field(struct, 0);
 }
 
 /**
  * Get ExcludeDeclarationsFromPCH field from CXIndexOptions
  */
 export function getCXIndexOptions_ExcludeDeclarationsFromPCH(struct: CXIndexOptions): number {
-  return addon.get_CXIndexOptions_field(struct, 'ExcludeDeclarationsFromPCH');
+  return addon.get_CXIndexOptions_field(struct, 1);
 }
 
 /**
  * Get InvocationEmissionPath field from CXIndexOptions
  */
 export function getCXIndexOptions_InvocationEmissionPath(struct: CXIndexOptions): string {
-  return addon.get_CXIndexOptions_field(struct, 'InvocationEmissionPath');
+  return addon.get_CXIndexOptions_field(struct, 2);
 }
 
 /**
  * Get PreambleStoragePath field from CXIndexOptions
  */
 export function getCXIndexOptions_PreambleStoragePath(struct: CXIndexOptions): string {
-  return addon.get_CXIndexOptions_field(struct, 'PreambleStoragePath');
+  return addon.get_CXIndexOptions_field(struct, 3);
 }
 
 /**
  * Get Size field from CXIndexOptions
  */
 export function getCXIndexOptions_Size(struct: CXIndexOptions): number {
-  return addon.get_CXIndexOptions_field(struct, 'Size');
+  return addon.get_CXIndexOptions_field(struct, 4);
 }
 
 /**
  * Get StorePreamblesInMemory field from CXIndexOptions
  */
 export function getCXIndexOptions_StorePreamblesInMemory(struct: CXIndexOptions): number {
-  return addon.get_CXIndexOptions_field(struct, 'StorePreamblesInMemory');
+  return addon.get_CXIndexOptions_field(struct, 5);
 }
 
 /**
  * Get ThreadBackgroundPriorityForEditing field from CXIndexOptions
  */
 export function getCXIndexOptions_ThreadBackgroundPriorityForEditing(struct: CXIndexOptions): number {
-  return addon.get_CXIndexOptions_field(struct, 'ThreadBackgroundPriorityForEditing');
+  return addon.get_CXIndexOptions_field(struct, 6);
 }
 
 /**
  * Get ThreadBackgroundPriorityForIndexing field from CXIndexOptions
  */
 export function getCXIndexOptions_ThreadBackgroundPriorityForIndexing(struct: CXIndexOptions): number {
-  return addon.get_CXIndexOptions_field(struct, 'ThreadBackgroundPriorityForIndexing');
+  return addon.get_CXIndexOptions_field(struct, 7);
 }
 
 /**
@@ -11488,14 +11504,14 @@ export function getCXIndexOptions_ThreadBackgroundPriorityForIndexing(struct: CX
  */
 export function getCXIndexOptionsFields(struct: CXIndexOptions): CXIndexOptionsInit {
   return {
-    Size: addon.get_CXIndexOptions_field(struct, 'Size'),
-    ThreadBackgroundPriorityForIndexing: addon.get_CXIndexOptions_field(struct, 'ThreadBackgroundPriorityForIndexing'),
-    ThreadBackgroundPriorityForEditing: addon.get_CXIndexOptions_field(struct, 'ThreadBackgroundPriorityForEditing'),
-    ExcludeDeclarationsFromPCH: addon.get_CXIndexOptions_field(struct, 'ExcludeDeclarationsFromPCH'),
-    DisplayDiagnostics: addon.get_CXIndexOptions_field(struct, 'DisplayDiagnostics'),
-    StorePreamblesInMemory: addon.get_CXIndexOptions_field(struct, 'StorePreamblesInMemory'),
-    PreambleStoragePath: addon.get_CXIndexOptions_field(struct, 'PreambleStoragePath'),
-    InvocationEmissionPath: addon.get_CXIndexOptions_field(struct, 'InvocationEmissionPath'),
+    Size: addon.get_CXIndexOptions_field(struct, 4),
+    ThreadBackgroundPriorityForIndexing: addon.get_CXIndexOptions_field(struct, 7),
+    ThreadBackgroundPriorityForEditing: addon.get_CXIndexOptions_field(struct, 6),
+    ExcludeDeclarationsFromPCH: addon.get_CXIndexOptions_field(struct, 1),
+    DisplayDiagnostics: addon.get_CXIndexOptions_field(struct, 0),
+    StorePreamblesInMemory: addon.get_CXIndexOptions_field(struct, 5),
+    PreambleStoragePath: addon.get_CXIndexOptions_field(struct, 3),
+    InvocationEmissionPath: addon.get_CXIndexOptions_field(struct, 2),
   };
 }
 
@@ -11523,43 +11539,43 @@ export function createCXPlatformAvailability(init?: CXPlatformAvailabilityInit):
 /**
  * Get Deprecated field from CXPlatformAvailability
  */
-export function getCXPlatformAvailability_Deprecated(struct: CXPlatformAvailability): { _type: 'CXVersion' } {
-  return addon.get_CXPlatformAvailability_field(struct, 'Deprecated');
+export function getCXPlatformAvailability_Deprecated(struct: CXPlatformAvailability): CXVersion {
+  return addon.get_CXPlatformAvailability_field(struct, 0);
 }
 
 /**
  * Get Introduced field from CXPlatformAvailability
  */
-export function getCXPlatformAvailability_Introduced(struct: CXPlatformAvailability): { _type: 'CXVersion' } {
-  return addon.get_CXPlatformAvailability_field(struct, 'Introduced');
+export function getCXPlatformAvailability_Introduced(struct: CXPlatformAvailability): CXVersion {
+  return addon.get_CXPlatformAvailability_field(struct, 1);
 }
 
 /**
  * Get Message field from CXPlatformAvailability
  */
 export function getCXPlatformAvailability_Message(struct: CXPlatformAvailability): { _type: 'CXString' } {
-  return addon.get_CXPlatformAvailability_field(struct, 'Message');
+  return addon.get_CXPlatformAvailability_field(struct, 2);
 }
 
 /**
  * Get Obsoleted field from CXPlatformAvailability
  */
-export function getCXPlatformAvailability_Obsoleted(struct: CXPlatformAvailability): { _type: 'CXVersion' } {
-  return addon.get_CXPlatformAvailability_field(struct, 'Obsoleted');
+export function getCXPlatformAvailability_Obsoleted(struct: CXPlatformAvailability): CXVersion {
+  return addon.get_CXPlatformAvailability_field(struct, 3);
 }
 
 /**
  * Get Platform field from CXPlatformAvailability
  */
 export function getCXPlatformAvailability_Platform(struct: CXPlatformAvailability): { _type: 'CXString' } {
-  return addon.get_CXPlatformAvailability_field(struct, 'Platform');
+  return addon.get_CXPlatformAvailability_field(struct, 4);
 }
 
 /**
  * Get Unavailable field from CXPlatformAvailability
  */
 export function getCXPlatformAvailability_Unavailable(struct: CXPlatformAvailability): number {
-  return addon.get_CXPlatformAvailability_field(struct, 'Unavailable');
+  return addon.get_CXPlatformAvailability_field(struct, 5);
 }
 
 /**
@@ -11567,12 +11583,12 @@ export function getCXPlatformAvailability_Unavailable(struct: CXPlatformAvailabi
  */
 export function getCXPlatformAvailabilityFields(struct: CXPlatformAvailability): CXPlatformAvailabilityInit {
   return {
-    Platform: addon.get_CXPlatformAvailability_field(struct, 'Platform'),
-    Introduced: addon.get_CXPlatformAvailability_field(struct, 'Introduced'),
-    Deprecated: addon.get_CXPlatformAvailability_field(struct, 'Deprecated'),
-    Obsoleted: addon.get_CXPlatformAvailability_field(struct, 'Obsoleted'),
-    Unavailable: addon.get_CXPlatformAvailability_field(struct, 'Unavailable'),
-    Message: addon.get_CXPlatformAvailability_field(struct, 'Message'),
+    Platform: addon.get_CXPlatformAvailability_field(struct, 4),
+    Introduced: addon.get_CXPlatformAvailability_field(struct, 1),
+    Deprecated: addon.get_CXPlatformAvailability_field(struct, 0),
+    Obsoleted: addon.get_CXPlatformAvailability_field(struct, 3),
+    Unavailable: addon.get_CXPlatformAvailability_field(struct, 5),
+    Message: addon.get_CXPlatformAvailability_field(struct, 2),
   };
 }
 
@@ -11592,14 +11608,14 @@ export function createCXSourceLocation(init?: CXSourceLocationInit): CXSourceLoc
  * Get int_data field from CXSourceLocation
  */
 export function getCXSourceLocation_int_data(struct: CXSourceLocation): number {
-  return addon.get_CXSourceLocation_field(struct, 'int_data');
+  return addon.get_CXSourceLocation_field(struct, 0);
 }
 
 /**
  * Get ptr_data field from CXSourceLocation
  */
 export function getCXSourceLocation_ptr_data(struct: CXSourceLocation): unknown[] {
-  return addon.get_CXSourceLocation_field(struct, 'ptr_data');
+  return addon.get_CXSourceLocation_field(struct, 1);
 }
 
 /**
@@ -11607,8 +11623,8 @@ export function getCXSourceLocation_ptr_data(struct: CXSourceLocation): unknown[
  */
 export function getCXSourceLocationFields(struct: CXSourceLocation): CXSourceLocationInit {
   return {
-    ptr_data: addon.get_CXSourceLocation_field(struct, 'ptr_data'),
-    int_data: addon.get_CXSourceLocation_field(struct, 'int_data'),
+    ptr_data: addon.get_CXSourceLocation_field(struct, 1),
+    int_data: addon.get_CXSourceLocation_field(struct, 0),
   };
 }
 
@@ -11627,21 +11643,21 @@ export function createCXSourceRange(init?: CXSourceRangeInit): CXSourceRange {
  * Get begin_int_data field from CXSourceRange
  */
 export function getCXSourceRange_begin_int_data(struct: CXSourceRange): number {
-  return addon.get_CXSourceRange_field(struct, 'begin_int_data');
+  return addon.get_CXSourceRange_field(struct, 0);
 }
 
 /**
  * Get end_int_data field from CXSourceRange
  */
 export function getCXSourceRange_end_int_data(struct: CXSourceRange): number {
-  return addon.get_CXSourceRange_field(struct, 'end_int_data');
+  return addon.get_CXSourceRange_field(struct, 1);
 }
 
 /**
  * Get ptr_data field from CXSourceRange
  */
 export function getCXSourceRange_ptr_data(struct: CXSourceRange): unknown[] {
-  return addon.get_CXSourceRange_field(struct, 'ptr_data');
+  return addon.get_CXSourceRange_field(struct, 2);
 }
 
 /**
@@ -11649,9 +11665,9 @@ export function getCXSourceRange_ptr_data(struct: CXSourceRange): unknown[] {
  */
 export function getCXSourceRangeFields(struct: CXSourceRange): CXSourceRangeInit {
   return {
-    ptr_data: addon.get_CXSourceRange_field(struct, 'ptr_data'),
-    begin_int_data: addon.get_CXSourceRange_field(struct, 'begin_int_data'),
-    end_int_data: addon.get_CXSourceRange_field(struct, 'end_int_data'),
+    ptr_data: addon.get_CXSourceRange_field(struct, 2),
+    begin_int_data: addon.get_CXSourceRange_field(struct, 0),
+    end_int_data: addon.get_CXSourceRange_field(struct, 1),
   };
 }
 
@@ -11667,14 +11683,14 @@ export function createCXSourceRangeList(init?: CXSourceRangeListInit): CXSourceR
  * Get count field from CXSourceRangeList
  */
 export function getCXSourceRangeList_count(struct: CXSourceRangeList): number {
-  return addon.get_CXSourceRangeList_field(struct, 'count');
+  return addon.get_CXSourceRangeList_field(struct, 0);
 }
 
 /**
  * Get ranges field from CXSourceRangeList
  */
 export function getCXSourceRangeList_ranges(struct: CXSourceRangeList): { _ptr: unknown } {
-  return addon.get_CXSourceRangeList_field(struct, 'ranges');
+  return addon.get_CXSourceRangeList_field(struct, 1);
 }
 
 /**
@@ -11682,8 +11698,8 @@ export function getCXSourceRangeList_ranges(struct: CXSourceRangeList): { _ptr:
  */
 export function getCXSourceRangeListFields(struct: CXSourceRangeList): CXSourceRangeListInit {
   return {
-    count: addon.get_CXSourceRangeList_field(struct, 'count'),
-    ranges: addon.get_CXSourceRangeList_field(struct, 'ranges'),
+    count: addon.get_CXSourceRangeList_field(struct, 0),
+    ranges: addon.get_CXSourceRangeList_field(struct, 1),
   };
 }
 
@@ -11704,14 +11720,14 @@ export function createCXString(init?: CXStringInit): CXString {
  * Get data field from CXString
  */
 export function getCXString_data(struct: CXString): unknown {
-  return addon.get_CXString_field(struct, 'data');
+  return addon.get_CXString_field(struct, 0);
 }
 
 /**
  * Get private_flags field from CXString
  */
 export function getCXString_private_flags(struct: CXString): number {
-  return addon.get_CXString_field(struct, 'private_flags');
+  return addon.get_CXString_field(struct, 1);
 }
 
 /**
@@ -11719,8 +11735,8 @@ export function getCXString_private_flags(struct: CXString): number {
  */
 export function getCXStringFields(struct: CXString): CXStringInit {
   return {
-    data: addon.get_CXString_field(struct, 'data'),
-    private_flags: addon.get_CXString_field(struct, 'private_flags'),
+    data: addon.get_CXString_field(struct, 0),
+    private_flags: addon.get_CXString_field(struct, 1),
   };
 }
 
@@ -11732,14 +11748,14 @@ export function createCXStringSet(init?: CXStringSetInit): CXStringSet {
  * Get Count field from CXStringSet
  */
 export function getCXStringSet_Count(struct: CXStringSet): number {
-  return addon.get_CXStringSet_field(struct, 'Count');
+  return addon.get_CXStringSet_field(struct, 0);
 }
 
 /**
  * Get Strings field from CXStringSet
  */
 export function getCXStringSet_Strings(struct: CXStringSet): { _ptr: unknown } {
-  return addon.get_CXStringSet_field(struct, 'Strings');
+  return addon.get_CXStringSet_field(struct, 1);
 }
 
 /**
@@ -11747,8 +11763,8 @@ export function getCXStringSet_Strings(struct: CXStringSet): { _ptr: unknown } {
  */
 export function getCXStringSetFields(struct: CXStringSet): CXStringSetInit {
   return {
-    Strings: addon.get_CXStringSet_field(struct, 'Strings'),
-    Count: addon.get_CXStringSet_field(struct, 'Count'),
+    Strings: addon.get_CXStringSet_field(struct, 1),
+    Count: addon.get_CXStringSet_field(struct, 0),
   };
 }
 
@@ -11775,15 +11791,15 @@ export function createCXToken(init?: CXTokenInit): CXToken {
 /**
  * Get int_data field from CXToken
  */
-export function getCXToken_int_data(struct: CXToken): unknown[] {
-  return addon.get_CXToken_field(struct, 'int_data');
+export function getCXToken_int_data(struct: CXToken): Uint32Array {
+  return addon.get_CXToken_field(struct, 0);
 }
 
 /**
  * Get ptr_data field from CXToken
  */
 export function getCXToken_ptr_data(struct: CXToken): unknown {
-  return addon.get_CXToken_field(struct, 'ptr_data');
+  return addon.get_CXToken_field(struct, 1);
 }
 
 /**
@@ -11791,8 +11807,8 @@ export function getCXToken_ptr_data(struct: CXToken): unknown {
  */
 export function getCXTokenFields(struct: CXToken): CXTokenInit {
   return {
-    int_data: addon.get_CXToken_field(struct, 'int_data'),
-    ptr_data: addon.get_CXToken_field(struct, 'ptr_data'),
+    int_data: addon.get_CXToken_field(struct, 0),
+    ptr_data: addon.get_CXToken_field(struct, 1),
   };
 }
 
@@ -11820,21 +11836,21 @@ export function createCXTUResourceUsage(init?: CXTUResourceUsageInit): CXTUResou
  * Get data field from CXTUResourceUsage
  */
 export function getCXTUResourceUsage_data(struct: CXTUResourceUsage): unknown {
-  return addon.get_CXTUResourceUsage_field(struct, 'data');
+  return addon.get_CXTUResourceUsage_field(struct, 0);
 }
 
 /**
  * Get entries field from CXTUResourceUsage
  */
 export function getCXTUResourceUsage_entries(struct: CXTUResourceUsage): { _ptr: unknown } {
-  return addon.get_CXTUResourceUsage_field(struct, 'entries');
+  return addon.get_CXTUResourceUsage_field(struct, 1);
 }
 
 /**
  * Get numEntries field from CXTUResourceUsage
  */
 export function getCXTUResourceUsage_numEntries(struct: CXTUResourceUsage): number {
-  return addon.get_CXTUResourceUsage_field(struct, 'numEntries');
+  return addon.get_CXTUResourceUsage_field(struct, 2);
 }
 
 /**
@@ -11842,9 +11858,9 @@ export function getCXTUResourceUsage_numEntries(struct: CXTUResourceUsage): numb
  */
 export function getCXTUResourceUsageFields(struct: CXTUResourceUsage): CXTUResourceUsageInit {
   return {
-    data: addon.get_CXTUResourceUsage_field(struct, 'data'),
-    numEntries: addon.get_CXTUResourceUsage_field(struct, 'numEntries'),
-    entries: addon.get_CXTUResourceUsage_field(struct, 'entries'),
+    data: addon.get_CXTUResourceUsage_field(struct, 0),
+    numEntries: addon.get_CXTUResourceUsage_field(struct, 2),
+    entries: addon.get_CXTUResourceUsage_field(struct, 1),
   };
 }
 
@@ -11855,24 +11871,24 @@ export function createCXTUResourceUsageEntry(init?: CXTUResourceUsageEntryInit):
 /**
  * Get amount field from CXTUResourceUsageEntry
  */
-export function getCXTUResourceUsageEntry_amount(struct: CXTUResourceUsageEntry): number {
-  return addon.get_CXTUResourceUsageEntry_field(struct, 'amount');
+export function getCXTUResourceUsageEntry_amount(struct: CXTUResourceUsageEntry | { _ptr: unknown }): number {
+  return '_ptr' in struct ? addon.get_CXTUResourceUsageEntry_field(struct, 0) : struct.amount;
 }
 
 /**
  * Get kind field from CXTUResourceUsageEntry
  */
-export function getCXTUResourceUsageEntry_kind(struct: CXTUResourceUsageEntry): number {
-  return addon.get_CXTUResourceUsageEntry_field(struct, 'kind');
+export function getCXTUResourceUsageEntry_kind(struct: CXTUResourceUsageEntry | { _ptr: unknown }): number {
+  return '_ptr' in struct ? addon.get_CXTUResourceUsageEntry_field(struct, 1) : struct.kind;
 }
 
 /**
  * Get all fields from CXTUResourceUsageEntry as an object
  */
-export function getCXTUResourceUsageEntryFields(struct: CXTUResourceUsageEntry): CXTUResourceUsageEntryInit {
+export function getCXTUResourceUsageEntryFields(struct: CXTUResourceUsageEntry | { _ptr: unknown }): CXTUResourceUsageEntryInit {
   return {
-    kind: addon.get_CXTUResourceUsageEntry_field(struct, 'kind'),
-    amount: addon.get_CXTUResourceUsageEntry_field(struct, 'amount'),
+    kind: '_ptr' in struct ? addon.get_CXTUResourceUsageEntry_field(struct, 1) : struct.kind,
+    amount: '_ptr' in struct ? addon.get_CXTUResourceUsageEntry_field(struct, 0) : struct.amount,
   };
 }
 
@@ -11888,14 +11904,14 @@ export function createCXType(init?: CXTypeInit): CXType {
  * Get data field from CXType
  */
 export function getCXType_data(struct: CXType): unknown[] {
-  return addon.get_CXType_field(struct, 'data');
+  return addon.get_CXType_field(struct, 0);
 }
 
 /**
  * Get kind field from CXType
  */
 export function getCXType_kind(struct: CXType): number {
-  return addon.get_CXType_field(struct, 'kind');
+  return addon.get_CXType_field(struct, 1);
 }
 
 /**
@@ -11903,8 +11919,8 @@ export function getCXType_kind(struct: CXType): number {
  */
 export function getCXTypeFields(struct: CXType): CXTypeInit {
   return {
-    kind: addon.get_CXType_field(struct, 'kind'),
-    data: addon.get_CXType_field(struct, 'data'),
+    kind: addon.get_CXType_field(struct, 1),
+    data: addon.get_CXType_field(struct, 0),
   };
 }
 
@@ -11924,21 +11940,21 @@ export function createCXUnsavedFile(init?: CXUnsavedFileInit): CXUnsavedFile {
  * Get Contents field from CXUnsavedFile
  */
 export function getCXUnsavedFile_Contents(struct: CXUnsavedFile): string {
-  return addon.get_CXUnsavedFile_field(struct, 'Contents');
+  return addon.get_CXUnsavedFile_field(struct, 0);
 }
 
 /**
  * Get Filename field from CXUnsavedFile
  */
 export function getCXUnsavedFile_Filename(struct: CXUnsavedFile): string {
-  return addon.get_CXUnsavedFile_field(struct, 'Filename');
+  return addon.get_CXUnsavedFile_field(struct, 1);
 }
 
 /**
  * Get Length field from CXUnsavedFile
  */
 export function getCXUnsavedFile_Length(struct: CXUnsavedFile): number {
-  return addon.get_CXUnsavedFile_field(struct, 'Length');
+  return addon.get_CXUnsavedFile_field(struct, 2);
 }
 
 /**
@@ -11946,9 +11962,9 @@ export function getCXUnsavedFile_Length(struct: CXUnsavedFile): number {
  */
 export function getCXUnsavedFileFields(struct: CXUnsavedFile): CXUnsavedFileInit {
   return {
-    Filename: addon.get_CXUnsavedFile_field(struct, 'Filename'),
-    Contents: addon.get_CXUnsavedFile_field(struct, 'Contents'),
-    Length: addon.get_CXUnsavedFile_field(struct, 'Length'),
+    Filename: addon.get_CXUnsavedFile_field(struct, 1),
+    Contents: addon.get_CXUnsavedFile_field(struct, 0),
+    Length: addon.get_CXUnsavedFile_field(struct, 2),
   };
 }
 
@@ -11963,32 +11979,32 @@ export function createCXVersion(init?: CXVersionInit): CXVersion {
 /**
  * Get Major field from CXVersion
  */
-export function getCXVersion_Major(struct: CXVersion): number {
-  return addon.get_CXVersion_field(struct, 'Major');
+export function getCXVersion_Major(struct: CXVersion | { _ptr: unknown }): number {
+  return '_ptr' in struct ? addon.get_CXVersion_field(struct, 0) : struct.Major;
 }
 
 /**
  * Get Minor field from CXVersion
  */
-export function getCXVersion_Minor(struct: CXVersion): number {
-  return addon.get_CXVersion_field(struct, 'Minor');
+export function getCXVersion_Minor(struct: CXVersion | { _ptr: unknown }): number {
+  return '_ptr' in struct ? addon.get_CXVersion_field(struct, 1) : struct.Minor;
 }
 
 /**
  * Get Subminor field from CXVersion
  */
-export function getCXVersion_Subminor(struct: CXVersion): number {
-  return addon.get_CXVersion_field(struct, 'Subminor');
+export function getCXVersion_Subminor(struct: CXVersion | { _ptr: unknown }): number {
+  return '_ptr' in struct ? addon.get_CXVersion_field(struct, 2) : struct.Subminor;
 }
 
 /**
  * Get all fields from CXVersion as an object
  */
-export function getCXVersionFields(struct: CXVersion): CXVersionInit {
+export function getCXVersionFields(struct: CXVersion | { _ptr: unknown }): CXVersionInit {
   return {
-    Major: addon.get_CXVersion_field(struct, 'Major'),
-    Minor: addon.get_CXVersion_field(struct, 'Minor'),
-    Subminor: addon.get_CXVersion_field(struct, 'Subminor'),
+    Major: '_ptr' in struct ? addon.get_CXVersion_field(struct, 0) : struct.Major,
+    Minor: '_ptr' in struct ? addon.get_CXVersion_field(struct, 1) : struct.Minor,
+    Subminor: '_ptr' in struct ? addon.get_CXVersion_field(struct, 2) : struct.Subminor,
   };
 }
 
@@ -12017,56 +12033,56 @@ export function createIndexerCallbacks(init?: IndexerCallbacksInit): IndexerCall
  * Get abortQuery field from IndexerCallbacks
  */
 export function getIndexerCallbacks_abortQuery(struct: IndexerCallbacks): { _type: 'int (*)(CXClientData, void *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'abortQuery');
+  return addon.get_IndexerCallbacks_field(struct, 0);
 }
 
 /**
  * Get diagnostic field from IndexerCallbacks
  */
 export function getIndexerCallbacks_diagnostic(struct: IndexerCallbacks): { _type: 'void (*)(CXClientData, CXDiagnosticSet, void *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'diagnostic');
+  return addon.get_IndexerCallbacks_field(struct, 1);
 }
 
 /**
  * Get enteredMainFile field from IndexerCallbacks
  */
 export function getIndexerCallbacks_enteredMainFile(struct: IndexerCallbacks): { _type: 'CXIdxClientFile (*)(CXClientData, CXFile, void *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'enteredMainFile');
+  return addon.get_IndexerCallbacks_field(struct, 2);
 }
 
 /**
  * Get importedASTFile field from IndexerCallbacks
  */
 export function getIndexerCallbacks_importedASTFile(struct: IndexerCallbacks): { _type: 'CXIdxClientASTFile (*)(CXClientData, const CXIdxImportedASTFileInfo *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'importedASTFile');
+  return addon.get_IndexerCallbacks_field(struct, 3);
 }
 
 /**
  * Get indexDeclaration field from IndexerCallbacks
  */
 export function getIndexerCallbacks_indexDeclaration(struct: IndexerCallbacks): { _type: 'void (*)(CXClientData, const CXIdxDeclInfo *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'indexDeclaration');
+  return addon.get_IndexerCallbacks_field(struct, 4);
 }
 
 /**
  * Get indexEntityReference field from IndexerCallbacks
  */
 export function getIndexerCallbacks_indexEntityReference(struct: IndexerCallbacks): { _type: 'void (*)(CXClientData, const CXIdxEntityRefInfo *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'indexEntityReference');
+  return addon.get_IndexerCallbacks_field(struct, 5);
 }
 
 /**
  * Get ppIncludedFile field from IndexerCallbacks
  */
 export function getIndexerCallbacks_ppIncludedFile(struct: IndexerCallbacks): { _type: 'CXIdxClientFile (*)(CXClientData, const CXIdxIncludedFileInfo *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'ppIncludedFile');
+  return addon.get_IndexerCallbacks_field(struct, 6);
 }
 
 /**
  * Get startedTranslationUnit field from IndexerCallbacks
  */
 export function getIndexerCallbacks_startedTranslationUnit(struct: IndexerCallbacks): { _type: 'CXIdxClientContainer (*)(CXClientData, void *)' } {
-  return addon.get_IndexerCallbacks_field(struct, 'startedTranslationUnit');
+  return addon.get_IndexerCallbacks_field(struct, 7);
 }
 
 /**
@@ -12074,13 +12090,22 @@ export function getIndexerCallbacks_startedTranslationUnit(struct: IndexerCallba
  */
 export function getIndexerCallbacksFields(struct: IndexerCallbacks): IndexerCallbacksInit {
   return {
-    abortQuery: addon.get_IndexerCallbacks_field(struct, 'abortQuery'),
-    diagnostic: addon.get_IndexerCallbacks_field(struct, 'diagnostic'),
-    enteredMainFile: addon.get_IndexerCallbacks_field(struct, 'enteredMainFile'),
-    ppIncludedFile: addon.get_IndexerCallbacks_field(struct, 'ppIncludedFile'),
-    importedASTFile: addon.get_IndexerCallbacks_field(struct, 'importedASTFile'),
-    startedTranslationUnit: addon.get_IndexerCallbacks_field(struct, 'startedTranslationUnit'),
-    indexDeclaration: addon.get_IndexerCallbacks_field(struct, 'indexDeclaration'),
-    indexEntityReference: addon.get_IndexerCallbacks_field(struct, 'indexEntityReference'),
+    abortQuery: addon.get_IndexerCallbacks_field(struct, 0),
+    diagnostic: addon.get_IndexerCallbacks_field(struct, 1),
+    enteredMainFile: addon.get_IndexerCallbacks_field(struct, 2),
+    ppIncludedFile: addon.get_IndexerCallbacks_field(struct, 6),
+    importedASTFile: addon.get_IndexerCallbacks_field(struct, 3),
+    startedTranslationUnit: addon.get_IndexerCallbacks_field(struct, 7),
+    indexDeclaration: addon.get_IndexerCallbacks_field(struct, 4),
+    indexEntityReference: addon.get_IndexerCallbacks_field(struct, 5),
   };
 }
+
+
+// Native extensions
+export * from './ext/record-layout.ts';
+export * from './ext/include-graph.ts';
+export * from './ext/references.ts';
+export * from './ext/cursor-map.ts';
+export * from './ext/cursor.ts';
+export * from './ext/header-ast.ts';
\ No newline at end of file
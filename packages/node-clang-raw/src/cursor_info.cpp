@@ -0,0 +1,99 @@
+// Native property slots for the high-level Cursor class (ext/cursor.ts).
+//
+// cursorProperty(cursor, slot) computes one property with a single native
+// call, converting CXStrings and source locations to plain JS values instead
+// of handing out handles that need further calls and disposal. The TS side
+// caches each slot after its first access.
+#include "extensions.h"
+
+namespace {
+
+// Keep in sync with CursorSlot in ext/cursor.ts
+enum CursorSlot : uint32_t {
+  kSlotKind = 0,
+  kSlotSpelling = 1,
+  kSlotType = 2,
+  kSlotLocation = 3,
+  kSlotExtent = 4,
+  kSlotSemanticParent = 5,
+  kSlotUsr = 6,
+  kSlotChildren = 7,
+};
+
+Napi::Value PositionOf(Napi::Env env, CXSourceLocation location) {
+  CXFile file = nullptr;
+  unsigned line = 0;
+  unsigned column = 0;
+  unsigned offset = 0;
+  clang_getFileLocation(location, &file, &line, &column, &offset);
+  Napi::Object position = Napi::Object::New(env);
+  if (file != nullptr) {
+    position.Set("file", Napi::String::New(env, TakeString(clang_getFileName(file))));
+  } else {
+    position.Set("file", env.Null());
+  }
+  position.Set("line", Napi::Number::New(env, line));
+  position.Set("column", Napi::Number::New(env, column));
+  position.Set("offset", Napi::Number::New(env, offset));
+  return position;
+}
+
+CXChildVisitResult CollectChild(CXCursor cursor, CXCursor /*parent*/, CXClientData client_data) {
+  static_cast<std::vector<CXCursor>*>(client_data)->push_back(cursor);
+  return CXChildVisit_Continue;
+}
+
+// cursorProperty(cursor, slot) -> value for that slot
+Napi::Value CursorProperty(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  CXCursor cursor;
+  if (info.Length() < 2 || !UnwrapHandle(info[0], &cursor) || !info[1].IsNumber()) {
+    return ThrowTypeError(env, "Expected (CXCursor, slot)");
+  }
+
+  switch (info[1].As<Napi::Number>().Uint32Value()) {
+    case kSlotKind:
+      return Napi::Number::New(env, clang_getCursorKind(cursor));
+    case kSlotSpelling:
+      return Napi::String::New(env, TakeString(clang_getCursorSpelling(cursor)));
+    case kSlotType:
+      return WrapOwnedHandle(env, clang_getCursorType(cursor), "CXType", PinnedOwner(info[0]));
+    case kSlotLocation:
+      return PositionOf(env, clang_getCursorLocation(cursor));
+    case kSlotExtent: {
+      CXSourceRange extent = clang_getCursorExtent(cursor);
+      Napi::Object range = Napi::Object::New(env);
+      range.Set("start", PositionOf(env, clang_getRangeStart(extent)));
+      range.Set("end", PositionOf(env, clang_getRangeEnd(extent)));
+      return range;
+    }
+    case kSlotSemanticParent: {
+      CXCursor parent = clang_getCursorSemanticParent(cursor);
+      if (clang_Cursor_isNull(parent) != 0 || clang_isInvalid(clang_getCursorKind(parent)) != 0) {
+        return env.Null();
+      }
+      return WrapOwnedHandle(env, parent, "CXCursor", PinnedOwner(info[0]));
+    }
+    case kSlotUsr:
+      return Napi::String::New(env, TakeString(clang_getCursorUSR(cursor)));
+    case kSlotChildren: {
+      std::vector<CXCursor> children;
+      clang_visitChildren(cursor, CollectChild, &children);
+      Napi::Array result = Napi::Array::New(env, children.size());
+      Napi::Value owner = PinnedOwner(info[0]);
+      for (uint32_t i = 0; i < children.size(); i++) {
+        result.Set(i, WrapOwnedHandle(env, children[i], "CXCursor", owner));
+      }
+      return result;
+    }
+    default:
+      Napi::RangeError::New(env, "Unknown cursor property slot").ThrowAsJavaScriptException();
+      return env.Undefined();
+  }
+}
+
+}  // namespace
+
+void RegisterCursorInfo(Napi::Env env, Napi::Object exports) {
+  exports.Set("cursorProperty", Napi::Function::New(env, CursorProperty));
+}
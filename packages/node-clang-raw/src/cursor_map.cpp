@@ -0,0 +1,366 @@
+// Native CursorMap / CursorSet keyed by clang_hashCursor and clang_equalCursors.
+//
+// Lets callers memoize per-declaration results without computing USR strings
+// as keys. Map values stay on the JS heap in a slot array owned by the map;
+// the native side only keeps cursor -> slot. Cursors are copied, so each slot
+// also pins the `_owner` (translation unit) of the handle it was stored from,
+// and the TU is not disposed while the container still holds its cursors.
+#include <unordered_map>
+
+#include "extensions.h"
+
+namespace {
+
+struct CursorHash {
+  size_t operator()(const CXCursor& cursor) const {
+    return clang_hashCursor(cursor);
+  }
+};
+
+struct CursorEqual {
+  bool operator()(const CXCursor& lhs, const CXCursor& rhs) const {
+    return clang_equalCursors(lhs, rhs) != 0;
+  }
+};
+
+// Reads a cursor array argument, and the owners the handles pin when `owners`
+// is given; throws and returns false on a bad element.
+bool ReadCursors(Napi::Env env,
+                 const Napi::Value& value,
+                 std::vector<CXCursor>* out,
+                 std::vector<Napi::Value>* owners = nullptr) {
+  if (!value.IsArray()) {
+    ThrowTypeError(env, "Expected array of CXCursor");
+    return false;
+  }
+  Napi::Array array = value.As<Napi::Array>();
+  out->resize(array.Length());
+  for (uint32_t i = 0; i < array.Length(); i++) {
+    Napi::Value handle = array.Get(i);
+    if (!UnwrapHandle(handle, &(*out)[i])) {
+      ThrowTypeError(env, "Expected array of CXCursor");
+      return false;
+    }
+    if (owners != nullptr) {
+      owners->push_back(PinnedOwner(handle));
+    }
+  }
+  return true;
+}
+
+// cursor -> slot, shared by CursorMap and CursorSet. `owners` holds, per slot,
+// the owner of the handle the cursor was stored from.
+class CursorSlots {
+ public:
+  explicit CursorSlots(Napi::Env env) {
+    owners_ = Napi::Persistent(Napi::Array::New(env).As<Napi::Object>());
+  }
+
+  // Slot of `cursor`, added if missing; *inserted tells which
+  uint32_t Insert(const CXCursor& cursor, const Napi::Value& owner, bool* inserted = nullptr) {
+    auto it = slots_.find(cursor);
+    bool found = it != slots_.end();
+    uint32_t slot = 0;
+    if (found) {
+      slot = it->second;
+    } else if (!free_slots_.empty()) {
+      slot = free_slots_.back();
+      free_slots_.pop_back();
+      slots_.emplace(cursor, slot);
+    } else {
+      slot = next_slot_++;
+      slots_.emplace(cursor, slot);
+    }
+    if (inserted != nullptr) {
+      *inserted = !found;
+    }
+    // The latest handle's owner; all of them own the same cursor
+    owners_.Value().Set(slot, owner);
+    return slot;
+  }
+
+  // Removes `cursor` and unpins its owner; false when missing
+  bool Erase(Napi::Env env, const CXCursor& cursor, uint32_t* slot) {
+    auto it = slots_.find(cursor);
+    if (it == slots_.end()) {
+      return false;
+    }
+    *slot = it->second;
+    owners_.Value().Set(it->second, env.Undefined());
+    free_slots_.push_back(it->second);
+    slots_.erase(it);
+    return true;
+  }
+
+  void Clear(Napi::Env env) {
+    slots_.clear();
+    free_slots_.clear();
+    next_slot_ = 0;
+    owners_.Reset(Napi::Array::New(env).As<Napi::Object>(), 1);
+  }
+
+  const uint32_t* Find(const CXCursor& cursor) const {
+    auto it = slots_.find(cursor);
+    return it != slots_.end() ? &it->second : nullptr;
+  }
+
+  Napi::Value Owner(uint32_t slot) const {
+    return owners_.Value().Get(slot);
+  }
+
+  size_t size() const {
+    return slots_.size();
+  }
+
+  auto begin() const {
+    return slots_.begin();
+  }
+
+  auto end() const {
+    return slots_.end();
+  }
+
+ private:
+  std::unordered_map<CXCursor, uint32_t, CursorHash, CursorEqual> slots_;
+  std::vector<uint32_t> free_slots_;
+  uint32_t next_slot_ = 0;
+  Napi::ObjectReference owners_;
+};
+
+class CursorMap : public Napi::ObjectWrap<CursorMap> {
+ public:
+  static Napi::Function Define(Napi::Env env) {
+    return DefineClass(env,
+                       "CursorMap",
+                       {
+                           InstanceMethod("set", &CursorMap::Put),
+                           InstanceMethod("get", &CursorMap::Lookup),
+                           InstanceMethod("has", &CursorMap::Contains),
+                           InstanceMethod("delete", &CursorMap::Remove),
+                           InstanceMethod("clear", &CursorMap::Clear),
+                           InstanceMethod("keys", &CursorMap::Keys),
+                           InstanceMethod("setMany", &CursorMap::PutMany),
+                           InstanceMethod("getMany", &CursorMap::LookupMany),
+                           InstanceMethod("hasMany", &CursorMap::ContainsMany),
+                           InstanceAccessor("size", &CursorMap::Size, nullptr),
+                       });
+  }
+
+  explicit CursorMap(const Napi::CallbackInfo& info)
+      : Napi::ObjectWrap<CursorMap>(info), slots_(info.Env()) {
+    values_ = Napi::Persistent(Napi::Array::New(info.Env()).As<Napi::Object>());
+  }
+
+ private:
+  Napi::Value Find(Napi::Env env, const CXCursor& cursor) const {
+    const uint32_t* slot = slots_.Find(cursor);
+    if (slot == nullptr) {
+      return env.Undefined();
+    }
+    return values_.Value().Get(*slot);
+  }
+
+  Napi::Value Put(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 2 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected (CXCursor, value)");
+    }
+    values_.Value().Set(slots_.Insert(cursor, PinnedOwner(info[0])), info[1]);
+    return info.This();
+  }
+
+  Napi::Value Lookup(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 1 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected CXCursor");
+    }
+    return Find(info.Env(), cursor);
+  }
+
+  Napi::Value Contains(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 1 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected CXCursor");
+    }
+    return Napi::Boolean::New(info.Env(), slots_.Find(cursor) != nullptr);
+  }
+
+  Napi::Value Remove(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 1 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected CXCursor");
+    }
+    uint32_t slot = 0;
+    if (!slots_.Erase(info.Env(), cursor, &slot)) {
+      return Napi::Boolean::New(info.Env(), false);
+    }
+    // Drop the value so it can be collected; the slot is reused later
+    values_.Value().Set(slot, info.Env().Undefined());
+    return Napi::Boolean::New(info.Env(), true);
+  }
+
+  Napi::Value Clear(const Napi::CallbackInfo& info) {
+    slots_.Clear(info.Env());
+    values_.Reset(Napi::Array::New(info.Env()).As<Napi::Object>(), 1);
+    return info.Env().Undefined();
+  }
+
+  Napi::Value Keys(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Array keys = Napi::Array::New(env, slots_.size());
+    uint32_t i = 0;
+    for (const auto& entry : slots_) {
+      keys.Set(i++, WrapOwnedHandle(env, entry.first, "CXCursor", slots_.Owner(entry.second)));
+    }
+    return keys;
+  }
+
+  // setMany(cursors, values): values[i] is stored for cursors[i]
+  Napi::Value PutMany(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<CXCursor> cursors;
+    std::vector<Napi::Value> owners;
+    if (info.Length() < 2) {
+      return ThrowTypeError(env, "Expected (CXCursor[], values[])");
+    }
+    if (!ReadCursors(env, info[0], &cursors, &owners)) {
+      return env.Undefined();
+    }
+    if (!info[1].IsArray() || info[1].As<Napi::Array>().Length() != cursors.size()) {
+      return ThrowTypeError(env, "Expected values array of the same length");
+    }
+    Napi::Array values = info[1].As<Napi::Array>();
+    for (uint32_t i = 0; i < cursors.size(); i++) {
+      values_.Value().Set(slots_.Insert(cursors[i], owners[i]), values.Get(i));
+    }
+    return info.This();
+  }
+
+  Napi::Value LookupMany(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<CXCursor> cursors;
+    if (!ReadCursors(env, info[0], &cursors)) {
+      return env.Undefined();
+    }
+    Napi::Array result = Napi::Array::New(env, cursors.size());
+    for (uint32_t i = 0; i < cursors.size(); i++) {
+      result.Set(i, Find(env, cursors[i]));
+    }
+    return result;
+  }
+
+  Napi::Value ContainsMany(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<CXCursor> cursors;
+    if (!ReadCursors(env, info[0], &cursors)) {
+      return env.Undefined();
+    }
+    auto result = Napi::Uint8Array::New(env, cursors.size());
+    for (size_t i = 0; i < cursors.size(); i++) {
+      result[i] = slots_.Find(cursors[i]) != nullptr ? 1 : 0;
+    }
+    return result;
+  }
+
+  Napi::Value Size(const Napi::CallbackInfo& info) {
+    return Napi::Number::New(info.Env(), static_cast<double>(slots_.size()));
+  }
+
+  CursorSlots slots_;
+  Napi::ObjectReference values_;
+};
+
+class CursorSet : public Napi::ObjectWrap<CursorSet> {
+ public:
+  static Napi::Function Define(Napi::Env env) {
+    return DefineClass(env,
+                       "CursorSet",
+                       {
+                           InstanceMethod("add", &CursorSet::Add),
+                           InstanceMethod("has", &CursorSet::Contains),
+                           InstanceMethod("delete", &CursorSet::Remove),
+                           InstanceMethod("clear", &CursorSet::Clear),
+                           InstanceMethod("addMany", &CursorSet::AddMany),
+                           InstanceMethod("hasMany", &CursorSet::ContainsMany),
+                           InstanceAccessor("size", &CursorSet::Size, nullptr),
+                       });
+  }
+
+  explicit CursorSet(const Napi::CallbackInfo& info)
+      : Napi::ObjectWrap<CursorSet>(info), cursors_(info.Env()) {}
+
+ private:
+  Napi::Value Add(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 1 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected CXCursor");
+    }
+    cursors_.Insert(cursor, PinnedOwner(info[0]));
+    return info.This();
+  }
+
+  Napi::Value Contains(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 1 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected CXCursor");
+    }
+    return Napi::Boolean::New(info.Env(), cursors_.Find(cursor) != nullptr);
+  }
+
+  Napi::Value Remove(const Napi::CallbackInfo& info) {
+    CXCursor cursor;
+    if (info.Length() < 1 || !UnwrapHandle(info[0], &cursor)) {
+      return ThrowTypeError(info.Env(), "Expected CXCursor");
+    }
+    uint32_t slot = 0;
+    return Napi::Boolean::New(info.Env(), cursors_.Erase(info.Env(), cursor, &slot));
+  }
+
+  Napi::Value Clear(const Napi::CallbackInfo& info) {
+    cursors_.Clear(info.Env());
+    return info.Env().Undefined();
+  }
+
+  // addMany(cursors) -> Uint8Array, 1 where the cursor was not yet present
+  Napi::Value AddMany(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<CXCursor> cursors;
+    std::vector<Napi::Value> owners;
+    if (!ReadCursors(env, info[0], &cursors, &owners)) {
+      return env.Undefined();
+    }
+    auto inserted = Napi::Uint8Array::New(env, cursors.size());
+    for (size_t i = 0; i < cursors.size(); i++) {
+      bool added = false;
+      cursors_.Insert(cursors[i], owners[i], &added);
+      inserted[i] = added ? 1 : 0;
+    }
+    return inserted;
+  }
+
+  Napi::Value ContainsMany(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<CXCursor> cursors;
+    if (!ReadCursors(env, info[0], &cursors)) {
+      return env.Undefined();
+    }
+    auto result = Napi::Uint8Array::New(env, cursors.size());
+    for (size_t i = 0; i < cursors.size(); i++) {
+      result[i] = cursors_.Find(cursors[i]) != nullptr ? 1 : 0;
+    }
+    return result;
+  }
+
+  Napi::Value Size(const Napi::CallbackInfo& info) {
+    return Napi::Number::New(info.Env(), static_cast<double>(cursors_.size()));
+  }
+
+  CursorSlots cursors_;
+};
+
+}  // namespace
+
+void RegisterCursorMap(Napi::Env env, Napi::Object exports) {
+  exports.Set("CursorMap", CursorMap::Define(env));
+  exports.Set("CursorSet", CursorSet::Define(env));
+}
@@ -0,0 +1,87 @@
+// Shared helpers for the hand-written native extensions in src/*.cpp.
+//
+// binding.cpp is regenerated by codegen; everything that needs a native loop
+// over libclang (visitors, bulk queries) lives in separate translation units
+// and is registered from the generated Init via --native-extension.
+#pragma once
+
+#include <clang-c/Index.h>
+#include <napi.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Reads the value behind a generated handle object ({ _ptr: External<T*> }).
+// Returns false when `value` is not a handle.
+template <typename T>
+inline bool UnwrapHandle(const Napi::Value& value, T* out) {
+  if (!value.IsObject()) {
+    return false;
+  }
+  Napi::Value ptr = value.As<Napi::Object>().Get("_ptr");
+  if (!ptr.IsExternal()) {
+    return false;
+  }
+  T* data = static_cast<T*>(ptr.As<Napi::External<void>>().Data());
+  if (data == nullptr) {
+    return false;
+  }
+  *out = *data;
+  return true;
+}
+
+// The owner (e.g. the CXTranslationUnit) a generated handle pinned through
+// `_owner`, or undefined.
+inline Napi::Value PinnedOwner(const Napi::Value& handle) {
+  if (!handle.IsObject()) {
+    return handle.Env().Undefined();
+  }
+  return handle.As<Napi::Object>().Get("_owner");
+}
+
+// Same layout as wrapOwnedPointer in binding.cpp, so the generated wrappers
+// accept the result. Handles derived from another one pass its PinnedOwner,
+// so they keep the translation unit alive just like generated results do.
+template <typename T>
+inline Napi::Object WrapOwnedHandle(Napi::Env env, const T& value, const char* type_name,
+                                    const Napi::Value& owner = Napi::Value()) {
+  auto ext = Napi::External<T>::New(env, new T(value), [](Napi::Env, T* p) { delete p; });
+  Napi::Object obj = Napi::Object::New(env);
+  obj.Set("_ptr", ext);
+  obj.Set("_type", Napi::String::New(env, type_name));
+  if (owner.IsObject()) {
+    obj.Set("_owner", owner);
+  }
+  return obj;
+}
+
+// Copies a CXString into a std::string and disposes it.
+inline std::string TakeString(CXString str) {
+  const char* cstr = clang_getCString(str);
+  std::string result = cstr != nullptr ? cstr : "";
+  clang_disposeString(str);
+  return result;
+}
+
+template <typename T>
+inline Napi::TypedArrayOf<T> ToTypedArray(Napi::Env env, const std::vector<T>& values) {
+  auto array = Napi::TypedArrayOf<T>::New(env, values.size());
+  if (!values.empty()) {
+    std::memcpy(array.Data(), values.data(), values.size() * sizeof(T));
+  }
+  return array;
+}
+
+inline Napi::Array ToStringArray(Napi::Env env, const std::vector<std::string>& values) {
+  Napi::Array array = Napi::Array::New(env, values.size());
+  for (uint32_t i = 0; i < values.size(); i++) {
+    array.Set(i, Napi::String::New(env, values[i]));
+  }
+  return array;
+}
+
+inline Napi::Value ThrowTypeError(Napi::Env env, const char* message) {
+  Napi::TypeError::New(env, message).ThrowAsJavaScriptException();
+  return env.Undefined();
+}
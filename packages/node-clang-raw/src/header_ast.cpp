@@ -0,0 +1,609 @@
+// Native HeaderAST extractor for codegen's h-parser.
+//
+// extractHeaderAST(tu, options) walks the translation unit once and returns
+// the enums, structs, typedefs, functions and ObjC interfaces/protocols as a
+// single JSON string, instead of one JS callback and a dozen CXString
+// round-trips per cursor. Declarations, key order and value conventions
+// match the JS walker in codegen/h-parser/index.ts.
+#include <cstdint>
+
+#include "extensions.h"
+
+namespace {
+
+struct ExtractOptions {
+  bool include_documentation = true;
+};
+
+// Appends JSON text to a string; commas are tracked per open container. At
+// the top level the writer holds a comma-separated list of array elements.
+class JsonWriter {
+ public:
+  const std::string& str() const { return out_; }
+  bool empty() const { return out_.empty(); }
+
+  void BeginObject() {
+    Separate();
+    out_ += '{';
+    first_.push_back(true);
+  }
+  void EndObject() {
+    out_ += '}';
+    first_.pop_back();
+  }
+  void BeginArray() {
+    Separate();
+    out_ += '[';
+    first_.push_back(true);
+  }
+  void EndArray() {
+    out_ += ']';
+    first_.pop_back();
+  }
+
+  void Key(const char* key) {
+    Separate();
+    AppendString(key);
+    out_ += ':';
+    after_key_ = true;
+  }
+
+  void String(const std::string& value) {
+    Separate();
+    AppendString(value);
+  }
+  void Int(int64_t value) {
+    Separate();
+    out_ += std::to_string(value);
+  }
+  void Bool(bool value) {
+    Separate();
+    out_ += value ? "true" : "false";
+  }
+  // Array elements written into another writer
+  void RawElements(const JsonWriter& elements) {
+    if (elements.empty()) {
+      return;
+    }
+    Separate();
+    out_ += elements.out_;
+  }
+
+ private:
+  void Separate() {
+    if (after_key_) {
+      after_key_ = false;
+      return;
+    }
+    if (first_.empty()) {
+      if (!out_.empty()) {
+        out_ += ',';
+      }
+    } else {
+      if (!first_.back()) {
+        out_ += ',';
+      }
+      first_.back() = false;
+    }
+  }
+
+  void AppendString(const std::string& value) {
+    static const char kHex[] = "0123456789abcdef";
+    out_ += '"';
+    for (char c : value) {
+      switch (c) {
+        case '"':
+          out_ += "\\\"";
+          break;
+        case '\\':
+          out_ += "\\\\";
+          break;
+        case '\n':
+          out_ += "\\n";
+          break;
+        case '\r':
+          out_ += "\\r";
+          break;
+        case '\t':
+          out_ += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            out_ += "\\u00";
+            out_ += kHex[(c >> 4) & 0xf];
+            out_ += kHex[c & 0xf];
+          } else {
+            out_ += c;
+          }
+      }
+    }
+    out_ += '"';
+  }
+
+  std::string out_;
+  std::vector<bool> first_;
+  bool after_key_ = false;
+};
+
+// One writer per HeaderAST array, filled in visit order
+struct HeaderWalk {
+  ExtractOptions options;
+  JsonWriter interfaces;
+  JsonWriter protocols;
+  JsonWriter classes;
+  JsonWriter enums;
+  JsonWriter structs;
+  JsonWriter typedefs;
+  JsonWriter functions;
+};
+
+std::string Trim(const std::string& text) {
+  const char* whitespace = " \t\r\n\f\v";
+  size_t begin = text.find_first_not_of(whitespace);
+  if (begin == std::string::npos) {
+    return "";
+  }
+  size_t end = text.find_last_not_of(whitespace);
+  return text.substr(begin, end - begin + 1);
+}
+
+bool StartsWith(const std::string& text, const char* prefix) {
+  return text.rfind(prefix, 0) == 0;
+}
+
+bool EndsWith(const std::string& text, const char* suffix) {
+  size_t length = std::strlen(suffix);
+  return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+// Port of cleanDocumentation() in codegen/h-parser/utils.ts
+std::string CleanDocumentation(const std::string& comment) {
+  std::string doc;
+  bool first = true;
+  auto push = [&](const std::string& line) {
+    if (!first) {
+      doc += '\n';
+    }
+    doc += line;
+    first = false;
+  };
+
+  size_t start = 0;
+  while (start <= comment.size()) {
+    size_t newline = comment.find('\n', start);
+    if (newline == std::string::npos) {
+      newline = comment.size();
+    }
+    std::string line = Trim(comment.substr(start, newline - start));
+    start = newline + 1;
+
+    if (StartsWith(line, "///")) {
+      push(Trim(line.substr(3)));
+    } else if (StartsWith(line, "/**")) {
+      line = Trim(line.substr(3));
+      if (EndsWith(line, "*/")) {
+        line = Trim(line.substr(0, line.size() - 2));
+      }
+      if (!line.empty()) {
+        push(line);
+      }
+    } else if (StartsWith(line, "*")) {
+      line = Trim(line.substr(1));
+      if (EndsWith(line, "*/")) {
+        line = Trim(line.substr(0, line.size() - 2));
+      }
+      if (line != "/") {
+        push(line);
+      }
+    } else if (EndsWith(line, "*/")) {
+      line = Trim(line.substr(0, line.size() - 2));
+      if (!line.empty()) {
+        push(line);
+      }
+    }
+  }
+  return Trim(doc);
+}
+
+void WriteDocumentation(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  if (!options.include_documentation) {
+    return;
+  }
+  std::string doc = CleanDocumentation(TakeString(clang_Cursor_getRawCommentText(cursor)));
+  if (!doc.empty()) {
+    out.Key("documentation");
+    out.String(doc);
+  }
+}
+
+void WriteTypeInfo(JsonWriter& out, CXType type);
+
+// clang_getPointeeType and clang_getArrayElementType do not look through
+// typedefs; the canonical type's answer loses the sugar but is always there
+CXType Desugared(CXType (*get)(CXType), CXType type, CXType canonical) {
+  CXType result = get(type);
+  return result.kind != CXType_Invalid ? result : get(canonical);
+}
+
+// The structure of a type as TypeInfo describes it: kinds, constness and,
+// depending on the canonical kind, the pointee, array element, function
+// signature or declaring record/enum
+void WriteTypeStructure(JsonWriter& out, CXType type) {
+  CXType canonical = clang_getCanonicalType(type);
+  out.Key("kind");
+  out.Int(type.kind);
+  if (canonical.kind != type.kind) {
+    out.Key("canonicalKind");
+    out.Int(canonical.kind);
+  }
+  if (clang_isConstQualifiedType(type) != 0) {
+    out.Key("isConst");
+    out.Bool(true);
+  }
+  switch (canonical.kind) {
+    case CXType_Pointer:
+    case CXType_BlockPointer: {
+      CXType pointee = Desugared(clang_getPointeeType, type, canonical);
+      CXTypeKind pointee_kind = clang_getCanonicalType(pointee).kind;
+      out.Key("isPointer");
+      out.Bool(true);
+      if (canonical.kind == CXType_BlockPointer || pointee_kind == CXType_FunctionProto ||
+          pointee_kind == CXType_FunctionNoProto) {
+        out.Key("isFunctionPointer");
+        out.Bool(true);
+      }
+      out.Key("pointeeType");
+      WriteTypeInfo(out, pointee);
+      break;
+    }
+    case CXType_ConstantArray:
+      out.Key("elementType");
+      WriteTypeInfo(out, Desugared(clang_getArrayElementType, type, canonical));
+      out.Key("arraySize");
+      out.Int(clang_getArraySize(canonical));
+      break;
+    case CXType_FunctionProto:
+    case CXType_FunctionNoProto: {
+      out.Key("resultType");
+      WriteTypeInfo(out, clang_getResultType(type));
+      out.Key("argTypes");
+      out.BeginArray();
+      int count = clang_getNumArgTypes(type);
+      for (int i = 0; i < count; i++) {
+        WriteTypeInfo(out, clang_getArgType(type, static_cast<unsigned>(i)));
+      }
+      out.EndArray();
+      break;
+    }
+    case CXType_Record:
+    case CXType_Enum: {
+      std::string name = TakeString(clang_getCursorSpelling(clang_getTypeDeclaration(canonical)));
+      if (!name.empty()) {
+        out.Key("declaration");
+        out.String(name);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void WriteTypeInfo(JsonWriter& out, CXType type) {
+  // Indexed by CXTypeNullabilityKind; CXTypeNullability_Invalid (3) has no entry
+  static const char* const kNullability[] = {"nonnull", "nullable", "unspecified", nullptr,
+                                             "nullable_result"};
+  out.BeginObject();
+  out.Key("spelling");
+  out.String(TakeString(clang_getTypeSpelling(type)));
+  int nullability = clang_Type_getNullability(type);
+  if (nullability >= 0 && nullability < 5 && kNullability[nullability] != nullptr) {
+    out.Key("nullability");
+    out.String(kNullability[nullability]);
+  }
+  WriteTypeStructure(out, type);
+  out.EndObject();
+}
+
+void WriteParams(JsonWriter& out, CXCursor cursor) {
+  out.Key("params");
+  out.BeginArray();
+  int count = clang_Cursor_getNumArguments(cursor);
+  for (int i = 0; i < count; i++) {
+    CXCursor arg = clang_Cursor_getArgument(cursor, static_cast<unsigned>(i));
+    out.BeginObject();
+    out.Key("name");
+    out.String(TakeString(clang_getCursorSpelling(arg)));
+    out.Key("type");
+    WriteTypeInfo(out, clang_getCursorType(arg));
+    out.EndObject();
+  }
+  out.EndArray();
+}
+
+void WriteMethod(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  out.BeginObject();
+  out.Key("kind");
+  out.String(clang_getCursorKind(cursor) == CXCursor_ObjCClassMethodDecl ? "class" : "instance");
+  out.Key("selector");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  out.Key("return");
+  WriteTypeInfo(out, clang_getCursorResultType(cursor));
+  WriteParams(out, cursor);
+  WriteDocumentation(out, cursor, options);
+  out.EndObject();
+}
+
+void WriteProperty(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  out.Key("type");
+  WriteTypeInfo(out, clang_getCursorType(cursor));
+  WriteDocumentation(out, cursor, options);
+  out.EndObject();
+}
+
+// Members of an ObjC interface/protocol or C++ class, split by kind
+struct MemberWalk {
+  const ExtractOptions* options;
+  bool cxx_methods;
+  JsonWriter methods;
+  JsonWriter properties;
+  JsonWriter protocols;
+};
+
+CXChildVisitResult VisitMember(CXCursor child, CXCursor /*parent*/, CXClientData client_data) {
+  auto* walk = static_cast<MemberWalk*>(client_data);
+  CXCursorKind kind = clang_getCursorKind(child);
+  if (kind == CXCursor_ObjCInstanceMethodDecl || kind == CXCursor_ObjCClassMethodDecl ||
+      (walk->cxx_methods && kind == CXCursor_CXXMethod)) {
+    WriteMethod(walk->methods, child, *walk->options);
+  } else if (kind == CXCursor_ObjCPropertyDecl) {
+    WriteProperty(walk->properties, child, *walk->options);
+  } else if (kind == CXCursor_ObjCProtocolRef) {
+    walk->protocols.String(TakeString(clang_getCursorSpelling(child)));
+  }
+  return CXChildVisit_Continue;
+}
+
+// Same for every TU that sees the declaration; codegen dedupes the ASTs of
+// several headers by it
+void WriteUsr(JsonWriter& out, CXCursor cursor) {
+  std::string usr = TakeString(clang_getCursorUSR(cursor));
+  if (!usr.empty()) {
+    out.Key("usr");
+    out.String(usr);
+  }
+}
+
+void WriteMembers(JsonWriter& out, const char* key, const JsonWriter& members) {
+  out.Key(key);
+  out.BeginArray();
+  out.RawElements(members);
+  out.EndArray();
+}
+
+// Interfaces and C++ classes: name, methods, properties, protocols
+void WriteInterface(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  MemberWalk members{&options, true, {}, {}, {}};
+  clang_visitChildren(cursor, VisitMember, &members);
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  WriteMembers(out, "methods", members.methods);
+  WriteMembers(out, "properties", members.properties);
+  WriteMembers(out, "protocols", members.protocols);
+  WriteDocumentation(out, cursor, options);
+  out.EndObject();
+}
+
+void WriteProtocol(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  MemberWalk members{&options, false, {}, {}, {}};
+  clang_visitChildren(cursor, VisitMember, &members);
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  WriteMembers(out, "methods", members.methods);
+  WriteMembers(out, "properties", members.properties);
+  WriteDocumentation(out, cursor, options);
+  out.EndObject();
+}
+
+struct ConstantWalk {
+  const ExtractOptions* options;
+  JsonWriter* out;
+};
+
+CXChildVisitResult VisitEnumConstant(CXCursor child, CXCursor /*parent*/, CXClientData client_data) {
+  auto* walk = static_cast<ConstantWalk*>(client_data);
+  if (clang_getCursorKind(child) != CXCursor_EnumConstantDecl) {
+    return CXChildVisit_Continue;
+  }
+  JsonWriter& out = *walk->out;
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(child)));
+  out.Key("value");
+  // Values outside the safe integer range stay exact as strings
+  const int64_t kMaxSafeInteger = (int64_t{1} << 53) - 1;
+  long long value = clang_getEnumConstantDeclValue(child);
+  if (value >= -kMaxSafeInteger && value <= kMaxSafeInteger) {
+    out.Int(value);
+  } else {
+    out.String(std::to_string(value));
+  }
+  WriteDocumentation(out, child, *walk->options);
+  out.EndObject();
+  return CXChildVisit_Continue;
+}
+
+void WriteEnum(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  out.Key("constants");
+  out.BeginArray();
+  ConstantWalk walk{&options, &out};
+  clang_visitChildren(cursor, VisitEnumConstant, &walk);
+  out.EndArray();
+  WriteDocumentation(out, cursor, options);
+  WriteUsr(out, cursor);
+  out.EndObject();
+}
+
+CXChildVisitResult VisitStructField(CXCursor child, CXCursor /*parent*/, CXClientData client_data) {
+  if (clang_getCursorKind(child) != CXCursor_FieldDecl) {
+    return CXChildVisit_Continue;
+  }
+  auto& out = *static_cast<JsonWriter*>(client_data);
+  CXType type = clang_getCursorType(child);
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(child)));
+  out.Key("type");
+  out.String(TakeString(clang_getTypeSpelling(type)));
+  out.Key("typeInfo");
+  WriteTypeInfo(out, type);
+  // Offsets are reported in bits; bit-fields get none
+  long long offset_bits = clang_Cursor_getOffsetOfField(child);
+  if (offset_bits >= 0 && offset_bits % 8 == 0 && clang_Cursor_isBitField(child) == 0) {
+    out.Key("offset");
+    out.Int(offset_bits / 8);
+  }
+  long long size = clang_Type_getSizeOf(type);
+  if (size >= 0) {
+    out.Key("size");
+    out.Int(size);
+  }
+  out.EndObject();
+  return CXChildVisit_Continue;
+}
+
+void WriteStruct(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  out.Key("fields");
+  out.BeginArray();
+  clang_visitChildren(cursor, VisitStructField, &out);
+  out.EndArray();
+  out.Key("kind");
+  out.String(clang_getCursorKind(cursor) == CXCursor_UnionDecl ? "union" : "struct");
+  WriteDocumentation(out, cursor, options);
+  // Negative sizes are CXTypeLayoutError codes (incomplete, dependent, ...)
+  long long size = clang_Type_getSizeOf(clang_getCursorType(cursor));
+  if (size >= 0) {
+    out.Key("size");
+    out.Int(size);
+  }
+  WriteUsr(out, cursor);
+  out.EndObject();
+}
+
+void WriteTypedef(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  CXType underlying = clang_getTypedefDeclUnderlyingType(cursor);
+  out.Key("underlying");
+  out.String(TakeString(clang_getTypeSpelling(underlying)));
+  out.Key("underlyingType");
+  WriteTypeInfo(out, underlying);
+  out.Key("spelling");
+  out.String(TakeString(clang_getTypeSpelling(clang_getCursorType(cursor))));
+  WriteDocumentation(out, cursor, options);
+  WriteUsr(out, cursor);
+  out.EndObject();
+}
+
+void WriteFunction(JsonWriter& out, CXCursor cursor, const ExtractOptions& options) {
+  out.BeginObject();
+  out.Key("name");
+  out.String(TakeString(clang_getCursorSpelling(cursor)));
+  out.Key("return");
+  WriteTypeInfo(out, clang_getCursorResultType(cursor));
+  WriteParams(out, cursor);
+  WriteDocumentation(out, cursor, options);
+  WriteUsr(out, cursor);
+  out.EndObject();
+}
+
+// Pre-order over every cursor, like the JS walker's recursive visitNode
+CXChildVisitResult VisitNode(CXCursor cursor, CXCursor /*parent*/, CXClientData client_data) {
+  auto* walk = static_cast<HeaderWalk*>(client_data);
+  const ExtractOptions& options = walk->options;
+  switch (clang_getCursorKind(cursor)) {
+    case CXCursor_ObjCInterfaceDecl:
+      WriteInterface(walk->interfaces, cursor, options);
+      break;
+    case CXCursor_ObjCProtocolDecl:
+      WriteProtocol(walk->protocols, cursor, options);
+      break;
+    case CXCursor_ClassDecl:
+      WriteInterface(walk->classes, cursor, options);
+      break;
+    case CXCursor_EnumDecl:
+      WriteEnum(walk->enums, cursor, options);
+      break;
+    case CXCursor_StructDecl:
+    case CXCursor_UnionDecl:
+      WriteStruct(walk->structs, cursor, options);
+      break;
+    case CXCursor_TypedefDecl:
+      WriteTypedef(walk->typedefs, cursor, options);
+      break;
+    case CXCursor_FunctionDecl:
+      WriteFunction(walk->functions, cursor, options);
+      break;
+    default:
+      break;
+  }
+  return CXChildVisit_Recurse;
+}
+
+ExtractOptions ReadOptions(const Napi::Value& value) {
+  ExtractOptions options;
+  if (!value.IsObject()) {
+    return options;
+  }
+  Napi::Value documentation = value.As<Napi::Object>().Get("includeDocumentation");
+  if (!documentation.IsUndefined()) {
+    options.include_documentation = documentation.ToBoolean().Value();
+  }
+  return options;
+}
+
+// extractHeaderAST(tu, options?) -> JSON text of the HeaderAST arrays
+Napi::Value ExtractHeaderAST(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  CXTranslationUnit tu = nullptr;
+  if (info.Length() < 1 || !UnwrapHandle(info[0], &tu) || tu == nullptr) {
+    return ThrowTypeError(env, "Expected CXTranslationUnit");
+  }
+
+  HeaderWalk walk;
+  if (info.Length() > 1) {
+    walk.options = ReadOptions(info[1]);
+  }
+  clang_visitChildren(clang_getTranslationUnitCursor(tu), VisitNode, &walk);
+
+  JsonWriter result;
+  result.BeginObject();
+  WriteMembers(result, "interfaces", walk.interfaces);
+  WriteMembers(result, "protocols", walk.protocols);
+  WriteMembers(result, "enums", walk.enums);
+  WriteMembers(result, "structs", walk.structs);
+  WriteMembers(result, "typedefs", walk.typedefs);
+  WriteMembers(result, "functions", walk.functions);
+  WriteMembers(result, "classes", walk.classes);
+  result.EndObject();
+  return Napi::String::New(env, result.str());
+}
+
+}  // namespace
+
+void RegisterHeaderAST(Napi::Env env, Napi::Object exports) {
+  exports.Set("extractHeaderAST", Napi::Function::New(env, ExtractHeaderAST));
+}
@@ -0,0 +1,158 @@
+// Native include-graph builder on top of clang_getInclusions.
+//
+// Files are identified by path so graphs from several translation units can
+// be merged; an edge is (includer, included, offset of the #include in the
+// includer) and keeps the smallest depth seen across the batch.
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
+#include "extensions.h"
+
+namespace {
+
+struct EdgeKey {
+  uint32_t includer;
+  uint32_t included;
+  uint32_t offset;
+
+  bool operator==(const EdgeKey& other) const {
+    return std::tie(includer, included, offset) ==
+           std::tie(other.includer, other.included, other.offset);
+  }
+};
+
+struct EdgeKeyHash {
+  size_t operator()(const EdgeKey& key) const {
+    size_t hash = std::hash<uint32_t>()(key.includer);
+    hash = hash * 31 + std::hash<uint32_t>()(key.included);
+    hash = hash * 31 + std::hash<uint32_t>()(key.offset);
+    return hash;
+  }
+};
+
+struct IncludeGraph {
+  std::vector<std::string> files;
+  std::unordered_map<std::string, uint32_t> file_ids;
+
+  std::vector<uint32_t> includer;
+  std::vector<uint32_t> included;
+  std::vector<uint32_t> offset;
+  std::vector<uint32_t> depth;
+  std::unordered_map<EdgeKey, uint32_t, EdgeKeyHash> edge_ids;
+
+  // Main file of each translation unit, in input order
+  std::vector<uint32_t> roots;
+
+  uint32_t InternFile(std::string path) {
+    auto it = file_ids.find(path);
+    if (it != file_ids.end()) {
+      return it->second;
+    }
+    auto id = static_cast<uint32_t>(files.size());
+    file_ids.emplace(path, id);
+    files.push_back(std::move(path));
+    return id;
+  }
+
+  void AddEdge(uint32_t from, uint32_t to, uint32_t at, uint32_t level) {
+    EdgeKey key{from, to, at};
+    auto it = edge_ids.find(key);
+    if (it != edge_ids.end()) {
+      uint32_t& existing = depth[it->second];
+      existing = std::min(existing, level);
+      return;
+    }
+    edge_ids.emplace(key, static_cast<uint32_t>(includer.size()));
+    includer.push_back(from);
+    included.push_back(to);
+    offset.push_back(at);
+    depth.push_back(level);
+  }
+};
+
+// Per-TU state: CXFile handles are only meaningful within one TU, so the
+// handle -> id cache is reset for every unit.
+struct InclusionWalk {
+  IncludeGraph* graph;
+  std::unordered_map<CXFile, uint32_t> file_cache;
+  uint32_t root = 0;
+
+  uint32_t FileId(CXFile file) {
+    auto it = file_cache.find(file);
+    if (it != file_cache.end()) {
+      return it->second;
+    }
+    uint32_t id = graph->InternFile(TakeString(clang_getFileName(file)));
+    file_cache.emplace(file, id);
+    return id;
+  }
+};
+
+void VisitInclusion(CXFile included_file,
+                    CXSourceLocation* inclusion_stack,
+                    unsigned include_len,
+                    CXClientData client_data) {
+  auto* walk = static_cast<InclusionWalk*>(client_data);
+  uint32_t to = walk->FileId(included_file);
+  if (include_len == 0) {
+    walk->root = to;
+    return;
+  }
+
+  // inclusion_stack[0] is the #include directive in the direct includer
+  CXFile includer_file = nullptr;
+  unsigned at = 0;
+  clang_getFileLocation(inclusion_stack[0], &includer_file, nullptr, nullptr, &at);
+  if (includer_file == nullptr) {
+    return;
+  }
+  walk->graph->AddEdge(walk->FileId(includer_file), to, at, include_len);
+}
+
+void CollectInclusions(CXTranslationUnit tu, IncludeGraph* graph) {
+  InclusionWalk walk{graph, {}, 0};
+  clang_getInclusions(tu, VisitInclusion, &walk);
+  graph->roots.push_back(walk.root);
+}
+
+// getIncludeGraph(tu | tu[]) -> IncludeGraph
+Napi::Value GetIncludeGraph(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1) {
+    return ThrowTypeError(env, "Expected CXTranslationUnit or array of CXTranslationUnit");
+  }
+
+  IncludeGraph graph;
+  if (info[0].IsArray()) {
+    Napi::Array units = info[0].As<Napi::Array>();
+    for (uint32_t i = 0; i < units.Length(); i++) {
+      CXTranslationUnit tu = nullptr;
+      if (!UnwrapHandle(units.Get(i), &tu) || tu == nullptr) {
+        return ThrowTypeError(env, "Expected array of CXTranslationUnit");
+      }
+      CollectInclusions(tu, &graph);
+    }
+  } else {
+    CXTranslationUnit tu = nullptr;
+    if (!UnwrapHandle(info[0], &tu) || tu == nullptr) {
+      return ThrowTypeError(env, "Expected CXTranslationUnit or array of CXTranslationUnit");
+    }
+    CollectInclusions(tu, &graph);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("files", ToStringArray(env, graph.files));
+  result.Set("includer", ToTypedArray(env, graph.includer));
+  result.Set("included", ToTypedArray(env, graph.included));
+  result.Set("offset", ToTypedArray(env, graph.offset));
+  result.Set("depth", ToTypedArray(env, graph.depth));
+  result.Set("roots", ToTypedArray(env, graph.roots));
+  return result;
+}
+
+}  // namespace
+
+void RegisterIncludeGraph(Napi::Env env, Napi::Object exports) {
+  exports.Set("getIncludeGraph", Napi::Function::New(env, GetIncludeGraph));
+}
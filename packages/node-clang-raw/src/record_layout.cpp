@@ -0,0 +1,168 @@
+// Native record layout dumper.
+//
+// Walks a translation unit once and returns the layout of every record
+// definition (struct/union/class) in columnar form, so callers never have to
+// visit fields through JS.
+#include <unordered_map>
+
+#include "extensions.h"
+
+namespace {
+
+struct LayoutOptions {
+  bool skip_system_headers = false;
+  bool main_file_only = false;
+};
+
+struct LayoutTable {
+  std::vector<std::string> record_names;
+  std::vector<uint32_t> record_kinds;
+  std::vector<double> record_sizes;
+  std::vector<double> record_aligns;
+  std::vector<uint32_t> record_first_field;
+  std::vector<uint32_t> record_field_count;
+
+  std::vector<std::string> field_names;
+  std::vector<uint32_t> field_types;
+  std::vector<double> field_offsets;
+  std::vector<int32_t> field_bit_widths;
+  std::vector<double> field_sizes;
+  std::vector<double> field_aligns;
+
+  // Type spellings repeat a lot (int, double, ...), so fields reference an
+  // interned table instead of carrying their own string.
+  std::vector<std::string> type_names;
+  std::unordered_map<std::string, uint32_t> type_ids;
+
+  uint32_t InternType(std::string name) {
+    auto it = type_ids.find(name);
+    if (it != type_ids.end()) {
+      return it->second;
+    }
+    auto id = static_cast<uint32_t>(type_names.size());
+    type_ids.emplace(name, id);
+    type_names.push_back(std::move(name));
+    return id;
+  }
+};
+
+struct LayoutWalk {
+  LayoutOptions options;
+  LayoutTable table;
+};
+
+bool IsRecordKind(CXCursorKind kind) {
+  return kind == CXCursor_StructDecl || kind == CXCursor_UnionDecl || kind == CXCursor_ClassDecl;
+}
+
+// Only these containers can hold record definitions we care about; skipping
+// everything else keeps us out of function bodies and initializers.
+bool MayContainRecords(CXCursorKind kind) {
+  return IsRecordKind(kind) || kind == CXCursor_Namespace || kind == CXCursor_LinkageSpec ||
+         kind == CXCursor_UnexposedDecl;
+}
+
+CXVisitorResult VisitField(CXCursor field, CXClientData client_data) {
+  auto* table = static_cast<LayoutTable*>(client_data);
+  CXType type = clang_getCursorType(field);
+  table->field_names.push_back(TakeString(clang_getCursorSpelling(field)));
+  table->field_types.push_back(table->InternType(TakeString(clang_getTypeSpelling(type))));
+  // clang_Cursor_getOffsetOfField is the cursor form of clang_Type_getOffsetOf
+  // and avoids a by-name lookup per field (and works for anonymous members).
+  table->field_offsets.push_back(static_cast<double>(clang_Cursor_getOffsetOfField(field)));
+  table->field_bit_widths.push_back(clang_getFieldDeclBitWidth(field));
+  table->field_sizes.push_back(static_cast<double>(clang_Type_getSizeOf(type)));
+  table->field_aligns.push_back(static_cast<double>(clang_Type_getAlignOf(type)));
+  return CXVisit_Continue;
+}
+
+void AddRecord(CXCursor record, LayoutTable* table) {
+  CXType type = clang_getCursorType(record);
+  table->record_names.push_back(TakeString(clang_getTypeSpelling(type)));
+  table->record_kinds.push_back(static_cast<uint32_t>(clang_getCursorKind(record)));
+  table->record_sizes.push_back(static_cast<double>(clang_Type_getSizeOf(type)));
+  table->record_aligns.push_back(static_cast<double>(clang_Type_getAlignOf(type)));
+
+  auto first = static_cast<uint32_t>(table->field_names.size());
+  clang_Type_visitFields(type, VisitField, table);
+  table->record_first_field.push_back(first);
+  table->record_field_count.push_back(static_cast<uint32_t>(table->field_names.size()) - first);
+}
+
+CXChildVisitResult VisitNode(CXCursor cursor, CXCursor /*parent*/, CXClientData client_data) {
+  auto* walk = static_cast<LayoutWalk*>(client_data);
+  CXCursorKind kind = clang_getCursorKind(cursor);
+  if (!MayContainRecords(kind)) {
+    return CXChildVisit_Continue;
+  }
+
+  CXSourceLocation location = clang_getCursorLocation(cursor);
+  if (walk->options.skip_system_headers && clang_Location_isInSystemHeader(location) != 0) {
+    return CXChildVisit_Continue;
+  }
+  if (walk->options.main_file_only && clang_Location_isFromMainFile(location) == 0) {
+    return CXChildVisit_Continue;
+  }
+
+  if (IsRecordKind(kind) && clang_isCursorDefinition(cursor) != 0) {
+    AddRecord(cursor, &walk->table);
+  }
+  return CXChildVisit_Recurse;
+}
+
+LayoutOptions ReadOptions(const Napi::Value& value) {
+  LayoutOptions options;
+  if (!value.IsObject()) {
+    return options;
+  }
+  Napi::Object obj = value.As<Napi::Object>();
+  options.skip_system_headers = obj.Get("skipSystemHeaders").ToBoolean().Value();
+  options.main_file_only = obj.Get("mainFileOnly").ToBoolean().Value();
+  return options;
+}
+
+// getRecordLayouts(tu, options?) -> RecordLayoutTable
+Napi::Value GetRecordLayouts(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  CXTranslationUnit tu = nullptr;
+  if (info.Length() < 1 || !UnwrapHandle(info[0], &tu) || tu == nullptr) {
+    return ThrowTypeError(env, "Expected CXTranslationUnit");
+  }
+
+  LayoutWalk walk;
+  if (info.Length() > 1) {
+    walk.options = ReadOptions(info[1]);
+  }
+  clang_visitChildren(clang_getTranslationUnitCursor(tu), VisitNode, &walk);
+
+  const LayoutTable& table = walk.table;
+
+  Napi::Object records = Napi::Object::New(env);
+  records.Set("name", ToStringArray(env, table.record_names));
+  records.Set("kind", ToTypedArray(env, table.record_kinds));
+  records.Set("size", ToTypedArray(env, table.record_sizes));
+  records.Set("align", ToTypedArray(env, table.record_aligns));
+  records.Set("firstField", ToTypedArray(env, table.record_first_field));
+  records.Set("fieldCount", ToTypedArray(env, table.record_field_count));
+
+  Napi::Object fields = Napi::Object::New(env);
+  fields.Set("name", ToStringArray(env, table.field_names));
+  fields.Set("type", ToTypedArray(env, table.field_types));
+  fields.Set("offset", ToTypedArray(env, table.field_offsets));
+  fields.Set("bitWidth", ToTypedArray(env, table.field_bit_widths));
+  fields.Set("size", ToTypedArray(env, table.field_sizes));
+  fields.Set("align", ToTypedArray(env, table.field_aligns));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("records", records);
+  result.Set("fields", fields);
+  result.Set("types", ToStringArray(env, table.type_names));
+  return result;
+}
+
+}  // namespace
+
+void RegisterRecordLayout(Napi::Env env, Napi::Object exports) {
+  exports.Set("getRecordLayouts", Napi::Function::New(env, GetRecordLayouts));
+}
@@ -0,0 +1,234 @@
+// Native clang_findReferencesInFile / clang_findIncludesInFile.
+//
+// Matches are collected into Uint32Array offset pairs [start, end, ...] in the
+// searched file. findReferencesInTUs fans a single cursor's search out across
+// many translation units on worker threads.
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+
+#include "extensions.h"
+
+namespace {
+
+CXVisitorResult CollectRange(void* context, CXCursor /*cursor*/, CXSourceRange range) {
+  auto* offsets = static_cast<std::vector<uint32_t>*>(context);
+  unsigned start = 0;
+  unsigned end = 0;
+  clang_getFileLocation(clang_getRangeStart(range), nullptr, nullptr, nullptr, &start);
+  clang_getFileLocation(clang_getRangeEnd(range), nullptr, nullptr, nullptr, &end);
+  offsets->push_back(start);
+  offsets->push_back(end);
+  return CXVisit_Continue;
+}
+
+CXResult FindReferences(CXCursor cursor, CXFile file, std::vector<uint32_t>* offsets) {
+  CXCursorAndRangeVisitor visitor{offsets, CollectRange};
+  return clang_findReferencesInFile(cursor, file, visitor);
+}
+
+Napi::Value RangesOrThrow(Napi::Env env,
+                          CXResult result,
+                          const std::vector<uint32_t>& offsets,
+                          const char* what) {
+  if (result == CXResult_Invalid) {
+    Napi::Error::New(env, std::string(what) + " failed: invalid cursor or file")
+        .ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+  return ToTypedArray(env, offsets);
+}
+
+// findReferencesInFile(cursor, file) -> Uint32Array
+Napi::Value FindReferencesInFile(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  CXCursor cursor;
+  CXFile file = nullptr;
+  if (info.Length() < 2 || !UnwrapHandle(info[0], &cursor) || !UnwrapHandle(info[1], &file)) {
+    return ThrowTypeError(env, "Expected (CXCursor, CXFile)");
+  }
+
+  std::vector<uint32_t> offsets;
+  CXResult result = FindReferences(cursor, file, &offsets);
+  return RangesOrThrow(env, result, offsets, "clang_findReferencesInFile");
+}
+
+// findIncludesInFile(tu, file) -> Uint32Array
+Napi::Value FindIncludesInFile(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  CXTranslationUnit tu = nullptr;
+  CXFile file = nullptr;
+  if (info.Length() < 2 || !UnwrapHandle(info[0], &tu) || !UnwrapHandle(info[1], &file)) {
+    return ThrowTypeError(env, "Expected (CXTranslationUnit, CXFile)");
+  }
+
+  std::vector<uint32_t> offsets;
+  CXCursorAndRangeVisitor visitor{&offsets, CollectRange};
+  CXResult result = clang_findIncludesInFile(tu, file, visitor);
+  return RangesOrThrow(env, result, offsets, "clang_findIncludesInFile");
+}
+
+struct ReferenceTarget {
+  std::string file;  // empty: main file of the TU
+  std::vector<uint32_t> offsets;
+  bool found = false;
+};
+
+// The targets that search one translation unit. `handle` pins the JS object
+// behind `tu`, whose finalizer would otherwise dispose it mid-search.
+struct TranslationUnitTargets {
+  CXTranslationUnit tu = nullptr;
+  Napi::ObjectReference handle;
+  std::vector<size_t> targets;
+};
+
+// Cursors are TU-bound, so each target TU re-resolves the declaration from its
+// file/offset before searching. A libclang TU must not be used from two
+// threads at once, so each TU's targets run in turn on one thread, while
+// different TUs run in parallel. Callers must not touch the TUs from JS until
+// the promise settles.
+class FindReferencesWorker : public Napi::AsyncWorker {
+ public:
+  FindReferencesWorker(Napi::Env env,
+                       std::string decl_file,
+                       unsigned decl_offset,
+                       std::vector<ReferenceTarget> targets,
+                       std::vector<TranslationUnitTargets> groups)
+      : Napi::AsyncWorker(env),
+        deferred_(Napi::Promise::Deferred::New(env)),
+        decl_file_(std::move(decl_file)),
+        decl_offset_(decl_offset),
+        targets_(std::move(targets)),
+        groups_(std::move(groups)) {}
+
+  Napi::Promise Promise() const {
+    return deferred_.Promise();
+  }
+
+ protected:
+  void Execute() override {
+    size_t concurrency = std::max(1U, std::thread::hardware_concurrency());
+    size_t thread_count = std::min(concurrency, groups_.size());
+    std::atomic<size_t> next{0};
+    auto run = [this, &next]() {
+      for (size_t i = next++; i < groups_.size(); i = next++) {
+        for (size_t target : groups_[i].targets) {
+          Search(groups_[i].tu, &targets_[target]);
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_count; i++) {
+      threads.emplace_back(run);
+    }
+    run();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::Array results = Napi::Array::New(env, targets_.size());
+    for (uint32_t i = 0; i < targets_.size(); i++) {
+      const ReferenceTarget& target = targets_[i];
+      results.Set(i, target.found ? ToTypedArray(env, target.offsets) : env.Null());
+    }
+    deferred_.Resolve(results);
+    groups_.clear();
+  }
+
+  void OnError(const Napi::Error& error) override {
+    deferred_.Reject(error.Value());
+    groups_.clear();
+  }
+
+ private:
+  void Search(CXTranslationUnit tu, ReferenceTarget* target) const {
+    std::string path = target->file.empty() ? TakeString(clang_getTranslationUnitSpelling(tu))
+                                            : target->file;
+    CXFile file = clang_getFile(tu, path.c_str());
+    if (file == nullptr) {
+      return;
+    }
+    target->found = true;
+
+    // A TU that never includes the declaring file has no references
+    CXFile decl_file = clang_getFile(tu, decl_file_.c_str());
+    if (decl_file == nullptr) {
+      return;
+    }
+    CXCursor decl = clang_getCursor(tu, clang_getLocationForOffset(tu, decl_file, decl_offset_));
+    if (clang_Cursor_isNull(decl) != 0) {
+      return;
+    }
+    FindReferences(decl, file, &target->offsets);
+  }
+
+  Napi::Promise::Deferred deferred_;
+  std::string decl_file_;
+  unsigned decl_offset_;
+  std::vector<ReferenceTarget> targets_;
+  std::vector<TranslationUnitTargets> groups_;
+};
+
+// findReferencesInTUs(cursor, [{ tu, file? }]) -> Promise<(Uint32Array | null)[]>
+Napi::Value FindReferencesInTUs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  CXCursor cursor;
+  if (info.Length() < 2 || !UnwrapHandle(info[0], &cursor) || !info[1].IsArray()) {
+    return ThrowTypeError(env, "Expected (CXCursor, Array<{ tu, file? }>)");
+  }
+
+  // Search for the referenced declaration, not the reference itself
+  CXCursor decl = clang_getCursorReferenced(cursor);
+  if (clang_Cursor_isNull(decl) != 0) {
+    decl = cursor;
+  }
+  CXFile decl_file = nullptr;
+  unsigned decl_offset = 0;
+  clang_getFileLocation(clang_getCursorLocation(decl), &decl_file, nullptr, nullptr, &decl_offset);
+  if (decl_file == nullptr) {
+    return ThrowTypeError(env, "Cursor has no file location");
+  }
+
+  Napi::Array entries = info[1].As<Napi::Array>();
+  std::vector<ReferenceTarget> targets(entries.Length());
+  std::vector<TranslationUnitTargets> groups;
+  for (uint32_t i = 0; i < entries.Length(); i++) {
+    Napi::Value entry = entries.Get(i);
+    Napi::Value handle = entry.IsObject() ? entry.As<Napi::Object>().Get("tu") : env.Undefined();
+    CXTranslationUnit tu = nullptr;
+    if (!UnwrapHandle(handle, &tu)) {
+      return ThrowTypeError(env, "Expected { tu: CXTranslationUnit, file?: string }");
+    }
+    Napi::Value file = entry.As<Napi::Object>().Get("file");
+    if (file.IsString()) {
+      targets[i].file = file.As<Napi::String>().Utf8Value();
+    }
+
+    auto group = std::find_if(groups.begin(), groups.end(),
+                              [tu](const TranslationUnitTargets& g) { return g.tu == tu; });
+    if (group == groups.end()) {
+      groups.push_back({tu, Napi::Persistent(handle.As<Napi::Object>()), {}});
+      group = std::prev(groups.end());
+    }
+    group->targets.push_back(i);
+  }
+
+  auto* worker = new FindReferencesWorker(env, TakeString(clang_getFileName(decl_file)),
+                                          decl_offset, std::move(targets), std::move(groups));
+  Napi::Promise promise = worker->Promise();
+  worker->Queue();
+  return promise;
+}
+
+}  // namespace
+
+void RegisterReferences(Napi::Env env, Napi::Object exports) {
+  exports.Set("findReferencesInFile", Napi::Function::New(env, FindReferencesInFile));
+  exports.Set("findIncludesInFile", Napi::Function::New(env, FindIncludesInFile));
+  exports.Set("findReferencesInTUs", Napi::Function::New(env, FindReferencesInTUs));
+}
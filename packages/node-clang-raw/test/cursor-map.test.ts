@@ -0,0 +1,61 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import * as clang from '../index.ts';
+
+describe('CursorMap / CursorSet', () => {
+  it('keys entries by cursor identity', () => {
+    const dir = mkdtempSync(join(tmpdir(), 'cursor-map-'));
+    const source = 'int a;\nint b;\nint c;\n';
+    const file = join(dir, 'input.c');
+    writeFileSync(file, source);
+
+    const index = clang.clang_createIndex(0, 0);
+    const tu = clang.clang_parseTranslationUnit(
+      index,
+      file,
+      null as any,
+      0,
+      null as any,
+      0,
+      0,
+    );
+    try {
+      const cxFile = clang.clang_getFile(tu, file);
+      const at = (name: string) =>
+        clang.clang_getCursor(
+          tu,
+          clang.clang_getLocationForOffset(tu, cxFile, source.indexOf(name)),
+        );
+      const [a, b, c] = [at('a;'), at('b;'), at('c;')];
+
+      const map = new clang.CursorMap<string>();
+      map.set(a, 'a').setMany([b, c], ['b', 'c']);
+      assert.equal(map.size, 3);
+      // A fresh handle for the same cursor finds the entry
+      assert.equal(map.get(at('a;')), 'a');
+      assert.deepEqual(map.getMany([c, b]), ['c', 'b']);
+
+      assert.equal(map.delete(b), true);
+      assert.equal(map.delete(b), false);
+      assert.deepEqual([...map.hasMany([a, b, c])], [1, 0, 1]);
+      map.set(b, 'b2');
+      assert.equal(map.get(b), 'b2');
+      assert.equal(map.keys().length, 3);
+      // Keys pin the translation unit like the handles they were stored from
+      assert.ok(map.keys().every((key) => (key as any)._owner === tu));
+
+      const set = new clang.CursorSet();
+      assert.deepEqual([...set.addMany([a, b, at('a;')])], [1, 1, 0]);
+      assert.equal(set.size, 2);
+      assert.deepEqual([...set.hasMany([a, c])], [1, 0]);
+
+      assert.throws(() => map.get({} as any), TypeError);
+    } finally {
+      clang.clang_disposeTranslationUnit(tu);
+      clang.clang_disposeIndex(index);
+    }
+  });
+});
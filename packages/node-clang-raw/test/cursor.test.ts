@@ -0,0 +1,92 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import * as clang from '../index.ts';
+
+describe('Cursor', () => {
+  it('computes properties lazily and caches them', () => {
+    const dir = mkdtempSync(join(tmpdir(), 'cursor-'));
+    const source = 'struct Point { int x; int y; };\n';
+    const file = join(dir, 'input.c');
+    writeFileSync(file, source);
+
+    const index = clang.clang_createIndex(0, 0);
+    const tu = clang.clang_parseTranslationUnit(
+      index,
+      file,
+      null as any,
+      0,
+      null as any,
+      0,
+      0,
+    );
+    try {
+      const root = new clang.Cursor(clang.clang_getTranslationUnitCursor(tu));
+      assert.equal(root.kind, clang.CXCursor_TranslationUnit);
+      assert.equal(root.semanticParent, null);
+
+      const point = root.children.find((c) => c.spelling === 'Point');
+      assert.ok(point);
+      assert.equal(point.kind, clang.CXCursor_StructDecl);
+      assert.equal(point.usr, 'c:@S@Point');
+      assert.deepEqual(point.location, {
+        file,
+        line: 1,
+        column: 8,
+        offset: 7,
+      });
+      // The struct's extent ends just past its closing brace
+      assert.equal(point.extent.end.offset, source.indexOf('}') + 1);
+      // Cached: same objects on repeated access
+      assert.equal(point.children, point.children);
+      assert.equal(point.location, point.location);
+
+      const [x, y] = point.children;
+      assert.deepEqual([x?.spelling, y?.spelling], ['x', 'y']);
+      assert.equal(x?.semanticParent?.spelling, 'Point');
+      assert.equal(
+        clang.clang_getCString(clang.clang_getTypeSpelling(x!.type)),
+        'int',
+      );
+    } finally {
+      clang.clang_disposeTranslationUnit(tu);
+      clang.clang_disposeIndex(index);
+    }
+  });
+
+  it('pins the translation unit and disposes handles', () => {
+    const dir = mkdtempSync(join(tmpdir(), 'cursor-'));
+    const file = join(dir, 'input.c');
+    writeFileSync(file, 'int answer;\n');
+
+    const index = clang.clang_createIndex(0, 0);
+    const tu = clang.clang_parseTranslationUnit(
+      index,
+      file,
+      null as any,
+      0,
+      null as any,
+      0,
+      0,
+    );
+    try {
+      const root = clang.clang_getTranslationUnitCursor(tu);
+      const [answer] = new clang.Cursor(root).children;
+      assert.ok(answer);
+      // Cursors from generated and extension calls pin the same TU object
+      assert.equal(clang.clang_Cursor_getTranslationUnit(root), tu);
+      assert.equal(clang.clang_Cursor_getTranslationUnit(answer.handle), tu);
+      assert.equal((answer.type as any)._owner, tu);
+
+      const spelling = clang.clang_getCursorSpelling(answer.handle);
+      assert.equal(clang.clang_getCString(spelling), 'answer');
+      spelling[Symbol.dispose]();
+      clang.clang_disposeString(spelling); // already disposed: no-op
+    } finally {
+      tu[Symbol.dispose]();
+      clang.clang_disposeIndex(index);
+    }
+  });
+});
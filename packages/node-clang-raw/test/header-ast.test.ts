@@ -0,0 +1,97 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import * as clang from '../index.ts';
+
+describe('extractHeaderAST', () => {
+  it('collects declarations in one pass', () => {
+    const dir = mkdtempSync(join(tmpdir(), 'header-ast-'));
+    const file = join(dir, 'input.h');
+    writeFileSync(
+      file,
+      [
+        '/** Primary colors */',
+        'enum Color { RED, GREEN = 5 };',
+        'struct Point { int x; int y; };',
+        'union Bits { int i : 3; float f; };',
+        'typedef struct Point Point2;',
+        '/// Adds two ints',
+        'int add(int a, int b);',
+      ].join('\n'),
+    );
+
+    const index = clang.clang_createIndex(0, 0);
+    const tu = clang.clang_parseTranslationUnit(
+      index,
+      file,
+      null as any,
+      0,
+      null as any,
+      0,
+      0,
+    );
+    try {
+      const ast = clang.extractHeaderAST(tu);
+      assert.deepEqual(ast.enums, [
+        {
+          name: 'Color',
+          constants: [
+            { name: 'RED', value: 0 },
+            { name: 'GREEN', value: 5 },
+          ],
+          documentation: 'Primary colors',
+          usr: 'c:@E@Color',
+        },
+      ]);
+      assert.deepEqual(ast.structs[0], {
+        name: 'Point',
+        fields: [
+          { name: 'x', type: 'int', typeInfo: { spelling: 'int', kind: clang.CXType_Int }, offset: 0, size: 4 },
+          { name: 'y', type: 'int', typeInfo: { spelling: 'int', kind: clang.CXType_Int }, offset: 4, size: 4 },
+        ],
+        kind: 'struct',
+        size: 8,
+        usr: 'c:@S@Point',
+      });
+      // Bit-fields have no byte offset
+      assert.equal(ast.structs[1].kind, 'union');
+      assert.equal(ast.structs[1].fields[0].offset, undefined);
+      const { usr: typedefUsr, underlyingType, ...typedef } = ast.typedefs[0];
+      assert.deepEqual(typedef, {
+        name: 'Point2',
+        underlying: 'struct Point',
+        spelling: 'Point2',
+      });
+      // Typedefs have no linkage, so their USR names the file
+      assert.match(typedefUsr, /^c:input\.h@T@Point2$/);
+      // Type structure sees through the elaborated name to the record
+      assert.deepEqual(underlyingType, {
+        spelling: 'struct Point',
+        kind: clang.CXType_Elaborated,
+        canonicalKind: clang.CXType_Record,
+        declaration: 'Point',
+      });
+      const [add] = ast.functions;
+      assert.equal(add.name, 'add');
+      assert.equal(add.return.spelling, 'int');
+      assert.deepEqual(
+        add.params.map((p: any) => [p.name, p.type.spelling]),
+        [
+          ['a', 'int'],
+          ['b', 'int'],
+        ],
+      );
+      assert.equal(add.documentation, 'Adds two ints');
+      assert.equal(add.usr, 'c:@F@add');
+      assert.equal(add.return.kind, clang.CXType_Int);
+
+      const bare = clang.extractHeaderAST(tu, { includeDocumentation: false });
+      assert.equal(bare.functions[0].documentation, undefined);
+    } finally {
+      clang.clang_disposeTranslationUnit(tu);
+      clang.clang_disposeIndex(index);
+    }
+  });
+});
@@ -0,0 +1,45 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import * as clang from '../index.ts';
+
+describe('getIncludeGraph', () => {
+  it('builds and merges include graphs across TUs', () => {
+    const dir = mkdtempSync(join(tmpdir(), 'include-graph-'));
+    writeFileSync(join(dir, 'common.h'), 'int common(void);\n');
+    writeFileSync(join(dir, 'a.h'), '#include "common.h"\n');
+    writeFileSync(join(dir, 'a.c'), '#include "a.h"\n');
+    writeFileSync(join(dir, 'b.c'), '#include "common.h"\n');
+
+    const index = clang.clang_createIndex(0, 0);
+    const units = ['a.c', 'b.c'].map((name) =>
+      clang.clang_parseTranslationUnit(
+        index,
+        join(dir, name),
+        null as any,
+        0,
+        null as any,
+        0,
+        0,
+      ),
+    );
+    try {
+      const single = clang.getIncludeGraph(units[0]!);
+      assert.equal(single.roots.length, 1);
+      assert.equal(single.included.length, 2);
+      assert.deepEqual([...single.depth].sort(), [1, 2]);
+
+      const merged = clang.getIncludeGraph(units);
+      const id = (name: string) => merged.files.indexOf(join(dir, name));
+      assert.deepEqual([...merged.roots], [id('a.c'), id('b.c')]);
+      assert.equal(merged.included.length, 3);
+      assert.deepEqual(clang.findAffectedRoots(merged, id('common.h')), [0, 1]);
+      assert.deepEqual(clang.findAffectedRoots(merged, id('a.h')), [0]);
+    } finally {
+      for (const tu of units) clang.clang_disposeTranslationUnit(tu);
+      clang.clang_disposeIndex(index);
+    }
+  });
+});
@@ -0,0 +1,54 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import { setFlagsFromString } from 'node:v8';
+import { runInNewContext } from 'node:vm';
+import * as clang from '../index.ts';
+
+setFlagsFromString('--expose-gc');
+const gc: () => void = runInNewContext('gc');
+
+describe('Ownership', () => {
+  it('keeps the translation unit of a visitor cursor alive', async () => {
+    const dir = mkdtempSync(join(tmpdir(), 'ownership-'));
+    const file = join(dir, 'input.c');
+    writeFileSync(file, 'int answer;\n');
+
+    // Nothing but the cursor the visitor received refers to the TU after this
+    const visit = () => {
+      const index = clang.clang_createIndex(0, 0);
+      const tu = clang.clang_parseTranslationUnit(
+        index,
+        file,
+        null as any,
+        0,
+        null as any,
+        0,
+        0,
+      );
+      let cursor: { _type: 'CXCursor' } | undefined;
+      clang.clang_visitChildren(
+        clang.clang_getTranslationUnitCursor(tu),
+        (child) => {
+          cursor = child;
+          return clang.CXChildVisit_Break;
+        },
+      );
+      assert.ok(cursor);
+      assert.equal((cursor as any)._owner, tu);
+      return { cursor, tu: new WeakRef(tu) };
+    };
+    const { cursor, tu } = visit();
+
+    // WeakRef targets are kept until the current job ends
+    await new Promise(setImmediate);
+    gc();
+    assert.ok(tu.deref());
+    assert.equal(
+      clang.clang_getCString(clang.clang_getCursorSpelling(cursor)),
+      'answer',
+    );
+  });
+});
@@ -0,0 +1,54 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import * as clang from '../index.ts';
+
+describe('getRecordLayouts', () => {
+  it('returns columnar layouts for every record in a TU', () => {
+    const dir = mkdtempSync(join(tmpdir(), 'record-layout-'));
+    const file = join(dir, 'layout.h');
+    writeFileSync(
+      file,
+      `struct Point { double x; double y; };
+struct Flags { unsigned a : 3; unsigned b : 5; int c; };
+union Number { int i; double d; };
+`,
+    );
+
+    const index = clang.clang_createIndex(0, 0);
+    const tu = clang.clang_parseTranslationUnit(
+      index,
+      file,
+      ['-x', 'c'] as any,
+      2,
+      null as any,
+      0,
+      0,
+    );
+    try {
+      const layout = clang.getRecordLayouts(tu, { mainFileOnly: true });
+      assert.deepEqual(layout.records.name, [
+        'struct Point',
+        'struct Flags',
+        'union Number',
+      ]);
+      assert.deepEqual([...layout.records.size], [16, 8, 8]);
+      assert.deepEqual([...layout.records.fieldCount], [2, 3, 2]);
+
+      const flags = layout.records.firstField[1]!;
+      const end = flags + 3;
+      assert.deepEqual(layout.fields.name.slice(flags, end), ['a', 'b', 'c']);
+      assert.deepEqual([...layout.fields.offset.subarray(flags, end)], [0, 3, 32]);
+      assert.deepEqual(
+        [...layout.fields.bitWidth.subarray(flags, end)],
+        [3, 5, -1],
+      );
+      assert.equal(layout.types[layout.fields.type[0]!], 'double');
+    } finally {
+      clang.clang_disposeTranslationUnit(tu);
+      clang.clang_disposeIndex(index);
+    }
+  });
+});
@@ -0,0 +1,60 @@
+import assert from 'node:assert/strict';
+import { mkdtempSync, writeFileSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import { join } from 'node:path';
+import { describe, it } from 'node:test';
+import * as clang from '../index.ts';
+
+describe('findReferencesInFile / findReferencesInTUs', () => {
+  it('collects reference ranges locally and across TUs', async () => {
+    const dir = mkdtempSync(join(tmpdir(), 'references-'));
+    const header = 'int counter;\n';
+    const source =
+      '#include "shared.h"\nint read(void) { return counter + counter; }\n';
+    writeFileSync(join(dir, 'shared.h'), header);
+    writeFileSync(join(dir, 'a.c'), source);
+    writeFileSync(join(dir, 'b.c'), source);
+
+    const index = clang.clang_createIndex(0, 0);
+    const parse = (name: string) =>
+      clang.clang_parseTranslationUnit(
+        index,
+        join(dir, name),
+        null as any,
+        0,
+        null as any,
+        0,
+        0,
+      );
+    const a = parse('a.c');
+    const b = parse('b.c');
+    try {
+      const file = clang.clang_getFile(a, join(dir, 'a.c'));
+      const use = source.indexOf('counter');
+      const cursor = clang.clang_getCursor(
+        a,
+        clang.clang_getLocationForOffset(a, file, use),
+      );
+
+      const local = clang.findReferencesInFile(cursor, file);
+      assert.deepEqual([...local], [use, use + 7, use + 10, use + 17]);
+
+      const includes = clang.findIncludesInFile(a, file);
+      assert.equal(includes.length, 2);
+      assert.equal(includes[0], 0);
+
+      const results = await clang.findReferencesInTUs(cursor, [
+        { tu: a },
+        { tu: b },
+        { tu: b, file: join(dir, 'missing.c') },
+      ]);
+      assert.deepEqual([...results[0]!], [...local]);
+      assert.deepEqual([...results[1]!], [...local]);
+      assert.equal(results[2], null);
+    } finally {
+      clang.clang_disposeTranslationUnit(a);
+      clang.clang_disposeTranslationUnit(b);
+      clang.clang_disposeIndex(index);
+    }
+  });
+});
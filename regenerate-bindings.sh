@@ -65,6 +65,30 @@ node --experimental-strip-types packages/codegen/cli.ts \
     -I /opt/homebrew/Cellar/llvm/20.1.8/include \
     -L /opt/homebrew/Cellar/llvm/20.1.8/lib \
     -H clang-c/Index.h \
+    --native-extension RegisterRecordLayout \
+    --ts-extension ./ext/record-layout.ts \
+    --native-extension RegisterIncludeGraph \
+    --ts-extension ./ext/include-graph.ts \
+    --native-extension RegisterReferences \
+    --ts-extension ./ext/references.ts \
+    --native-extension RegisterCursorMap \
+    --ts-extension ./ext/cursor-map.ts \
+    --native-extension RegisterCursorInfo \
+    --ts-extension ./ext/cursor.ts \
+    --native-extension RegisterHeaderAST \
+    --ts-extension ./ext/header-ast.ts \
+    --owner CXIndex:CXTranslationUnit \
+    --owner CXTranslationUnit:CXCursor \
+    --owner CXTranslationUnit:CXType \
+    --owner CXTranslationUnit:CXSourceLocation \
+    --owner CXTranslationUnit:CXSourceRange \
+    --owner CXTranslationUnit:CXFile \
+    --owner CXTranslationUnit:CXString \
+    --owner CXTranslationUnit:CXDiagnostic \
+    --owner CXTranslationUnit:CXDiagnosticSet \
+    --owner CXTranslationUnit:CXModule \
+    --owner CXTranslationUnit:CXTargetInfo \
+    --cache-dir "$SCRIPT_DIR/.codegen-cache" \
     -o "$TEMP_DIR/node-clang-raw" \
     /opt/homebrew/Cellar/llvm/20.1.8/include/clang-c/Index.h
 
@@ -77,15 +101,31 @@ else
     exit 1
 fi
 
-# Back up current bindings
+# Back up current bindings (index.ts and src/binding*.cpp/.h)
 print_step "Backing up current bindings..."
-cp packages/node-clang-raw/index.ts packages/node-clang-raw/index.ts.bak
-cp packages/node-clang-raw/src/binding.cpp packages/node-clang-raw/src/binding.cpp.bak
-
-# Copy generated files to node-clang-raw
+BACKUP_DIR=$(mktemp -d)
+mkdir -p "$BACKUP_DIR/src"
+cp packages/node-clang-raw/index.ts "$BACKUP_DIR/"
+cp packages/node-clang-raw/src/binding*.cpp "$BACKUP_DIR/src/"
+cp packages/node-clang-raw/src/binding*.h "$BACKUP_DIR/src/" 2>/dev/null || true
+
+# Copy generated files to node-clang-raw, leaving unchanged ones untouched so
+# the incremental build below skips them
 print_step "Copying regenerated bindings..."
-cp "$TEMP_DIR/node-clang-raw/index.ts" packages/node-clang-raw/index.ts
-cp "$TEMP_DIR/node-clang-raw/src/binding.cpp" packages/node-clang-raw/src/binding.cpp
+GENERATED_DIR="$TEMP_DIR/node-clang-raw"
+for file in index.ts $(cd "$GENERATED_DIR" && ls src/binding*.cpp src/binding*.h 2>/dev/null); do
+    if cmp -s "$GENERATED_DIR/$file" "packages/node-clang-raw/$file"; then
+        echo "  ✓ $file unchanged"
+    else
+        cp "$GENERATED_DIR/$file" "packages/node-clang-raw/$file"
+    fi
+done
+# Drop shards the new output no longer has
+for file in packages/node-clang-raw/src/binding*.cpp packages/node-clang-raw/src/binding*.h; do
+    if [ -e "$file" ] && [ ! -e "$GENERATED_DIR/src/$(basename "$file")" ]; then
+        rm "$file"
+    fi
+done
 
 # Clean up temp directory
 rm -rf "$TEMP_DIR"
@@ -96,27 +136,24 @@ echo "  ✓ Bindings copied successfully"
 print_step "Step 3: Building node-clang-raw with regenerated bindings..."
 cd packages/node-clang-raw
 
-# Clean previous build
-print_step "Cleaning previous build..."
-npm run clean
-
-# Rebuild with new bindings
+# Incremental build: only translation units whose sources changed recompile
 print_step "Rebuilding..."
-npm run rebuild
+npm run build
 
 if [ $? -eq 0 ]; then
     echo "  ✓ node-clang-raw rebuilt successfully with new bindings"
 else
     print_error "Failed to rebuild node-clang-raw"
     print_warning "Restoring backup files..."
-    cp index.ts.bak index.ts
-    cp src/binding.cpp.bak src/binding.cpp
-    rm index.ts.bak src/binding.cpp.bak
+    rm -f src/binding*.cpp src/binding*.h
+    cp "$BACKUP_DIR/index.ts" index.ts
+    cp "$BACKUP_DIR"/src/* src/
+    rm -rf "$BACKUP_DIR"
     exit 1
 fi
 
 # Remove backup files
-rm index.ts.bak src/binding.cpp.bak
+rm -rf "$BACKUP_DIR"
 
 cd "$SCRIPT_DIR"
 